@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include "hazelcast/client/protocol/codec/RingbufferAddAllCodec.h"
+#include "hazelcast/client/exception/UnexpectedMessageTypeException.h"
+#include "hazelcast/client/serialization/pimpl/Data.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace protocol {
+            namespace codec {
+                const RingbufferMessageType RingbufferAddAllCodec::RequestParameters::TYPE = HZ_RINGBUFFER_ADDALL;
+                const bool RingbufferAddAllCodec::RequestParameters::RETRYABLE = false;
+                const int32_t RingbufferAddAllCodec::ResponseParameters::TYPE = 103;
+                std::auto_ptr<ClientMessage> RingbufferAddAllCodec::RequestParameters::encode(
+                        const std::string &name, 
+                        const std::vector<serialization::pimpl::Data > &valueList, 
+                        int32_t overflowPolicy) {
+                    int32_t requiredDataSize = calculateDataSize(name, valueList, overflowPolicy);
+                    std::auto_ptr<ClientMessage> clientMessage = ClientMessage::createForEncode(requiredDataSize);
+                    clientMessage->setMessageType((uint16_t)RingbufferAddAllCodec::RequestParameters::TYPE);
+                    clientMessage->setRetryable(RETRYABLE);
+                    clientMessage->set(name);
+                    clientMessage->setArray<serialization::pimpl::Data >(valueList);
+                    clientMessage->set(overflowPolicy);
+                    clientMessage->updateFrameLength();
+                    return clientMessage;
+                }
+
+                int32_t RingbufferAddAllCodec::RequestParameters::calculateDataSize(
+                        const std::string &name, 
+                        const std::vector<serialization::pimpl::Data > &valueList, 
+                        int32_t overflowPolicy) {
+                    int32_t dataSize = ClientMessage::HEADER_SIZE;
+                    dataSize += ClientMessage::calculateDataSize(name);
+                    dataSize += ClientMessage::calculateDataSize<serialization::pimpl::Data >(valueList);
+                    dataSize += ClientMessage::calculateDataSize(overflowPolicy);
+                    return dataSize;
+                }
+
+                RingbufferAddAllCodec::ResponseParameters::ResponseParameters(ClientMessage &clientMessage) {
+                    if (TYPE != clientMessage.getMessageType()) {
+                        throw exception::UnexpectedMessageTypeException("RingbufferAddAllCodec::ResponseParameters::decode", clientMessage.getMessageType(), TYPE);
+                    }
+
+                    response = clientMessage.get<int64_t >();
+                }
+
+                RingbufferAddAllCodec::ResponseParameters RingbufferAddAllCodec::ResponseParameters::decode(ClientMessage &clientMessage) {
+                    return RingbufferAddAllCodec::ResponseParameters(clientMessage);
+                }
+
+                RingbufferAddAllCodec::ResponseParameters::ResponseParameters(const RingbufferAddAllCodec::ResponseParameters &rhs) {
+                        response = rhs.response;
+                }
+                //************************ EVENTS END **************************************************************************//
+
+            }
+        }
+    }
+}
+
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_ATOMICLONGACCUMULATOR_H_
+#define HAZELCAST_CLIENT_ATOMICLONGACCUMULATOR_H_
+
+#include <memory>
+#include <stdint.h>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/ConditionVariable.h"
+#include "hazelcast/util/AtomicBoolean.h"
+#include "hazelcast/util/Thread.h"
+#include "hazelcast/client/config/AtomicLongAccumulatorConfig.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        class IAtomicLong;
+
+        /**
+         * Accumulates the additions to an IAtomicLong locally and adds their sum to it periodically, for counters
+         * which are updated much more often than they are read.
+         *
+         * An add only updates a local cell, chosen by the thread id of the caller, so it neither waits for the
+         * cluster nor contends with the threads using the other cells. The sum of the cells is added to the
+         * IAtomicLong with a single call once the flush interval passes, or earlier when a cell reaches the flush
+         * threshold.
+         *
+         * The deltas are added to the IAtomicLong at least once. A failed flush keeps its delta pending and adds it
+         * again with the next flush. A flush can fail after the cluster has applied the addition, e.g. when the
+         * response is lost with the connection. In that case the retry adds the delta a second time. IAtomicLong has
+         * no idempotent addition to prevent this, so use the accumulator only for counters which tolerate an
+         * occasional over-count after a failure, such as statistics.
+         *
+         * An accumulator can be used by multiple threads. It should be closed to add the remaining deltas.
+         *
+         * @see IAtomicLong#newAccumulator
+         */
+        class HAZELCAST_API AtomicLongAccumulator {
+        public:
+            /**
+             * Internal API. Constructor, see IAtomicLong#newAccumulator
+             */
+            AtomicLongAccumulator(const IAtomicLong &atomicLong, const config::AtomicLongAccumulatorConfig &config);
+
+            virtual ~AtomicLongAccumulator();
+
+            /**
+             * Adds the delta locally.
+             *
+             * @param delta the value to add
+             * @throws IllegalStateException if the accumulator is closed
+             */
+            void add(int64_t delta);
+
+            /**
+             * Adds one locally.
+             *
+             * @throws IllegalStateException if the accumulator is closed
+             */
+            void increment();
+
+            /**
+             * @return the value of the IAtomicLong as of the last flush plus the local deltas which are not added
+             * to it yet. The additions of the other clients since the last flush are not included.
+             */
+            int64_t get();
+
+            /**
+             * @return the sum of the local deltas which are not added to the IAtomicLong yet
+             */
+            int64_t getPendingDelta();
+
+            /**
+             * Adds the local deltas to the IAtomicLong and waits for the result.
+             *
+             * @return the value of the IAtomicLong after the flush
+             * @throws IException if the addition fails. The deltas stay pending and are added again with the next
+             * flush, even if the failed call was applied by the cluster.
+             */
+            int64_t flush();
+
+            /**
+             * Flushes the accumulator and stops its background flushes. No delta can be added afterwards.
+             */
+            void close();
+
+        private:
+            struct Cell {
+                Cell();
+
+                util::Mutex lock;
+                int64_t value;
+                bool closed;
+                // keeps the hot cells on separate cache lines
+                char padding[64];
+            };
+
+            AtomicLongAccumulator(const AtomicLongAccumulator &);
+
+            AtomicLongAccumulator &operator=(const AtomicLongAccumulator &);
+
+            static void staticRunFlusher(util::ThreadArgs &args);
+
+            void runFlusher();
+
+            void signalFlusher();
+
+            Cell &getCell();
+
+            int64_t drainCells();
+
+            int64_t flushDeltas(bool skipIfEmpty);
+
+            std::auto_ptr<IAtomicLong> atomicLong;
+            int flushIntervalMillis;
+            int64_t flushThreshold;
+            int stripeCount;
+            Cell *cells;
+
+            // serializes the flushes, held while the delta is being added to the IAtomicLong
+            util::Mutex flushLock;
+
+            // guards the values below, never held during a call
+            util::Mutex stateLock;
+            int64_t lastValue;
+            int64_t unflushedDelta;
+
+            // set by add when a cell reaches the threshold, the flusher waits on flushCondition until it is set, the
+            // interval passes or the accumulator is closed
+            util::AtomicBoolean flushRequested;
+            util::Mutex flushSignalLock;
+            util::ConditionVariable flushCondition;
+            util::AtomicBoolean live;
+            std::auto_ptr<util::Thread> flushThread;
+        };
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_ATOMICLONGACCUMULATOR_H_
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_BATCHENTRYLISTENER_H_
+#define HAZELCAST_CLIENT_BATCHENTRYLISTENER_H_
+
+#include <vector>
+
+#include "hazelcast/client/LazyEntryEvent.h"
+
+namespace hazelcast {
+    namespace client {
+        class MapEvent;
+
+        /**
+        * Map entry listener which is notified with batches of entry events instead of a single event per call.
+        * It is meant for listeners on maps with a high update rate where the per event overhead of EntryListener
+        * dominates.
+        *
+        * Events are accumulated by the client until either the configured maximum batch size is reached or the
+        * configured maximum delay passes, whichever comes first. The events in a batch are in the order they are
+        * received, hence the events of a single partition are always delivered in order.
+        *
+        * Warning 1: If listener should do a time consuming operation, off-load the operation to another thread.
+        * otherwise it will slow down the system.
+        *
+        * Warning 2: Do not make a call to hazelcast. It can cause deadlock.
+        *
+        * @param <K> key of the map entry
+        * @param <V> value of the map entry.
+        * @see IMap#addBatchEntryListener(BatchEntryListener, bool, int, int)
+        */
+        template<typename K, typename V>
+        class BatchEntryListener {
+        public:
+            virtual ~BatchEntryListener() {
+
+            }
+
+            /**
+            * Invoked with the entry events (added, removed, updated, evicted, expired and merged) accumulated
+            * since the previous call. The events are valid only during the call unless they are copied.
+            *
+            * @param events entry events in the order they are received, never empty.
+            */
+            virtual void entriesChanged(const std::vector<LazyEntryEvent<K, V> > &events) = 0;
+
+            /**
+            * Invoked when all entries evicted by {@link IMap#evictAll()}. The pending entry events are delivered
+            * before this call.
+            *
+            * @param event map event
+            */
+            virtual void mapEvicted(const MapEvent &event) = 0;
+
+            /**
+            * Invoked when all entries are removed by {@link IMap#clear()}. The pending entry events are delivered
+            * before this call.
+            *
+            * @param event map event
+            */
+            virtual void mapCleared(const MapEvent &event) = 0;
+        };
+    }
+}
+
+#endif //HAZELCAST_CLIENT_BATCHENTRYLISTENER_H_
@@ -24,6 +24,7 @@
 #include "hazelcast/client/LoadBalancer.h"
 #include "hazelcast/client/impl/RoundRobinLB.h"
 #include "hazelcast/util/ILogger.h"
+#include "hazelcast/client/LogSink.h"
 #include "hazelcast/client/config/ReliableTopicConfig.h"
 
 #include <vector>
@@ -292,6 +293,15 @@ namespace hazelcast {
             */
             ClientConfig& setLogLevel(LogLevel loggerLevel);
 
+            /**
+            * Sets the destination of the client logs. The records are written by a background thread, the standard
+            * output is used if not set. The sink is not owned by the config and shall outlive the clients. The
+            * records of a client are written to the sink before its shutdown returns.
+            *
+            * @return itself ClientConfig
+            */
+            ClientConfig& setLogSink(LogSink *logSink);
+
 
             /**
             *
@@ -80,6 +80,40 @@ namespace hazelcast {
 
             const ClientProperty& getRetryWaitTime() const;
 
+            const ClientProperty& getSmartListenerRegistration() const;
+
+            const ClientProperty& getMessageFragmentSize() const;
+
+            const ClientProperty& getReliableTopicExecutorPoolSize() const;
+
+            const ClientProperty& getDeserializationPoolSize() const;
+
+            const ClientProperty& getDeserializationChunkSize() const;
+
+            const ClientProperty& getConnectionsPerMember() const;
+
+            const ClientProperty& getIOThreadCount() const;
+
+            const ClientProperty& getMaxConcurrentInvocations() const;
+
+            const ClientProperty& getMaxConcurrentInvocationsPerConnection() const;
+
+            const ClientProperty& getMaxWriteQueueBytes() const;
+
+            const ClientProperty& getBackpressurePolicy() const;
+
+            const ClientProperty& getBackpressureTimeoutMillis() const;
+
+            const ClientProperty& getIdGeneratorBlockSize() const;
+
+            const ClientProperty& getIdGeneratorPrefetchBlocks() const;
+
+            const ClientProperty& getHotKeySampleRate() const;
+
+            const ClientProperty& getHotKeyTopK() const;
+
+            const ClientProperty& getHotKeyDumpIntervalSeconds() const;
+
 
             /**
             * Client will be sending heartbeat messages to members and this is the timeout. If there is no any message
@@ -124,11 +158,215 @@ namespace hazelcast {
             */
             static const std::string PROP_REQUEST_RETRY_WAIT_TIME;
             static const std::string PROP_REQUEST_RETRY_WAIT_TIME_DEFAULT;
+
+            /**
+            * If set to true, a smart client registers the listeners which are not key based (e.g. map, queue or
+            * topic listeners) on every member of the cluster, and each member sends only the events of its own
+            * partitions. The registrations are renewed automatically when a member joins or leaves. If false, the
+            * listener is registered on a single member which forwards the events of the whole cluster.
+            *
+            * attribute      "hazelcast_client_smart_listener_registration"
+            * default value  "false"
+            */
+            static const std::string PROP_SMART_LISTENER_REGISTRATION;
+            static const std::string PROP_SMART_LISTENER_REGISTRATION_DEFAULT;
+
+            /**
+            * Maximum payload size in bytes of a single frame written to a connection. Larger messages are split into
+            * protocol fragments which are interleaved with the other messages written to the same connection, so
+            * that a large message does not delay the small ones queued behind it. Only the messages for a different
+            * partition are interleaved with a large message. Fragmentation is disabled if the value is 0 or negative.
+            *
+            * attribute      "hazelcast_client_message_fragment_size"
+            * default value  "0"
+            */
+            static const std::string PROP_MESSAGE_FRAGMENT_SIZE;
+            static const std::string PROP_MESSAGE_FRAGMENT_SIZE_DEFAULT;
+
+            /**
+            * Number of threads which deliver the messages of all the reliable topic listeners of the client. The
+            * listeners do not own a thread, they are scheduled on this pool whenever a batch of messages arrives.
+            *
+            * attribute      "hazelcast_client_reliable_topic_executor_pool_size"
+            * default value  "2"
+            */
+            static const std::string PROP_RELIABLE_TOPIC_EXECUTOR_POOL_SIZE;
+            static const std::string PROP_RELIABLE_TOPIC_EXECUTOR_POOL_SIZE_DEFAULT;
+
+            /**
+            * Number of threads which deserialize the large results of the map queries and bulk operations (e.g.
+            * IMap::entrySet, values, keySet and getAll) in parallel with the calling thread. The results are
+            * deserialized only by the calling thread if the value is 0.
+            *
+            * attribute      "hazelcast_client_deserialization_pool_size"
+            * default value  "0"
+            */
+            static const std::string PROP_DESERIALIZATION_POOL_SIZE;
+            static const std::string PROP_DESERIALIZATION_POOL_SIZE_DEFAULT;
+
+            /**
+            * Number of items deserialized by a thread at a time when a result is deserialized in parallel. The
+            * results with at most this many items are deserialized by the calling thread.
+            *
+            * attribute      "hazelcast_client_deserialization_chunk_size"
+            * default value  "1000"
+            */
+            static const std::string PROP_DESERIALIZATION_CHUNK_SIZE;
+            static const std::string PROP_DESERIALIZATION_CHUNK_SIZE_DEFAULT;
+
+            /**
+            * Number of connections a smart client opens to each member. The invocations of a partition are always
+            * written to the same connection, hence their order is kept, while the invocations of different
+            * partitions are spread over the connections of the partition owner.
+            *
+            * attribute      "hazelcast_client_connections_per_member"
+            * default value  "1"
+            */
+            static const std::string PROP_CONNECTIONS_PER_MEMBER;
+            static const std::string PROP_CONNECTIONS_PER_MEMBER_DEFAULT;
+
+            /**
+            * Number of input and number of output threads which serve the sockets of the client. The connections are
+            * assigned to the threads in a round robin fashion.
+            *
+            * attribute      "hazelcast_client_io_thread_count"
+            * default value  "1"
+            */
+            static const std::string PROP_IO_THREAD_COUNT;
+            static const std::string PROP_IO_THREAD_COUNT_DEFAULT;
+
+            /**
+            * Maximum number of invocations of the client which are waiting for their response. An invocation is not
+            * counted once its response or failure is received. The number is not limited if the value is 0 or
+            * negative.
+            *
+            * attribute      "hazelcast_client_max_concurrent_invocations"
+            * default value  "0"
+            */
+            static const std::string PROP_MAX_CONCURRENT_INVOCATIONS;
+            static const std::string PROP_MAX_CONCURRENT_INVOCATIONS_DEFAULT;
+
+            /**
+            * Maximum number of invocations waiting for their response on a single connection. An invocation is
+            * admitted to a connection only if the connection has less pending invocations. The number is not limited
+            * if the value is 0 or negative.
+            *
+            * attribute      "hazelcast_client_max_concurrent_invocations_per_connection"
+            * default value  "0"
+            */
+            static const std::string PROP_MAX_CONCURRENT_INVOCATIONS_PER_CONNECTION;
+            static const std::string PROP_MAX_CONCURRENT_INVOCATIONS_PER_CONNECTION_DEFAULT;
+
+            /**
+            * Maximum number of bytes waiting to be written to a single connection. An invocation is admitted to a
+            * connection only if less bytes are queued on the connection. The number is not limited if the value is
+            * 0 or negative.
+            *
+            * attribute      "hazelcast_client_max_write_queue_bytes"
+            * default value  "0"
+            */
+            static const std::string PROP_MAX_WRITE_QUEUE_BYTES;
+            static const std::string PROP_MAX_WRITE_QUEUE_BYTES_DEFAULT;
+
+            /**
+            * What to do with an invocation which exceeds one of the invocation limits above:
+            * "BLOCK" waits until the invocation is admitted and fails with HazelcastOverloadException if it is not
+            * admitted within hazelcast_client_backpressure_timeout_millis,
+            * "FAIL_FAST" fails with HazelcastOverloadException immediately,
+            * "CALLER_RUNS" sends the invocation and keeps the caller until the response is received, hence an
+            * asynchronous call (e.g. Ringbuffer::addAllAsync) behaves as a synchronous one while the client is
+            * overloaded.
+            *
+            * attribute      "hazelcast_client_backpressure_policy"
+            * default value  "BLOCK"
+            */
+            static const std::string PROP_BACKPRESSURE_POLICY;
+            static const std::string PROP_BACKPRESSURE_POLICY_DEFAULT;
+
+            /**
+            * Maximum time in milliseconds an invocation waits for admission with the "BLOCK" policy and for its
+            * response with the "CALLER_RUNS" policy.
+            *
+            * attribute      "hazelcast_client_backpressure_timeout_millis"
+            * default value  "60000"
+            */
+            static const std::string PROP_BACKPRESSURE_TIMEOUT_MILLIS;
+            static const std::string PROP_BACKPRESSURE_TIMEOUT_MILLIS_DEFAULT;
+
+            /**
+            * Number of ids an IdGenerator reserves from the cluster with a single call. It is rounded up to a
+            * multiple of IdGenerator::BLOCK_SIZE, so that the ids stay unique among the clients using different
+            * block sizes.
+            *
+            * attribute      "hazelcast_client_id_generator_block_size"
+            * default value  "1000"
+            */
+            static const std::string PROP_ID_GENERATOR_BLOCK_SIZE;
+            static const std::string PROP_ID_GENERATOR_BLOCK_SIZE_DEFAULT;
+
+            /**
+            * Number of id blocks an IdGenerator keeps in reserve. The next block is fetched in the background once
+            * half of the current block is used, so newId does not wait for the cluster. 0 disables the prefetch,
+            * a block is then fetched when the current one is exhausted.
+            *
+            * attribute      "hazelcast_client_id_generator_prefetch_blocks"
+            * default value  "1"
+            */
+            static const std::string PROP_ID_GENERATOR_PREFETCH_BLOCKS;
+            static const std::string PROP_ID_GENERATOR_PREFETCH_BLOCKS_DEFAULT;
+
+            /**
+            * The hot key profiler samples one of every this many key based map, multimap and queue operations to
+            * estimate the most accessed keys and the operation counts per partition and per member, see
+            * HazelcastClient#getHotKeyStats. 0 disables the profiler.
+            *
+            * attribute      "hazelcast_client_hot_key_sample_rate"
+            * default value  "0"
+            */
+            static const std::string PROP_HOT_KEY_SAMPLE_RATE;
+            static const std::string PROP_HOT_KEY_SAMPLE_RATE_DEFAULT;
+
+            /**
+            * Number of the most accessed keys tracked by the hot key profiler.
+            *
+            * attribute      "hazelcast_client_hot_key_top_k"
+            * default value  "20"
+            */
+            static const std::string PROP_HOT_KEY_TOP_K;
+            static const std::string PROP_HOT_KEY_TOP_K_DEFAULT;
+
+            /**
+            * Period of logging the hot key statistics in seconds. The statistics are halved after each period, so that
+            * they follow the recent load. 0 disables the periodic logging, the statistics are then halved every 60
+            * seconds.
+            *
+            * attribute      "hazelcast_client_hot_key_dump_interval_seconds"
+            * default value  "0"
+            */
+            static const std::string PROP_HOT_KEY_DUMP_INTERVAL_SECONDS;
+            static const std::string PROP_HOT_KEY_DUMP_INTERVAL_SECONDS_DEFAULT;
         private:
             ClientProperty heartbeatTimeout;
             ClientProperty heartbeatInterval;
             ClientProperty retryCount;
             ClientProperty retryWaitTime;
+            ClientProperty smartListenerRegistration;
+            ClientProperty messageFragmentSize;
+            ClientProperty reliableTopicExecutorPoolSize;
+            ClientProperty deserializationPoolSize;
+            ClientProperty deserializationChunkSize;
+            ClientProperty connectionsPerMember;
+            ClientProperty ioThreadCount;
+            ClientProperty maxConcurrentInvocations;
+            ClientProperty maxConcurrentInvocationsPerConnection;
+            ClientProperty maxWriteQueueBytes;
+            ClientProperty backpressurePolicy;
+            ClientProperty backpressureTimeoutMillis;
+            ClientProperty idGeneratorBlockSize;
+            ClientProperty idGeneratorPrefetchBlocks;
+            ClientProperty hotKeySampleRate;
+            ClientProperty hotKeyTopK;
+            ClientProperty hotKeyDumpIntervalSeconds;
         };
 
     }
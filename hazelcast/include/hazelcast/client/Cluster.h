@@ -21,6 +21,7 @@
 
 #include "hazelcast/client/Member.h"
 #include <vector>
+#include <boost/shared_ptr.hpp>
 
 namespace hazelcast {
     namespace client {
@@ -28,6 +29,10 @@ namespace hazelcast {
             class ClusterService;
         }
 
+        namespace connection {
+            class Connection;
+        }
+
         class MembershipListener;
 
         class InitialMembershipListener;
@@ -95,6 +100,20 @@ namespace hazelcast {
              */
             std::vector<Member> getMembers();
 
+            /**
+             * Internal API. Used by the load balancers to read the load of the members.
+             *
+             * @return the connection to the member at the address if the client is connected to it, NULL otherwise
+             */
+            boost::shared_ptr<connection::Connection> getConnection(const Address &address);
+
+            /**
+             * Internal API.
+             *
+             * @return the connections to the member at the address, one per connected stripe
+             */
+            std::vector<boost::shared_ptr<connection::Connection> > getConnections(const Address &address);
+
         private:
             spi::ClusterService &clusterService;
         };
@@ -269,7 +269,7 @@ namespace hazelcast {
              *
              * @return name of the map.
              */
-            std::string &getName() const {
+            const std::string &getName() const {
                 return name;
             };
 
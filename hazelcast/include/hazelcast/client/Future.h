@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_FUTURE_H_
+#define HAZELCAST_CLIENT_FUTURE_H_
+
+#include <memory>
+#include <ctime>
+
+#include "hazelcast/client/connection/CallFuture.h"
+#include "hazelcast/client/connection/CallCompletionListener.h"
+#include "hazelcast/client/protocol/ClientMessage.h"
+#include "hazelcast/client/serialization/pimpl/SerializationService.h"
+
+namespace hazelcast {
+    namespace client {
+        /**
+         * The result of an asynchronous operation. The operation is already sent to the cluster when the Future is
+         * returned, hence the caller can do other work and collect the result later.
+         *
+         * The result can be retrieved only once, either by get() or by a successful get(time_t).
+         *
+         * @param <V> type of the result of the operation
+         */
+        template<typename V>
+        class Future {
+        public:
+            /**
+             * Decodes the response message of the operation into the result.
+             */
+            typedef std::auto_ptr<V> (*Decoder)(protocol::ClientMessage &response,
+                                                serialization::pimpl::SerializationService &serializationService);
+
+            /**
+             * Internal API. Constructor
+             */
+            Future(const connection::CallFuture &callFuture,
+                   serialization::pimpl::SerializationService &serializationService, Decoder decoder)
+            : callFuture(callFuture)
+            , serializationService(&serializationService)
+            , decoder(decoder) {
+            }
+
+            /**
+             * Waits until the operation completes and returns its result.
+             *
+             * @return the result of the operation
+             * @throws IException the exception thrown by the operation, if it fails
+             */
+            std::auto_ptr<V> get() {
+                std::auto_ptr<protocol::ClientMessage> response = callFuture.get();
+                return decoder(*response, *serializationService);
+            }
+
+            /**
+             * Waits at most the given time for the operation to complete and returns its result.
+             *
+             * @param timeoutInSeconds the maximum time to wait
+             * @return the result of the operation
+             * @throws TimeoutException if the operation does not complete in time. get can be called again later.
+             * @throws IException the exception thrown by the operation, if it fails
+             */
+            std::auto_ptr<V> get(time_t timeoutInSeconds) {
+                std::auto_ptr<protocol::ClientMessage> response = callFuture.get(timeoutInSeconds);
+                return decoder(*response, *serializationService);
+            }
+
+            /**
+             * Internal API. Sets the listener to be notified when the operation completes. get() does not block
+             * once the listener is notified.
+             *
+             * @param listener the listener, usually notified from the io thread
+             */
+            void setCompletionListener(boost::shared_ptr<connection::CallCompletionListener> listener) {
+                callFuture.setCompletionListener(listener);
+            }
+
+        private:
+            connection::CallFuture callFuture;
+            serialization::pimpl::SerializationService *serializationService;
+            Decoder decoder;
+        };
+    }
+}
+
+#endif //HAZELCAST_CLIENT_FUTURE_H_
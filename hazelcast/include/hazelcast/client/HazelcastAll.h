@@ -22,6 +22,7 @@
 #define HAZELCAST_HazelcastAll
 
 #include "hazelcast/client/Address.h"
+#include "hazelcast/client/BatchEntryListener.h"
 #include "hazelcast/client/ClientConfig.h"
 #include "hazelcast/client/Cluster.h"
 #include "hazelcast/client/Credentials.h"
@@ -31,6 +32,7 @@
 #include "hazelcast/client/GroupConfig.h"
 #include "hazelcast/client/HazelcastClient.h"
 #include "hazelcast/client/IAtomicLong.h"
+#include "hazelcast/client/AtomicLongAccumulator.h"
 #include "hazelcast/client/ICountDownLatch.h"
 #include "hazelcast/client/serialization/IdentifiedDataSerializable.h"
 #include "hazelcast/client/IdGenerator.h"
@@ -47,11 +49,19 @@
 #include "hazelcast/client/LifecycleEvent.h"
 #include "hazelcast/client/LifecycleListener.h"
 #include "hazelcast/client/LoadBalancer.h"
+#include "hazelcast/client/map/BulkLoader.h"
+#include "hazelcast/client/map/MapCursor.h"
+#include "hazelcast/client/map/QueryCache.h"
+#include "hazelcast/client/map/WriteBehindBuffer.h"
+#include "hazelcast/client/map/Preloader.h"
 #include "hazelcast/client/Member.h"
 #include "hazelcast/client/MemberAttributeEvent.h"
 #include "hazelcast/client/MembershipEvent.h"
 #include "hazelcast/client/MembershipListener.h"
 #include "hazelcast/client/MultiMap.h"
+#include "hazelcast/client/PartitionAware.h"
+#include "hazelcast/client/Ringbuffer.h"
+#include "hazelcast/client/ringbuffer/TailingReader.h"
 #include "hazelcast/client/serialization/Portable.h"
 #include "hazelcast/client/Socket.h"
 #include "hazelcast/client/SocketInterceptor.h"
@@ -35,6 +35,10 @@
 #include "hazelcast/client/connection/ConnectionManager.h"
 #include "hazelcast/client/Ringbuffer.h"
 #include "hazelcast/client/ReliableTopic.h"
+#include "hazelcast/client/impl/DeserializationExecutor.h"
+#include "hazelcast/client/impl/HotKeyProfiler.h"
+#include "hazelcast/client/impl/BatchEventFlusher.h"
+#include "hazelcast/client/HotKeyStats.h"
 
 #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
 #pragma warning(push)
@@ -669,6 +673,22 @@ namespace hazelcast {
             */
             Cluster& getCluster();
 
+            /**
+            * Returns the statistics of the admission control which bounds the outstanding invocations of the client,
+            * see the ClientProperties invocation limits and backpressure policy.
+            *
+            * @return a snapshot of the admission statistics
+            */
+            InvocationAdmissionStats getInvocationAdmissionStats();
+
+            /**
+            * Returns the statistics of the hot key profiler, which samples the key based map, multimap and queue
+            * operations of the client, see ClientProperties::PROP_HOT_KEY_SAMPLE_RATE.
+            *
+            * @return a snapshot of the most accessed keys and the operation counts per partition and per member
+            */
+            HotKeyStats getHotKeyStats();
+
             /**
             * Add listener to listen lifecycle events.
             *
@@ -697,6 +717,8 @@ namespace hazelcast {
             ClientConfig clientConfig;
             ClientProperties clientProperties;
             spi::ClientContext clientContext;
+            // declared before the services, so that it outlives the batch listener handlers which they own
+            impl::BatchEventFlusher batchEventFlusher;
             spi::LifecycleService lifecycleService;
             serialization::pimpl::SerializationService serializationService;
             connection::ConnectionManager connectionManager;
@@ -704,6 +726,9 @@ namespace hazelcast {
             spi::PartitionService partitionService;
             spi::InvocationService invocationService;
             spi::ServerListenerService serverListenerService;
+            topic::impl::reliable::ReliableTopicExecutor reliableTopicExecutor;
+            impl::DeserializationExecutor deserializationExecutor;
+            impl::HotKeyProfiler hotKeyProfiler;
             Cluster cluster;
 
             HazelcastClient(const HazelcastClient& rhs);
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_HOTKEYSTATS_H_
+#define HAZELCAST_CLIENT_HOTKEYSTATS_H_
+
+#include <map>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/client/Address.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        /**
+         * A snapshot of the hot key profiler, see HazelcastClient#getHotKeyStats. The profiler is enabled via
+         * ClientProperties::PROP_HOT_KEY_SAMPLE_RATE.
+         *
+         * The counts are estimated from the sampled key based map, multimap and queue operations, i.e. a sampled
+         * operation counts as sample rate operations. The profiler halves all the counts periodically, see
+         * ClientProperties::PROP_HOT_KEY_DUMP_INTERVAL_SECONDS, so they weigh the recent operations the most. The count
+         * of a key may be over estimated when its sketch counters are shared with other keys, it is never under
+         * estimated.
+         */
+        class HAZELCAST_API HotKeyStats {
+        public:
+            /**
+             * One of the most accessed keys.
+             */
+            class HAZELCAST_API HotKey {
+            public:
+                HotKey(const std::string &objectName, const std::vector<byte> &key, int partitionId,
+                       int64_t estimatedCount);
+
+                /**
+                 * @return the name of the map, multimap or queue the key is accessed on
+                 */
+                const std::string &getObjectName() const;
+
+                /**
+                 * @return the serialized key, the queue name for a queue
+                 */
+                const std::vector<byte> &getKey() const;
+
+                /**
+                 * @return the partition of the key
+                 */
+                int getPartitionId() const;
+
+                /**
+                 * @return the estimated number of the operations on the key
+                 */
+                int64_t getEstimatedCount() const;
+
+            private:
+                std::string objectName;
+                std::vector<byte> key;
+                int partitionId;
+                int64_t estimatedCount;
+            };
+
+            HotKeyStats(int sampleRate, int64_t sampledOperationCount, const std::vector<HotKey> &hotKeys,
+                        const std::map<int, int64_t> &partitionOperationCounts,
+                        const std::map<Address, int64_t, addressComparator> &memberOperationCounts);
+
+            /**
+             * @return one of every this many operations is sampled, 0 if the profiler is disabled
+             */
+            int getSampleRate() const;
+
+            /**
+             * @return the number of the sampled operations
+             */
+            int64_t getSampledOperationCount() const;
+
+            /**
+             * @return the most accessed keys, the most accessed one first
+             */
+            const std::vector<HotKey> &getHotKeys() const;
+
+            /**
+             * @return the estimated number of the operations per partition id
+             */
+            const std::map<int, int64_t> &getPartitionOperationCounts() const;
+
+            /**
+             * @return the estimated number of the operations per member, a partition operation is counted for the
+             * owner of the partition at the time of the operation
+             */
+            const std::map<Address, int64_t, addressComparator> &getMemberOperationCounts() const;
+
+        private:
+            int sampleRate;
+            int64_t sampledOperationCount;
+            std::vector<HotKey> hotKeys;
+            std::map<int, int64_t> partitionOperationCounts;
+            std::map<Address, int64_t, addressComparator> memberOperationCounts;
+        };
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_HOTKEYSTATS_H_
@@ -20,6 +20,8 @@
 #include "hazelcast/client/spi/InvocationService.h"
 #include "hazelcast/client/serialization/pimpl/Data.h"
 #include "hazelcast/client/proxy/ProxyImpl.h"
+#include "hazelcast/client/Future.h"
+#include "hazelcast/client/AtomicLongAccumulator.h"
 #include <string>
 #include <stdint.h>
 
@@ -83,6 +85,14 @@ namespace hazelcast {
             */
             int64_t getAndAdd(int64_t delta);
 
+            /**
+            * Asynchronously adds the given value to the current value.
+            *
+            * @param delta the value to add
+            * @return the future of the old value before the add
+            */
+            Future<int64_t> getAndAddAsync(int64_t delta);
+
             /**
             * sets the given value and returns the old value.
             *
@@ -112,10 +122,22 @@ namespace hazelcast {
             */
             void set(int64_t newValue);
 
+            /**
+            * creates an accumulator which adds the local additions to this atomic long periodically.
+            *
+            * @param config the flush interval, threshold and stripe count of the accumulator
+            * @return the new accumulator, it should be closed when it is not used anymore
+            */
+            std::auto_ptr<AtomicLongAccumulator> newAccumulator(
+                    const config::AtomicLongAccumulatorConfig &config = config::AtomicLongAccumulatorConfig());
+
         private:
 
             IAtomicLong(const std::string& objectName, spi::ClientContext *context);
 
+            static std::auto_ptr<int64_t> decodeGetAndAddResponse(protocol::ClientMessage &response,
+                                                                  serialization::pimpl::SerializationService &);
+
             int partitionId;
         };
     }
@@ -23,11 +23,24 @@
 #include <stdexcept>
 #include <climits>
 #include "hazelcast/client/protocol/codec/MapAddEntryListenerWithPredicateCodec.h"
+#include "hazelcast/client/protocol/codec/MapGetCodec.h"
 #include "hazelcast/client/impl/EntryArrayImpl.h"
+#include "hazelcast/client/impl/DataArrayImpl.h"
+#include "hazelcast/client/impl/DeserializationExecutor.h"
 #include "hazelcast/client/proxy/IMapImpl.h"
 #include "hazelcast/client/impl/EntryEventHandler.h"
+#include "hazelcast/client/impl/BatchEntryEventHandler.h"
 #include "hazelcast/client/EntryListener.h"
 #include "hazelcast/client/EntryView.h"
+#include "hazelcast/client/LazyValue.h"
+#include "hazelcast/client/Future.h"
+#include "hazelcast/client/map/BulkLoader.h"
+#include "hazelcast/client/map/MapCursor.h"
+#include "hazelcast/client/config/BulkLoaderConfig.h"
+#include "hazelcast/client/map/WriteBehindBuffer.h"
+#include "hazelcast/client/config/WriteBehindConfig.h"
+#include "hazelcast/client/map/Preloader.h"
+#include "hazelcast/client/config/PreloaderConfig.h"
 
 #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
 #pragma warning(push)
@@ -92,6 +105,65 @@ namespace hazelcast {
                 return boost::shared_ptr<V>(toObject<V>(proxy::IMapImpl::getData(toData(key))));
             }
 
+            /**
+            * Asynchronously gets the value. The request is sent when the method returns, the value is deserialized
+            * by the thread which collects the result from the future.
+            *
+            * @param key
+            * @return the future of the value, the result is NULL if there is no mapping for key.
+            */
+            Future<V> getAsync(const K &key) {
+                return Future<V>(proxy::IMapImpl::getAsyncData(toData(key)), context->getSerializationService(),
+                                 decodeGetResponse);
+            }
+
+            /**
+            * Gets the value without deserializing it. The value is deserialized on the first access to the returned
+            * handle, and not at all if only its serialized form is used.
+            *
+            * @param key
+            * @return handle of the value, the handle is null if there is no mapping for key.
+            */
+            LazyValue<V> getLazy(const K &key) {
+                boost::shared_ptr<serialization::pimpl::Data> valueData(proxy::IMapImpl::getData(toData(key)));
+                return LazyValue<V>(valueData, context->getSerializationService());
+            }
+
+            /**
+            * Gets the serialized value as it is stored in the cluster, without deserializing it. The result can be
+            * put back into a map with the same value type by putRaw.
+            *
+            * @param key
+            * @return the serialized value, NULL if there is no mapping for key.
+            */
+            std::auto_ptr<serialization::pimpl::Data> getRaw(const K &key) {
+                std::auto_ptr<serialization::pimpl::Data> valueData = proxy::IMapImpl::getData(toData(key));
+                if (NULL != valueData.get() && 0 == valueData->totalSize()) {
+                    valueData.reset();
+                }
+                return valueData;
+            }
+
+            /**
+            * Puts an already serialized value into the map, e.g. a value returned by getRaw. The value is not
+            * validated against the value type of the map.
+            *
+            * @param key              key of the entry
+            * @param value            serialized value of the entry
+            * @param ttlInMillis      maximum time for this entry to stay in the map in milliseconds,0 means infinite,
+            *                         -1 means the ttl of the map configuration.
+            * @return the serialized previous value, NULL if there is no mapping for key.
+            */
+            std::auto_ptr<serialization::pimpl::Data> putRaw(const K &key, const serialization::pimpl::Data &value,
+                                                             long ttlInMillis = -1) {
+                std::auto_ptr<serialization::pimpl::Data> oldValue = proxy::IMapImpl::putData(toData(key), value,
+                                                                                              ttlInMillis);
+                if (NULL != oldValue.get() && 0 == oldValue->totalSize()) {
+                    oldValue.reset();
+                }
+                return oldValue;
+            }
+
             /**
             * put new entry into map.
             * @param key
@@ -436,6 +508,58 @@ namespace hazelcast {
                 return proxy::IMapImpl::addEntryListener(entryEventHandler, predicate, includeValue);
             }
 
+            /**
+            * Adds a batch entry listener for this map. The entry events are accumulated and delivered to the listener
+            * in batches of at most maxBatchSize events, a batch is delivered at most maxDelayMillis milliseconds after
+            * its first event is received. The keys and the values of the events are deserialized lazily on access.
+            *
+            * Warning 1: If listener should do a time consuming operation, off-load the operation to another thread.
+            * otherwise it will slow down the system.
+            *
+            * Warning 2: Do not make a call to hazelcast. It can cause deadlock.
+            *
+            * @param listener       batch entry listener
+            * @param includeValue   <tt>true</tt> if the events should contain the values.
+            * @param maxBatchSize   maximum number of events delivered in a single call.
+            * @param maxDelayMillis maximum time in milliseconds an event may wait in the batch before it is delivered.
+            *
+            * @return registrationId of added listener that can be used to remove the entry listener.
+            */
+            std::string addBatchEntryListener(BatchEntryListener<K, V> &listener, bool includeValue,
+                                              int maxBatchSize = 1000, int maxDelayMillis = 100) {
+                impl::BatchEntryEventHandler<K, V, protocol::codec::MapAddEntryListenerCodec::AbstractEventHandler> *entryEventHandler =
+                        new impl::BatchEntryEventHandler<K, V, protocol::codec::MapAddEntryListenerCodec::AbstractEventHandler>(
+                                getName(), context->getClusterService(), context->getSerializationService(),
+                                context->getBatchEventFlusher(), listener, includeValue, maxBatchSize, maxDelayMillis);
+                return proxy::IMapImpl::addEntryListener(entryEventHandler, includeValue);
+            }
+
+            /**
+            * Adds a batch entry listener for this map which is notified only for the entries matching the predicate.
+            *
+            * Warning 1: If listener should do a time consuming operation, off-load the operation to another thread.
+            * otherwise it will slow down the system.
+            *
+            * Warning 2: Do not make a call to hazelcast. It can cause deadlock.
+            *
+            * @param listener       batch entry listener
+            * @param predicate      The query filter to use when returning the events to the user.
+            * @param includeValue   <tt>true</tt> if the events should contain the values.
+            * @param maxBatchSize   maximum number of events delivered in a single call.
+            * @param maxDelayMillis maximum time in milliseconds an event may wait in the batch before it is delivered.
+            *
+            * @return registrationId of added listener that can be used to remove the entry listener.
+            * @see #addBatchEntryListener(BatchEntryListener, bool, int, int)
+            */
+            std::string addBatchEntryListener(BatchEntryListener<K, V> &listener, const query::Predicate &predicate,
+                                              bool includeValue, int maxBatchSize = 1000, int maxDelayMillis = 100) {
+                impl::BatchEntryEventHandler<K, V, protocol::codec::MapAddEntryListenerWithPredicateCodec::AbstractEventHandler> *entryEventHandler =
+                        new impl::BatchEntryEventHandler<K, V, protocol::codec::MapAddEntryListenerWithPredicateCodec::AbstractEventHandler>(
+                                getName(), context->getClusterService(), context->getSerializationService(),
+                                context->getBatchEventFlusher(), listener, includeValue, maxBatchSize, maxDelayMillis);
+                return proxy::IMapImpl::addEntryListener(entryEventHandler, predicate, includeValue);
+            }
+
             /**
             * Removes the specified entry listener
             * Returns silently if there is no such listener added before.
@@ -532,11 +656,33 @@ namespace hazelcast {
                 std::map<K, V> result;
                 std::vector<std::pair<serialization::pimpl::Data, serialization::pimpl::Data> > entrySet = proxy::IMapImpl::getAllData(
                         keySet);
-                for (std::vector<std::pair<serialization::pimpl::Data, serialization::pimpl::Data> >::const_iterator it = entrySet.begin();
-                     it != entrySet.end(); ++it) {
+                impl::EntryArrayImpl<K, V> entries(entrySet, context->getSerializationService());
+                context->getDeserializationExecutor().deserializeAll(entries);
+                for (size_t i = 0; i < entries.size(); ++i) {
+                    result[*entries.getKey(i)] = *entries.getValue(i);
+                }
+                return result;
+            }
+
+            /**
+            * Returns the entries for the given keys with the values in serialized form, the values are not
+            * deserialized.
+            *
+            * @param keys keys to get
+            * @return map of the keys to the serialized values
+            */
+            std::map<K, serialization::pimpl::Data> getAllRaw(const std::set<K> &keys) {
+                std::vector<serialization::pimpl::Data> keySet(keys.size());
+                size_t i = 0;
+                for (typename std::set<K>::iterator it = keys.begin(); it != keys.end(); ++it) {
+                    keySet[i++] = toData(*it);
+                }
+                std::map<K, serialization::pimpl::Data> result;
+                EntryVector entrySet = proxy::IMapImpl::getAllData(keySet);
+                for (EntryVector::iterator it = entrySet.begin(); it != entrySet.end(); ++it) {
                     std::auto_ptr<K> key = toObject<K>(it->first);
-                    std::auto_ptr<V> value = toObject<V>(it->second);
-                    result[*key] = *value;
+                    // the copy takes over the buffer of the response
+                    result[*key] = it->second;
                 }
                 return result;
             }
@@ -550,13 +696,7 @@ namespace hazelcast {
             */
             std::vector<K> keySet() {
                 std::vector<serialization::pimpl::Data> dataResult = proxy::IMapImpl::keySetData();
-                size_t size = dataResult.size();
-                std::vector<K> keys(size);
-                for (size_t i = 0; i < size; ++i) {
-                    std::auto_ptr<K> key = toObject<K>(dataResult[i]);
-                    keys[i] = *key;
-                }
-                return keys;
+                return toObjects<K>(dataResult);
             }
 
             /**
@@ -589,13 +729,7 @@ namespace hazelcast {
               */
             std::vector<K> keySet(const query::Predicate &predicate) {
                 std::vector<serialization::pimpl::Data> dataResult = proxy::IMapImpl::keySetData(predicate);
-                size_t size = dataResult.size();
-                std::vector<K> keys(size);
-                for (size_t i = 0; i < size; ++i) {
-                    std::auto_ptr<K> key = toObject<K>(dataResult[i]);
-                    keys[i] = *key;
-                }
-                return keys;
+                return toObjects<K>(dataResult);
             }
 
             /**
@@ -612,17 +746,11 @@ namespace hazelcast {
             std::vector<K> keySet(query::PagingPredicate<K, V> &predicate) {
                 predicate.setIterationType(query::KEY);
 
-                std::vector<serialization::pimpl::Data> dataResult = keySetForPagingPredicateData(predicate);
-
-                EntryVector entryResult;
-                for (std::vector<serialization::pimpl::Data>::iterator it = dataResult.begin();it != dataResult.end(); ++it) {
-                    entryResult.push_back(std::pair<serialization::pimpl::Data, serialization::pimpl::Data>(*it, serialization::pimpl::Data()));
-                }
+                EntryVector entryResult = pagingPredicateData<K, V>(predicate, query::KEY);
 
                 impl::EntryArrayImpl<K, V> entries(entryResult, context->getSerializationService());
-                entries.sort(query::KEY, predicate.getComparator());
 
-                std::pair<size_t, size_t> range = updateAnchor<K, V>(entries, predicate, query::KEY);
+                std::pair<size_t, size_t> range = sortPage<K, V>(entries, predicate, query::KEY);
 
                 std::vector<K> result;
                 for (size_t i = range.first; i < range.second; ++i) {
@@ -641,13 +769,7 @@ namespace hazelcast {
             */
             std::vector<V> values() {
                 std::vector<serialization::pimpl::Data> dataResult = proxy::IMapImpl::valuesData();
-                size_t size = dataResult.size();
-                std::vector<K> values(size);
-                for (size_t i = 0; i < size; ++i) {
-                    std::auto_ptr<K> value = toObject<K>(dataResult[i]);
-                    values[i] = *value;
-                }
-                return values;
+                return toObjects<V>(dataResult);
             }
 
             /**
@@ -675,13 +797,7 @@ namespace hazelcast {
             */
             std::vector<V> values(const query::Predicate &predicate) {
                 std::vector<serialization::pimpl::Data> dataResult = proxy::IMapImpl::valuesData(predicate);
-                size_t size = dataResult.size();
-                std::vector<V> values(size);
-                for (size_t i = 0; i < size; ++i) {
-                    std::auto_ptr<V> value = toObject<V>(dataResult[i]);
-                    values[i] = *value;
-                }
-                return values;
+                return toObjects<V>(dataResult);
             }
 
             /**
@@ -696,13 +812,11 @@ namespace hazelcast {
             std::vector<V> values(query::PagingPredicate<K, V> &predicate) {
                 predicate.setIterationType(query::VALUE);
 
-                EntryVector dataResult = proxy::IMapImpl::valuesForPagingPredicateData(predicate);
+                EntryVector dataResult = pagingPredicateData<K, V>(predicate, query::VALUE);
 
                 impl::EntryArrayImpl<K, V> entries(dataResult, context->getSerializationService());
 
-                entries.sort(query::VALUE, predicate.getComparator());
-
-                std::pair<size_t, size_t> range = updateAnchor<K, V>(entries, predicate, query::VALUE);
+                std::pair<size_t, size_t> range = sortPage<K, V>(entries, predicate, query::VALUE);
 
                 std::vector<V> result;
                 for (size_t i = range.first; i < range.second; ++i) {
@@ -720,14 +834,7 @@ namespace hazelcast {
             */
             std::vector<std::pair<K, V> > entrySet() {
                 std::vector<std::pair<serialization::pimpl::Data, serialization::pimpl::Data> > dataResult = proxy::IMapImpl::entrySetData();
-                size_t size = dataResult.size();
-                std::vector<std::pair<K, V> > entries(size);
-                for (size_t i = 0; i < size; ++i) {
-                    std::auto_ptr<K> key = toObject<K>(dataResult[i].first);
-                    std::auto_ptr<V> value = toObject<V>(dataResult[i].second);
-                    entries[i] = std::make_pair(*key, *value);
-                }
-                return entries;
+                return toObjectEntries(dataResult);
             }
 
             /**
@@ -745,14 +852,7 @@ namespace hazelcast {
             std::vector<std::pair<K, V> > entrySet(const serialization::IdentifiedDataSerializable &predicate) {
                 std::vector<std::pair<serialization::pimpl::Data, serialization::pimpl::Data> > dataResult = proxy::IMapImpl::entrySetData(
                         predicate);
-                size_t size = dataResult.size();
-                std::vector<std::pair<K, V> > entries(size);
-                for (size_t i = 0; i < size; ++i) {
-                    std::auto_ptr<K> key = toObject<K>(dataResult[i].first);
-                    std::auto_ptr<V> value = toObject<V>(dataResult[i].second);
-                    entries[i] = std::make_pair(*key, *value);
-                }
-                return entries;
+                return toObjectEntries(dataResult);
             }
 
             /**
@@ -768,14 +868,7 @@ namespace hazelcast {
             std::vector<std::pair<K, V> > entrySet(const query::Predicate &predicate) {
                 std::vector<std::pair<serialization::pimpl::Data, serialization::pimpl::Data> > dataResult = proxy::IMapImpl::entrySetData(
                         predicate);
-                size_t size = dataResult.size();
-                std::vector<std::pair<K, V> > entries(size);
-                for (size_t i = 0; i < size; ++i) {
-                    std::auto_ptr<K> key = toObject<K>(dataResult[i].first);
-                    std::auto_ptr<V> value = toObject<V>(dataResult[i].second);
-                    entries[i] = std::make_pair(*key, *value);
-                }
-                return entries;
+                return toObjectEntries(dataResult);
             }
 
             /**
@@ -789,13 +882,11 @@ namespace hazelcast {
             * @return result entry vector of the query
             */
             std::vector<std::pair<K, V> > entrySet(query::PagingPredicate<K, V> &predicate) {
-                std::vector<std::pair<serialization::pimpl::Data, serialization::pimpl::Data> > dataResult = proxy::IMapImpl::entrySetForPagingPredicateData(
-                        predicate);
+                EntryVector dataResult = pagingPredicateData<K, V>(predicate, query::ENTRY);
 
                 impl::EntryArrayImpl<K, V> entries(dataResult, context->getSerializationService());
-                entries.sort(query::ENTRY, predicate.getComparator());
 
-                std::pair<size_t, size_t> range = updateAnchor<K, V>(entries, predicate, query::ENTRY);
+                std::pair<size_t, size_t> range = sortPage<K, V>(entries, predicate, query::ENTRY);
 
                 std::vector<std::pair<K, V> > result;
                 for (size_t i = range.first; i < range.second; ++i) {
@@ -1003,10 +1094,117 @@ namespace hazelcast {
                 proxy::IMapImpl::clear();
             }
 
+            /**
+            * Creates a cursor which walks all the entries of this map page by page, in the order of the keys, see
+            * map::MapCursor.
+            *
+            * Unlike entrySet, the memory used does not depend on the size of the map and the next page is fetched
+            * while the caller processes the current one.
+            *
+            * @param pageSize the maximum number of entries in a page
+            * @return the cursor
+            * @throws IllegalArgumentException if pageSize is 0
+            */
+            std::auto_ptr<map::MapCursor<K, V> > newCursor(size_t pageSize) {
+                return newCursor(pageSize, std::auto_ptr<query::Predicate>());
+            }
+
+            /**
+            * Creates a cursor which walks the entries of this map matching the predicate page by page, see
+            * map::MapCursor.
+            *
+            * @param pageSize the maximum number of entries in a page
+            * @param predicate the criteria of the entries to walk, NULL to walk all the entries
+            * @param comparator the order of the entries, NULL to walk in the order of the keys
+            * @return the cursor
+            * @throws IllegalArgumentException if pageSize is 0
+            */
+            std::auto_ptr<map::MapCursor<K, V> > newCursor(size_t pageSize, std::auto_ptr<query::Predicate> predicate,
+                                                           std::auto_ptr<query::EntryComparator<K, V> > comparator =
+                                                           std::auto_ptr<query::EntryComparator<K, V> >()) {
+                return std::auto_ptr<map::MapCursor<K, V> >(
+                        new map::MapCursor<K, V>(getName(), *context, pageSize, predicate, comparator));
+            }
+
+            /**
+            * Creates a loader which streams a large number of entries into this map, see map::BulkLoader.
+            *
+            * Unlike putAll, the entries do not need to be collected into a single map beforehand: they are stored
+            * in batches per partition as they are added, with a bounded number of batches in flight per member.
+            *
+            * @param config the batching, linger and in flight limits of the loader
+            * @return the loader. It should be closed to store the remaining entries.
+            */
+            std::auto_ptr<map::BulkLoader<K, V> > newBulkLoader(
+                    const config::BulkLoaderConfig &config = config::BulkLoaderConfig()) {
+                return std::auto_ptr<map::BulkLoader<K, V> >(new map::BulkLoader<K, V>(getName(), *context, config));
+            }
+
+            /**
+            * Creates a buffer which coalesces the updates of the same key and stores them in the background, see
+            * map::WriteBehindBuffer.
+            *
+            * @param config the coalescing window, batch size and capacity of the buffer
+            * @return the buffer. It should be closed to store the remaining updates.
+            */
+            std::auto_ptr<map::WriteBehindBuffer<K, V> > newWriteBehindBuffer(
+                    const config::WriteBehindConfig &config = config::WriteBehindConfig()) {
+                return std::auto_ptr<map::WriteBehindBuffer<K, V> >(
+                        new map::WriteBehindBuffer<K, V>(getName(), *context, config));
+            }
+
+            /**
+            * Creates a preloader which warms up a client side cache of this map from the key snapshot stored by a
+            * previous run, see map::Preloader. The preload starts in the background immediately.
+            *
+            * @param listener the listener receiving the loaded entries, it should live longer than the preloader
+            * @param config the snapshot location, batching and bandwidth budget of the preloader
+            * @return the preloader. It should be closed to store the final hot key snapshot.
+            */
+            std::auto_ptr<map::Preloader<K, V> > newPreloader(map::PreloadListener<K, V> &listener,
+                    const config::PreloaderConfig &config = config::PreloaderConfig()) {
+                return std::auto_ptr<map::Preloader<K, V> >(
+                        new map::Preloader<K, V>(getName(), *context, listener, config));
+            }
+
         private:
             IMap(const std::string &instanceName, spi::ClientContext *context)
                     : proxy::IMapImpl(instanceName, context) {
             }
+
+            /**
+             * Deserializes a query or bulk result, in parallel if it is large, see
+             * ClientProperties::PROP_DESERIALIZATION_POOL_SIZE.
+             */
+            template<typename T>
+            std::vector<T> toObjects(const std::vector<serialization::pimpl::Data> &dataResult) {
+                impl::DataArrayImpl<T> items(dataResult, context->getSerializationService());
+                context->getDeserializationExecutor().deserializeAll(items);
+                size_t size = items.size();
+                std::vector<T> result(size);
+                for (size_t i = 0; i < size; ++i) {
+                    result[i] = *items.get(i);
+                }
+                return result;
+            }
+
+            std::vector<std::pair<K, V> > toObjectEntries(const EntryVector &dataResult) {
+                impl::EntryArrayImpl<K, V> entries(dataResult, context->getSerializationService());
+                context->getDeserializationExecutor().deserializeAll(entries);
+                size_t size = entries.size();
+                std::vector<std::pair<K, V> > result(size);
+                for (size_t i = 0; i < size; ++i) {
+                    result[i] = std::make_pair(*entries.getKey(i), *entries.getValue(i));
+                }
+                return result;
+            }
+
+            static std::auto_ptr<V> decodeGetResponse(protocol::ClientMessage &response,
+                                                      serialization::pimpl::SerializationService &service) {
+                std::auto_ptr<serialization::pimpl::Data> valueData =
+                        protocol::codec::MapGetCodec::ResponseParameters::decode(response).response;
+                return service.toObject<V>(valueData.get());
+            }
         };
     }
 }
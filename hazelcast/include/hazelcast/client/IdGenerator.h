@@ -17,7 +17,6 @@
 #define HAZELCAST_ID_GENERATOR
 
 #include "hazelcast/client/IAtomicLong.h"
-#include "hazelcast/util/AtomicInt.h"
 #include <boost/shared_ptr.hpp>
 #include <string>
 
@@ -38,6 +37,10 @@ namespace hazelcast {
 
         /**
          * Cluster-wide unique id generator.
+         *
+         * The ids are reserved from the cluster in blocks, see ClientProperties::PROP_ID_GENERATOR_BLOCK_SIZE, and
+         * the next blocks are fetched in the background before the current one is exhausted, see
+         * ClientProperties::PROP_ID_GENERATOR_PREFETCH_BLOCKS. The copies of an IdGenerator share their blocks.
          */
         class HAZELCAST_API IdGenerator : public proxy::ProxyImpl {
             friend class HazelcastClient;
@@ -60,16 +63,17 @@ namespace hazelcast {
              * as long as the cluster is live. If the cluster restarts then
              * id generation will start from 0.
              *
+             * It waits for the cluster only if the current block and the prefetched blocks are exhausted.
+             *
              * @return cluster-wide new unique id
+             * @throws HazelcastException if a new block is needed and it can not be fetched
              */
             long newId();
 
         private:
 
             IAtomicLong atomicLong;
-            boost::shared_ptr< util::AtomicInt > local;
-            boost::shared_ptr< util::AtomicInt > residue;
-            boost::shared_ptr< util::Mutex > localLock;
+            boost::shared_ptr<impl::IdGeneratorSupport> support;
             IdGenerator(const std::string &instanceName, spi::ClientContext *context);
 
             void onDestroy();
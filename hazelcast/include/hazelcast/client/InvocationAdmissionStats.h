@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_INVOCATIONADMISSIONSTATS_H_
+#define HAZELCAST_CLIENT_INVOCATIONADMISSIONSTATS_H_
+
+#include <stdint.h>
+
+#include "hazelcast/util/HazelcastDll.h"
+
+namespace hazelcast {
+    namespace client {
+        /**
+         * A snapshot of the admission control of the invocations, see HazelcastClient#getInvocationAdmissionStats.
+         * The admission control is configured via the ClientProperties invocation limits and backpressure policy.
+         */
+        class HAZELCAST_API InvocationAdmissionStats {
+        public:
+            InvocationAdmissionStats(int64_t outstandingInvocations, int64_t admittedInvocations,
+                                     int64_t waitedInvocations, int64_t totalWaitMillis, int64_t maxWaitMillis,
+                                     int64_t rejectedInvocations, int64_t callerRunsInvocations);
+
+            /**
+             * @return the number of the admitted invocations which are not completed yet
+             */
+            int64_t getOutstandingInvocations() const;
+
+            /**
+             * @return the number of the invocations admitted since the client is started
+             */
+            int64_t getAdmittedInvocations() const;
+
+            /**
+             * @return the number of the invocations which waited because of an invocation limit
+             */
+            int64_t getWaitedInvocations() const;
+
+            /**
+             * @return the total time the invocations waited because of an invocation limit
+             */
+            int64_t getTotalWaitMillis() const;
+
+            /**
+             * @return the longest time an invocation waited because of an invocation limit
+             */
+            int64_t getMaxWaitMillis() const;
+
+            /**
+             * @return the number of the invocations which failed with HazelcastOverloadException
+             */
+            int64_t getRejectedInvocations() const;
+
+            /**
+             * @return the number of the invocations which kept their caller until their response is received
+             */
+            int64_t getCallerRunsInvocations() const;
+
+        private:
+            int64_t outstandingInvocations;
+            int64_t admittedInvocations;
+            int64_t waitedInvocations;
+            int64_t totalWaitMillis;
+            int64_t maxWaitMillis;
+            int64_t rejectedInvocations;
+            int64_t callerRunsInvocations;
+        };
+    }
+}
+
+#endif //HAZELCAST_CLIENT_INVOCATIONADMISSIONSTATS_H_
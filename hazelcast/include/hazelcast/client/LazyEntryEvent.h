@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_LAZYENTRYEVENT_H_
+#define HAZELCAST_CLIENT_LAZYENTRYEVENT_H_
+
+#include <string>
+#include <boost/shared_ptr.hpp>
+
+#include "hazelcast/client/EntryEvent.h"
+#include "hazelcast/client/Member.h"
+#include "hazelcast/client/LazyValue.h"
+#include "hazelcast/client/serialization/pimpl/Data.h"
+#include "hazelcast/client/serialization/pimpl/SerializationService.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        /**
+         * Map entry event delivered to a BatchEntryListener.
+         *
+         * Unlike EntryEvent, the key and the values are kept in serialized form and they are deserialized only when
+         * they are first accessed. The member and the map name are shared by all the events of a batch, hence copying
+         * a LazyEntryEvent is cheap.
+         *
+         * A LazyEntryEvent is not thread-safe, it shall not be accessed concurrently from multiple threads.
+         *
+         * @param <K> key of the map entry
+         * @param <V> value of the map entry
+         * @see BatchEntryListener
+         */
+        template <typename K, typename V>
+        class LazyEntryEvent {
+        public:
+            /**
+             * Constructor
+             */
+            LazyEntryEvent(const boost::shared_ptr<const std::string> &name,
+                           const boost::shared_ptr<const Member> &member, EntryEventType eventType,
+                           const boost::shared_ptr<serialization::pimpl::Data> &keyData,
+                           const boost::shared_ptr<serialization::pimpl::Data> &valueData,
+                           const boost::shared_ptr<serialization::pimpl::Data> &oldValueData,
+                           const boost::shared_ptr<serialization::pimpl::Data> &mergingValueData,
+                           serialization::pimpl::SerializationService &serializationService)
+            : name(name)
+            , member(member)
+            , eventType(eventType)
+            , key(keyData, serializationService)
+            , value(valueData, serializationService)
+            , oldValue(oldValueData, serializationService)
+            , mergingValue(mergingValueData, serializationService) {
+            }
+
+            /**
+             * Returns the key of the entry event. The key is deserialized on the first call.
+             *
+             * @return the key, NULL if the event does not carry a key
+             */
+            const K *getKeyObject() const {
+                return key.get();
+            }
+
+            /**
+             * Returns the value of the entry event. The value is deserialized on the first call.
+             *
+             * @return the value, NULL if the event does not carry a value
+             */
+            const V *getValueObject() const {
+                return value.get();
+            }
+
+            /**
+             * Returns the old value of the entry event. The old value is deserialized on the first call.
+             *
+             * @return the old value, NULL if the event does not carry an old value
+             */
+            const V *getOldValueObject() const {
+                return oldValue.get();
+            }
+
+            /**
+             * Returns the merging value of the entry event. The merging value is deserialized on the first call.
+             *
+             * @return the merging value, NULL if the event does not carry a merging value
+             */
+            const V *getMergingValueObject() const {
+                return mergingValue.get();
+            }
+
+            /**
+             * Returns the serialized key of the entry event without deserializing it.
+             *
+             * @return the serialized key, NULL if the event does not carry a key
+             */
+            const serialization::pimpl::Data *getKeyData() const {
+                return key.getData();
+            }
+
+            /**
+             * @return the lazily deserialized key of the entry event, it can be kept after the event is processed.
+             */
+            const LazyValue<K> &getLazyKey() const {
+                return key;
+            }
+
+            /**
+             * Returns the serialized value of the entry event without deserializing it.
+             *
+             * @return the serialized value, NULL if the event does not carry a value
+             */
+            const serialization::pimpl::Data *getValueData() const {
+                return value.getData();
+            }
+
+            /**
+             * @return the lazily deserialized value of the entry event, it can be kept after the event is processed.
+             */
+            const LazyValue<V> &getLazyValue() const {
+                return value;
+            }
+
+            /**
+             * Returns the member fired this event.
+             *
+             * @return the member fired this event.
+             */
+            const Member &getMember() const {
+                return *member;
+            }
+
+            /**
+             * Return the event type
+             *
+             * @return event type
+             */
+            EntryEventType getEventType() const {
+                return eventType;
+            }
+
+            /**
+             * Returns the name of the map for this event.
+             *
+             * @return name of the map.
+             */
+            const std::string &getName() const {
+                return *name;
+            }
+
+        private:
+            boost::shared_ptr<const std::string> name;
+            boost::shared_ptr<const Member> member;
+            EntryEventType eventType;
+            LazyValue<K> key;
+            LazyValue<V> value;
+            LazyValue<V> oldValue;
+            LazyValue<V> mergingValue;
+        };
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_LAZYENTRYEVENT_H_
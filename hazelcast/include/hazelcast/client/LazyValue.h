@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef HAZELCAST_CLIENT_LAZYVALUE_H_
+#define HAZELCAST_CLIENT_LAZYVALUE_H_
+
+#include <memory>
+#include <boost/shared_ptr.hpp>
+
+#include "hazelcast/client/serialization/pimpl/Data.h"
+#include "hazelcast/client/serialization/pimpl/SerializationService.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/LockGuard.h"
+
+namespace hazelcast {
+    namespace client {
+        /**
+         * Handle to an object that is kept in serialized form and deserialized only when it is first accessed. The
+         * serialized form stays available, hence an object that is only passed along never needs to be deserialized.
+         *
+         * Copies of a LazyValue share the serialized form and the deserialized object, copying is cheap and the
+         * object is deserialized once for all the copies. A LazyValue and its copies can be accessed from multiple
+         * threads.
+         *
+         * @param <T> the type of the object
+         */
+        template <typename T>
+        class LazyValue {
+        public:
+            /**
+             * Constructor
+             *
+             * @param data the serialized object, NULL if there is no object
+             * @param serializationService the service that deserializes the object
+             */
+            LazyValue(const boost::shared_ptr<serialization::pimpl::Data> &data,
+                      serialization::pimpl::SerializationService &serializationService)
+            : state(new State(data, serializationService)) {
+            }
+
+            /**
+             * @return true if there is no object
+             */
+            bool isNull() const {
+                return NULL == state->data.get() || 0 == state->data->totalSize();
+            }
+
+            /**
+             * Returns the object. The object is deserialized on the first call.
+             *
+             * @return the object, NULL if there is no object
+             */
+            const T *get() const {
+                return getShared().get();
+            }
+
+            /**
+             * Returns the object as a shared pointer, the object is deserialized on the first call.
+             *
+             * @return the object, NULL in shared_ptr if there is no object
+             */
+            boost::shared_ptr<T> getShared() const {
+                if (isNull()) {
+                    return boost::shared_ptr<T>();
+                }
+
+                util::LockGuard guard(state->lock);
+                if (NULL == state->object.get()) {
+                    state->object = boost::shared_ptr<T>(state->serializationService->template toObject<T>(
+                            *state->data));
+                }
+                return state->object;
+            }
+
+            /**
+             * Returns the serialized object without deserializing it.
+             *
+             * @return the serialized object, NULL if there is no object
+             */
+            const serialization::pimpl::Data *getData() const {
+                return isNull() ? (const serialization::pimpl::Data *) NULL : state->data.get();
+            }
+
+        private:
+            /**
+             * Shared by the copies, the lock guards the deserialization of the object.
+             */
+            struct State {
+                State(const boost::shared_ptr<serialization::pimpl::Data> &data,
+                      serialization::pimpl::SerializationService &serializationService)
+                : data(data)
+                , serializationService(&serializationService) {
+                }
+
+                boost::shared_ptr<serialization::pimpl::Data> data;
+                serialization::pimpl::SerializationService *serializationService;
+                util::Mutex lock;
+                boost::shared_ptr<T> object;
+            };
+
+            boost::shared_ptr<State> state;
+        };
+    }
+}
+
+#endif //HAZELCAST_CLIENT_LAZYVALUE_H_
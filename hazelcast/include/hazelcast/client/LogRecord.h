@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_LOGRECORD_H_
+#define HAZELCAST_CLIENT_LOGRECORD_H_
+
+#include "hazelcast/util/HazelcastDll.h"
+
+#include <string>
+#include <sstream>
+#include <vector>
+#include <utility>
+#include <stdint.h>
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace util {
+        class ILogger;
+    }
+
+    namespace client {
+        enum LogLevel {
+            SEVERE = 100, WARNING = 90, INFO = 50, FINEST = 20
+        };
+
+        /**
+         * A log message together with its level, origin and named fields. The fields let a LogSink process the
+         * details of an event (e.g. a connection id or an address) without parsing the message.
+         */
+        class HAZELCAST_API LogRecord {
+        public:
+            typedef std::vector<std::pair<std::string, std::string> > Fields;
+
+            LogRecord();
+
+            LogRecord(LogLevel level, const std::string &message);
+
+            LogLevel getLevel() const;
+
+            const std::string &getMessage() const;
+
+            const Fields &getFields() const;
+
+            /**
+             * @return the time the record is logged in milliseconds since the epoch
+             */
+            int64_t getTimeMillis() const;
+
+            /**
+             * @return the id of the thread which logged the record
+             */
+            long getThreadId() const;
+
+            /**
+             * @return the prefix of the logger which identifies the client
+             */
+            const std::string &getPrefix() const;
+
+            LogRecord &addField(const std::string &name, const std::string &value);
+
+            template<typename T>
+            LogRecord &addField(const std::string &name, const T &value) {
+                std::ostringstream out;
+                out << value;
+                return addField(name, out.str());
+            }
+
+            /**
+             * Exchanges the contents of the records without copying the message and the fields.
+             */
+            void swap(LogRecord &other);
+
+        private:
+            friend class util::ILogger;
+
+            LogLevel level;
+            std::string message;
+            Fields fields;
+            int64_t timeMillis;
+            long threadId;
+            std::string prefix;
+        };
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_LOGRECORD_H_
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_LOGSINK_H_
+#define HAZELCAST_CLIENT_LOGSINK_H_
+
+#include "hazelcast/util/HazelcastDll.h"
+
+namespace hazelcast {
+    namespace client {
+        class LogRecord;
+
+        /**
+         * Destination of the log records of the client, see ClientConfig#setLogSink. The records are written by a
+         * background thread unless the asynchronous logging is disabled, and never by two threads at the same time.
+         * The records below the log level are dropped before they are formatted.
+         */
+        class HAZELCAST_API LogSink {
+        public:
+            virtual ~LogSink() {
+            }
+
+            virtual void write(const LogRecord &record) = 0;
+
+            /**
+             * Called after a batch of records is written.
+             */
+            virtual void flush() {
+            }
+        };
+    }
+}
+
+#endif //HAZELCAST_CLIENT_LOGSINK_H_
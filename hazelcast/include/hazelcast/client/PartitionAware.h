@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_PARTITIONAWARE_H_
+#define HAZELCAST_CLIENT_PARTITIONAWARE_H_
+
+#include "hazelcast/util/HazelcastDll.h"
+
+namespace hazelcast {
+    namespace client {
+        /**
+         * Non-templated base of PartitionAware. It is used by the serialization service to detect at compile time
+         * that an object provides its own partition key. Do not inherit from this class directly, use PartitionAware.
+         */
+        class HAZELCAST_API PartitionAwareMarker {
+        public:
+            virtual ~PartitionAwareMarker() {
+            }
+        };
+
+        /**
+         * PartitionAware means that data will be based in the same member based on the partition key
+         * and implementing tasks will be executed on the {@link #getPartitionKey()}'s owner member.
+         *
+         * This achieves data affinity. Data and execution occurs on the same partition.
+         *
+         * In Hazelcast, disparate data structures will be stored on the same partition,
+         * based on the partition key. For example, if "Steve" was used, then the following would be on one partition.
+         * <ul>
+         *     <li>a customers IMap with an entry of key "Steve"</li>
+         *     <li>an orders IMap using a customer key type implementing PartitionAware with key "Steve"</li>
+         *     <li>any queue named "Steve"</li>
+         *     <li>any PartitionAware object with partition key "Steve"</li>
+         * </ul>
+         *
+         * The partition hash of the key is calculated when the object is serialized and it is stored in the
+         * serialized data, hence routing the object to its partition does not require hashing the whole payload.
+         *
+         * @param P The type of the partition key. It should be serializable by the client.
+         */
+        template <typename P>
+        class PartitionAware : public PartitionAwareMarker {
+        public:
+            typedef P KEY_TYPE;
+
+            /**
+             * The key that will be used by Hazelcast to specify the partition.
+             * You should give the same key for objects that you want to be in the same partition.
+             *
+             * @return the partition key. If NULL is returned, the object itself is used for partitioning.
+             */
+            virtual const P *getPartitionKey() const = 0;
+
+            virtual ~PartitionAware() {
+            }
+        };
+    }
+}
+
+#endif //HAZELCAST_CLIENT_PARTITIONAWARE_H_
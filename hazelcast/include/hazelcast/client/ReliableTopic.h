@@ -22,6 +22,13 @@
 #include "hazelcast/client/Ringbuffer.h"
 #include "hazelcast/client/DataArray.h"
 #include "hazelcast/client/topic/impl/TopicEventHandlerImpl.h"
+#include "hazelcast/client/Future.h"
+#include "hazelcast/client/ringbuffer/ReadResultSet.h"
+#include "hazelcast/client/connection/CallCompletionListener.h"
+#include "hazelcast/client/topic/impl/reliable/ReliableTopicExecutor.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/ConditionVariable.h"
 
 #include <string>
 #include <memory>
@@ -48,18 +55,39 @@ namespace hazelcast {
         public:
 
             /**
-            * Publishes the message to all subscribers of this topic
-            * Current implementation only supports DISCARD_OLDEST policy as in Java client. The other policies will be
-            * available when async API is completed.  Using this policy the oldest item is overwritten no matter it is
-            * not old enough to retire.
+            * Publishes the message to all subscribers of this topic and waits until it is stored.
+            *
+            * If the ringbuffer of the topic has no place for the message, the TopicOverloadPolicy configured in the
+            * ReliableTopicConfig is applied: the oldest message is overwritten (DISCARD_OLDEST), the message is
+            * dropped (DISCARD_NEWEST), the call waits with an exponential backoff until there is place (BLOCK) or the
+            * call fails (FAIL).
             *
             * @param message The message to be published
+            * @throws TopicOverloadException if the topic is overloaded and the policy is FAIL
             */
             void publish(const E *message) {
                 serialization::pimpl::Data data = context->getSerializationService().toData<E>(message);
                 proxy::ReliableTopicImpl::publish(data);
             }
 
+            /**
+            * Publishes the message to all subscribers of this topic without waiting for it to be stored.
+            *
+            * The messages published in a burst are coalesced into batches of at most
+            * ReliableTopicConfig::getPublishBatchSize messages, each stored with a single call. The messages are
+            * stored in the order they are published. The TopicOverloadPolicy is applied to a batch as a whole, see
+            * publish(const E *).
+            *
+            * The call blocks only if many batches are already waiting to be stored.
+            *
+            * @param message The message to be published
+            * @return the future to wait for the message to be stored
+            */
+            topic::PublishFuture publishAsync(const E *message) {
+                serialization::pimpl::Data data = context->getSerializationService().toData<E>(message);
+                return proxy::ReliableTopicImpl::publishAsync(data);
+            }
+
             /**
             * Subscribes to this topic. When someone publishes a message on this topic.
             * onMessage() function of the given MessageListener is called. More than one message listener can be
@@ -73,16 +101,23 @@ namespace hazelcast {
             * Warning 3: Make sure that the MessageListener object is not destroyed until the removeListener is called,
             * since the library will use the MessageListener reference to deliver incoming messages.
             *
+            * The listener does not own a thread. The messages of all the listeners of the client are delivered by a
+            * shared thread pool whose size is set by ClientProperties::PROP_RELIABLE_TOPIC_EXECUTOR_POOL_SIZE, hence
+            * a listener which blocks delays the delivery to the other listeners.
+            *
             * @param listener the MessageListener to add.
             *
             * @return returns registration id.
             */
             std::string addMessageListener(topic::ReliableMessageListener<E> &listener) {
                 int id = ++runnerCounter;
-                boost::shared_ptr<MessageRunner<E> > runner(new MessageRunner<E>(id, &listener, ringbuffer.get(), getName(),
-                                                                          &context->getSerializationService(), config));
+                topic::impl::reliable::ReliableTopicExecutor &executor = context->getReliableTopicExecutor();
+                executor.start();
+                boost::shared_ptr<MessageRunner<E> > runner(new MessageRunner<E>(id, &listener, ringbuffer, getName(),
+                                                                          &context->getSerializationService(), config,
+                                                                          executor));
                 runnersMap.put(id, runner);
-                runner->next();
+                MessageRunner<E>::start(runner);
                 return util::IOUtil::to_string<int>(id);
             }
 
@@ -90,6 +125,9 @@ namespace hazelcast {
             * Stops receiving messages for the given message listener. If the given listener already removed,
             * this method does nothing.
             *
+            * When the method returns, the listener is not called anymore and it can be destroyed, unless the method
+            * is called from a listener. A listener may remove itself, the current message is its last one.
+            *
             * @param registrationId Id of listener registration.
             *
             * @return true if registration is removed, false otherwise
@@ -100,18 +138,18 @@ namespace hazelcast {
                 if (NULL == runner) {
                     return false;
                 }
-                runner->cancel();
                 runnersMap.remove(id);
+                runner->cancelAndWait();
                 return true;
             };
+
+            virtual ~ReliableTopic() {
+                // the pending reads of the runners outlive the proxy, they should not deliver any message from now on
+                cancelRunners();
+            }
         protected:
             virtual void onDestroy() {
-                // cancel all runners
-                std::vector<std::pair<int, boost::shared_ptr<MessageRunner<E> > > > runners = runnersMap.clear();
-                for (typename std::vector<std::pair<int, boost::shared_ptr<MessageRunner<E> > > >::const_iterator it = runners.begin();
-                        it != runners.end(); ++it) {
-                    it->second->cancel();
-                }
+                cancelRunners();
 
                 // destroy the underlying ringbuffer
                 ringbuffer->destroy();
@@ -121,15 +159,33 @@ namespace hazelcast {
                     : proxy::ReliableTopicImpl(instanceName, context, rb) {
             }
 
+            void cancelRunners() {
+                std::vector<std::pair<int, boost::shared_ptr<MessageRunner<E> > > > runners = runnersMap.clear();
+                for (typename std::vector<std::pair<int, boost::shared_ptr<MessageRunner<E> > > >::const_iterator it = runners.begin();
+                        it != runners.end(); ++it) {
+                    it->second->cancelAndWait();
+                }
+            }
+
+            /**
+             * Reads the ringbuffer of the topic and delivers the messages to a listener.
+             *
+             * The runner is scheduled on the shared ReliableTopicExecutor whenever a read completes, and the read of
+             * the next batch is sent before the current batch is delivered, so that the next batch is on its way while
+             * the listener is busy. At most one read is in flight and the batches of a runner are never processed
+             * concurrently, hence the messages are delivered in order.
+             */
             template <typename T>
             class MessageRunner : impl::ExecutionCallback<DataArray<topic::impl::reliable::ReliableTopicMessage> > {
             public:
                 MessageRunner(int id, topic::ReliableMessageListener<T> *listener,
-                              Ringbuffer<topic::impl::reliable::ReliableTopicMessage> *rb,
+                              boost::shared_ptr<Ringbuffer<topic::impl::reliable::ReliableTopicMessage> > rb,
                               const std::string &topicName, serialization::pimpl::SerializationService *service,
-                              const config::ReliableTopicConfig *reliableTopicConfig)
-                        : cancelled(false), logger(util::ILogger::getLogger()), name(topicName), executor(rb),
-                          serializationService(service), config(reliableTopicConfig) {
+                              const config::ReliableTopicConfig *reliableTopicConfig,
+                              topic::impl::reliable::ReliableTopicExecutor &executor)
+                        : cancelled(false), logger(util::ILogger::getLogger()), name(topicName), executor(executor),
+                          serializationService(service), readBatchSize(reliableTopicConfig->getReadBatchSize()),
+                          pendingCompletions(0), restartRequested(false), activeDeliveries(0) {
                     this->id = id;
                     this->listener = listener;
                     this->ringbuffer = rb;
@@ -140,24 +196,44 @@ namespace hazelcast {
                         initialSequence = ringbuffer->tailSequence() + 1;
                     }
                     this->sequence = initialSequence;
-
-                    this->executor.start();
                 }
 
 
                 virtual ~MessageRunner() { }
 
-                void next() {
-                    if (cancelled) {
-                        return;
+                /**
+                 * Sends the first read of the runner.
+                 */
+                static void start(const boost::shared_ptr<MessageRunner> &runner) {
+                    runner->readNext(runner, runner->sequence);
+                }
+
+                /**
+                 * Called when the read in flight completes. The runner is scheduled only if it is not already
+                 * processing a batch, otherwise the running task picks the completed read up when it is done.
+                 */
+                static void onReadCompleted(const boost::shared_ptr<MessageRunner> &runner) {
+                    if (++runner->pendingCompletions == 1) {
+                        runner->executor.execute(
+                                boost::shared_ptr<topic::impl::reliable::ReliableTopicExecutor::Task>(
+                                        new BatchTask(runner)));
                     }
+                }
 
-                    topic::impl::reliable::ReliableTopicExecutor::Message m;
-                    m.type = topic::impl::reliable::ReliableTopicExecutor::GET_ONE_MESSAGE;
-                    m.callback = this;
-                    m.sequence = sequence;
-                    m.maxCount = config->getReadBatchSize();
-                    executor.execute(m);
+                /**
+                 * Processes the completed reads, one batch per completion. Called from the executor only.
+                 */
+                static void processCompletedReads(const boost::shared_ptr<MessageRunner> &runner) {
+                    runner->beginDelivery();
+                    try {
+                        do {
+                            runner->processNextBatch(runner);
+                        } while (--runner->pendingCompletions != 0);
+                    } catch (...) {
+                        runner->endDelivery();
+                        throw;
+                    }
+                    runner->endDelivery();
                 }
 
                 // This method is called from the provided executor.
@@ -170,7 +246,7 @@ namespace hazelcast {
 
                     // we process all messages in batch. So we don't release the thread and reschedule ourselves;
                     // but we'll process whatever was received in 1 go.
-                    for (size_t i = 0; i < numMessages; ++i) {
+                    for (size_t i = 0; i < numMessages && !cancelled; ++i) {
                         try {
                             listener->storeSequence(sequence);
                             process(allMessages->get(i));
@@ -183,8 +259,6 @@ namespace hazelcast {
 
                         sequence++;
                     }
-
-                    next();
                 }
 
                 // This method is called from the provided executor.
@@ -207,7 +281,7 @@ namespace hazelcast {
                                 logger.finest(out.str());
                             }
                             sequence = remoteHeadSeq;
-                            next();
+                            restartRequested = true;
                             return;
                         }
 
@@ -239,11 +313,121 @@ namespace hazelcast {
                     cancel();
                 }
 
+                /**
+                 * Stops the delivery. A batch which is being delivered is not interrupted, but no message is delivered
+                 * after the current one.
+                 */
                 void cancel() {
                     cancelled = true;
-                    executor.stop();
+                }
+
+                /**
+                 * Stops the delivery and waits until the batch being delivered, if any, is done, so that the listener
+                 * is not called after this method returns. The wait is skipped on a pool thread, since the batch may
+                 * be delivered by the calling thread itself.
+                 */
+                void cancelAndWait() {
+                    cancel();
+                    if (executor.isPoolThread()) {
+                        return;
+                    }
+
+                    util::LockGuard guard(deliveryLock);
+                    while (activeDeliveries > 0) {
+                        deliveryDone.wait(deliveryLock);
+                    }
                 }
             private:
+                void beginDelivery() {
+                    util::LockGuard guard(deliveryLock);
+                    ++activeDeliveries;
+                }
+
+                void endDelivery() {
+                    util::LockGuard guard(deliveryLock);
+                    if (--activeDeliveries == 0) {
+                        deliveryDone.notify_all();
+                    }
+                }
+
+                class ReadCompletionListener : public connection::CallCompletionListener {
+                public:
+                    ReadCompletionListener(const boost::shared_ptr<MessageRunner> &runner) : runner(runner) {
+                    }
+
+                    virtual void onComplete() {
+                        MessageRunner::onReadCompleted(runner);
+                    }
+                private:
+                    boost::shared_ptr<MessageRunner> runner;
+                };
+
+                class BatchTask : public topic::impl::reliable::ReliableTopicExecutor::Task {
+                public:
+                    BatchTask(const boost::shared_ptr<MessageRunner> &runner) : runner(runner) {
+                    }
+
+                    virtual void run() {
+                        MessageRunner::processCompletedReads(runner);
+                    }
+                private:
+                    boost::shared_ptr<MessageRunner> runner;
+                };
+
+                void readNext(const boost::shared_ptr<MessageRunner> &runner, int64_t readSequence) {
+                    if (cancelled) {
+                        return;
+                    }
+
+                    try {
+                        pendingRead.reset(new Future<ringbuffer::ReadResultSet<topic::impl::reliable::ReliableTopicMessage> >(
+                                ringbuffer->readManyAsync(readSequence, 1, readBatchSize)));
+                    } catch (exception::IException &e) {
+                        std::ostringstream out;
+                        out << "Terminating MessageListener " << id << " on topic: " << name << ". "
+                            << " Reason: The read could not be sent, details:" << e.what();
+                        logger.warning(out.str());
+                        cancel();
+                        return;
+                    }
+
+                    // the listener may be notified right away in this thread if the read is already completed
+                    pendingRead->setCompletionListener(
+                            boost::shared_ptr<connection::CallCompletionListener>(new ReadCompletionListener(runner)));
+                }
+
+                void processNextBatch(const boost::shared_ptr<MessageRunner> &runner) {
+                    std::auto_ptr<Future<ringbuffer::ReadResultSet<topic::impl::reliable::ReliableTopicMessage> > > read =
+                            pendingRead;
+                    if (cancelled || NULL == read.get()) {
+                        return;
+                    }
+
+                    std::auto_ptr<ringbuffer::ReadResultSet<topic::impl::reliable::ReliableTopicMessage> > allMessages;
+                    try {
+                        allMessages = read->get();
+                    } catch (exception::ProtocolException &e) {
+                        onFailure(&e);
+                        if (restartRequested) {
+                            restartRequested = false;
+                            readNext(runner, sequence);
+                        }
+                        return;
+                    } catch (exception::IException &e) {
+                        std::ostringstream out;
+                        out << "Terminating MessageListener " << id << " on topic: " << name << ". "
+                            << " Reason: Unhandled exception, details:" << e.what();
+                        logger.warning(out.str());
+                        cancel();
+                        return;
+                    }
+
+                    // read ahead: the next batch is requested before this one is delivered
+                    readNext(runner, sequence + allMessages->getReadCount());
+
+                    onResponse(allMessages.get());
+                }
+
                 void process(const topic::impl::reliable::ReliableTopicMessage *message) {
                     //  proxy.localTopicStats.incrementReceives();
                     listener->onMessage(toMessage(message));
@@ -294,14 +478,21 @@ namespace hazelcast {
             private:
                 topic::ReliableMessageListener<T> *listener;
                 int id;
-                Ringbuffer<topic::impl::reliable::ReliableTopicMessage> *ringbuffer;
+                boost::shared_ptr<Ringbuffer<topic::impl::reliable::ReliableTopicMessage> > ringbuffer;
                 int64_t sequence;
                 util::AtomicBoolean cancelled;
                 util::ILogger &logger;
-                const std::string &name;
-                topic::impl::reliable::ReliableTopicExecutor executor;
+                const std::string name;
+                topic::impl::reliable::ReliableTopicExecutor &executor;
                 serialization::pimpl::SerializationService *serializationService;
-                const config::ReliableTopicConfig *config;
+                int32_t readBatchSize;
+                util::AtomicInt pendingCompletions;
+                bool restartRequested;
+                // the number of tasks in processCompletedReads, cancelAndWait waits until it drops to 0
+                int activeDeliveries;
+                util::Mutex deliveryLock;
+                util::ConditionVariable deliveryDone;
+                std::auto_ptr<Future<ringbuffer::ReadResultSet<topic::impl::reliable::ReliableTopicMessage> > > pendingRead;
             };
 
             util::SynchronizedMap<int, MessageRunner<E> > runnersMap;
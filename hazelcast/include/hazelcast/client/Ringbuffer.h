@@ -19,9 +19,14 @@
 #define HZELCAST_CLIENT_RINGBUFFER_H_
 
 #include <memory>
+#include <vector>
 #include <stdint.h>
 
 #include "hazelcast/client/IDistributedObject.h"
+#include "hazelcast/client/Future.h"
+#include "hazelcast/client/serialization/IdentifiedDataSerializable.h"
+#include "hazelcast/client/ringbuffer/OverflowPolicy.h"
+#include "hazelcast/client/ringbuffer/ReadResultSet.h"
 
 namespace hazelcast {
     namespace client {
@@ -61,6 +66,11 @@ namespace hazelcast {
         template<typename E>
         class Ringbuffer : public IDistributedObject {
         public:
+            /**
+             * The maximum number of items that can be added or read in a single batch.
+             */
+            static const int32_t MAX_BATCH_SIZE = 1000;
+
             virtual ~Ringbuffer() {
             }
 
@@ -166,7 +176,59 @@ namespace hazelcast {
              * @throws InterruptedException               if the call is interrupted while blocking.
              */
             virtual std::auto_ptr<E> readOne(int64_t sequence) = 0;
+
+            /**
+             * Adds all the items of a collection to the tail of the Ringbuffer.
+             *
+             * An addAll is likely to outperform multiple calls to add due to better io utilization and a reduced
+             * number of executed operations.
+             *
+             * If the batch is empty, an IllegalArgumentException is thrown.
+             *
+             * The result of the future contains the sequenceId of the last written item. If the overflow policy is
+             * FAIL and there is not enough capacity, the result is -1 and none of the items are added.
+             *
+             * @param items the batch of items to add, at most MAX_BATCH_SIZE items.
+             * @param overflowPolicy the overflowPolicy to use
+             * @return the future to synchronize on completion.
+             * @throws IllegalArgumentException if items is empty or larger than MAX_BATCH_SIZE.
+             */
+            virtual Future<int64_t> addAllAsync(const std::vector<E> &items,
+                                                ringbuffer::OverflowPolicy overflowPolicy) = 0;
+
+            /**
+             * Reads a batch of items from the Ringbuffer. If the number of available items after the first read
+             * item is smaller than the maxCount, these items are returned. So it could be the number of items read
+             * is smaller than the maxCount.
+             *
+             * If there are less items available than minCount, then this call blocks on the cluster until minCount
+             * items are available, the future completes only then.
+             *
+             * Reading a batch of items is likely to perform better because less overhead is involved.
+             *
+             * A filter can be provided to only select items that need to be read. The filter is an object which
+             * implements the com.hazelcast.core.IFunction&lt;E, Boolean&gt; interface on the server side, hence its
+             * implementation and its serialization factory should be registered on the members. If the filter is
+             * NULL, all items are read. If the filter is not NULL, only items where the filter function returns true
+             * are returned. Using filters is a good way to prevent getting items that are of no value to the
+             * receiver. This reduces the amount of IO and the number of operations being executed, and can result
+             * in a significant performance improvement.
+             *
+             * @param startSequence the startSequence of the first item to read.
+             * @param minCount the minimum number of items to read.
+             * @param maxCount the maximum number of items to read, at most MAX_BATCH_SIZE.
+             * @param filter the filter. Filter is allowed to be NULL, indicating there is no filter.
+             * @return a future containing the items read.
+             * @throws IllegalArgumentException if startSequence is smaller than 0, minCount is smaller than 0,
+             *                                  minCount larger than maxCount or maxCount larger than MAX_BATCH_SIZE.
+             */
+            virtual Future<ringbuffer::ReadResultSet<E> > readManyAsync(
+                    int64_t startSequence, int32_t minCount, int32_t maxCount,
+                    const serialization::IdentifiedDataSerializable *filter = NULL) = 0;
         };
+
+        template<typename E>
+        const int32_t Ringbuffer<E>::MAX_BATCH_SIZE;
     }
 }
 
@@ -95,7 +95,7 @@ namespace hazelcast {
              * @return number of bytes received.
              * @throw IOException in failure.
              */
-            int receive(void *buffer, int len, int flag = 0) const;
+            virtual int receive(void *buffer, int len, int flag = 0) const;
 
             /**
              * return socketId
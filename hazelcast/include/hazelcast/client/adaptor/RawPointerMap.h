@@ -587,18 +587,11 @@ namespace hazelcast {
                 std::auto_ptr<DataArray<K> > keySet(query::PagingPredicate<K, V> &predicate) {
                     predicate.setIterationType(query::KEY);
 
-                    std::vector<serialization::pimpl::Data> dataResult = map.keySetForPagingPredicateData(predicate);
-
-                    EntryVector entryResult;
-                    for (std::vector<serialization::pimpl::Data>::iterator it = dataResult.begin();it != dataResult.end(); ++it) {
-                        entryResult.push_back(std::pair<serialization::pimpl::Data, serialization::pimpl::Data>(*it, serialization::pimpl::Data()));
-                    }
+                    EntryVector entryResult = map.template pagingPredicateData<K, V>(predicate, query::KEY);
 
                     client::impl::EntryArrayImpl<K, V> entries(entryResult, serializationService);
 
-                    entries.sort(query::KEY, predicate.getComparator());
-
-                    std::pair<size_t, size_t> range = map.template updateAnchor<K, V>(entries, predicate, query::KEY);
+                    std::pair<size_t, size_t> range = map.template sortPage<K, V>(entries, predicate, query::KEY);
 
                     std::auto_ptr<EntryArray<K, V> > subList(new client::impl::EntryArrayImpl<K, V>(entries, range.first, range.second));
 
@@ -643,13 +636,11 @@ namespace hazelcast {
                 std::auto_ptr<DataArray<V> > values(query::PagingPredicate<K, V> &predicate) {
                     predicate.setIterationType(query::VALUE);
 
-                    EntryVector entryResult = map.valuesForPagingPredicateData(predicate);
+                    EntryVector entryResult = map.template pagingPredicateData<K, V>(predicate, query::VALUE);
 
                     client::impl::EntryArrayImpl<K, V> entries(entryResult, serializationService);
 
-                    entries.sort(query::VALUE, predicate.getComparator());
-
-                    std::pair<size_t, size_t> range = map.template updateAnchor<K, V>(entries, predicate, query::VALUE);
+                    std::pair<size_t, size_t> range = map.template sortPage<K, V>(entries, predicate, query::VALUE);
 
                     std::auto_ptr<EntryArray<K, V> > subList(new client::impl::EntryArrayImpl<K, V>(entries, range.first, range.second));
                     std::auto_ptr<DataArray<V> > result = std::auto_ptr<DataArray<V> >(new impl::EntryArrayValueAdaptor<K, V>(subList));
@@ -695,14 +686,11 @@ namespace hazelcast {
                 * @return result entry vector of the query
                 */
                 std::auto_ptr<EntryArray<K, V> > entrySet(query::PagingPredicate<K, V> &predicate) {
-                    std::vector<std::pair<serialization::pimpl::Data, serialization::pimpl::Data> > dataResult =
-                            map.entrySetForPagingPredicateData(predicate);
+                    EntryVector dataResult = map.template pagingPredicateData<K, V>(predicate, query::ENTRY);
 
                     client::impl::EntryArrayImpl<K, V> entries(dataResult, map.context->getSerializationService());
 
-                    entries.sort(query::ENTRY, predicate.getComparator());
-
-                    std::pair<size_t, size_t> range = map.template updateAnchor<K, V>(entries, predicate, query::ENTRY);
+                    std::pair<size_t, size_t> range = map.template sortPage<K, V>(entries, predicate, query::ENTRY);
 
                     return std::auto_ptr<EntryArray<K, V> >(new client::impl::EntryArrayImpl<K, V>(entries, range.first, range.second));
                 }
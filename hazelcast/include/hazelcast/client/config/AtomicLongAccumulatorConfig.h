@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_CONFIG_ATOMICLONGACCUMULATORCONFIG_H_
+#define HAZELCAST_CLIENT_CONFIG_ATOMICLONGACCUMULATORCONFIG_H_
+
+#include "hazelcast/util/HazelcastDll.h"
+
+#include <stdint.h>
+
+namespace hazelcast {
+    namespace client {
+        namespace config {
+            /**
+             * Configuration of an AtomicLongAccumulator, see IAtomicLong#newAccumulator.
+             */
+            class HAZELCAST_API AtomicLongAccumulatorConfig {
+            public:
+                static const int DEFAULT_FLUSH_INTERVAL_MILLIS;
+                static const int64_t DEFAULT_FLUSH_THRESHOLD;
+                static const int DEFAULT_STRIPE_COUNT;
+
+                AtomicLongAccumulatorConfig();
+
+                /**
+                 * Gets the maximum time in milliseconds a local delta waits before it is added to the IAtomicLong.
+                 *
+                 * @return the flush interval in milliseconds.
+                 */
+                int getFlushIntervalMillis() const;
+
+                /**
+                 * Sets the maximum time in milliseconds a local delta waits before it is added to the IAtomicLong. It
+                 * bounds how stale the value of the IAtomicLong is compared to the local additions.
+                 *
+                 * @param flushIntervalMillis the flush interval in milliseconds.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if flushIntervalMillis is smaller than 1.
+                 */
+                AtomicLongAccumulatorConfig &setFlushIntervalMillis(int flushIntervalMillis);
+
+                /**
+                 * Gets the absolute delta of a stripe which causes a flush before the interval ends.
+                 *
+                 * @return the flush threshold, 0 if disabled.
+                 */
+                int64_t getFlushThreshold() const;
+
+                /**
+                 * Sets the absolute delta of a stripe which causes a flush before the interval ends. It bounds how
+                 * much the value of the IAtomicLong may lag behind per stripe.
+                 *
+                 * @param flushThreshold the flush threshold, 0 to flush only by the interval.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if flushThreshold is negative.
+                 */
+                AtomicLongAccumulatorConfig &setFlushThreshold(int64_t flushThreshold);
+
+                /**
+                 * Gets the number of local cells the additions are spread over.
+                 *
+                 * @return the stripe count.
+                 */
+                int getStripeCount() const;
+
+                /**
+                 * Sets the number of local cells the additions are spread over. The threads add to the cell chosen by
+                 * their thread id, hence more stripes mean less contention among the adding threads.
+                 *
+                 * @param stripeCount the stripe count.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if stripeCount is smaller than 1.
+                 */
+                AtomicLongAccumulatorConfig &setStripeCount(int stripeCount);
+
+            private:
+                int flushIntervalMillis;
+                int64_t flushThreshold;
+                int stripeCount;
+            };
+        }
+    }
+}
+
+#endif /* HAZELCAST_CLIENT_CONFIG_ATOMICLONGACCUMULATORCONFIG_H_ */
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_CONFIG_BULKLOADERCONFIG_H_
+#define HAZELCAST_CLIENT_CONFIG_BULKLOADERCONFIG_H_
+
+#include "hazelcast/util/HazelcastDll.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            class BulkLoadListener;
+        }
+
+        namespace config {
+            /**
+             * Configuration of a map::BulkLoader, see IMap#newBulkLoader.
+             */
+            class HAZELCAST_API BulkLoaderConfig {
+            public:
+                static const int DEFAULT_BATCH_SIZE;
+                static const int DEFAULT_LINGER_MILLIS;
+                static const int DEFAULT_MAX_IN_FLIGHT_PER_MEMBER;
+
+                BulkLoaderConfig();
+
+                /**
+                 * Gets the maximum number of entries of a partition which are stored with a single call.
+                 *
+                 * @return the batch size.
+                 */
+                int getBatchSize() const;
+
+                /**
+                 * Sets the maximum number of entries of a partition which are stored with a single call. The entries
+                 * are buffered per partition, a batch is sent as soon as it is full.
+                 *
+                 * @param batchSize the maximum number of entries in a batch.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if batchSize is smaller than 1.
+                 */
+                BulkLoaderConfig &setBatchSize(int batchSize);
+
+                /**
+                 * Gets the maximum time in milliseconds an entry waits in a partition buffer for more entries.
+                 *
+                 * @return the linger time in milliseconds.
+                 */
+                int getLingerMillis() const;
+
+                /**
+                 * Sets the maximum time in milliseconds an entry waits in a partition buffer for more entries. A
+                 * partition buffer which is not full is sent once its oldest entry is older than the linger time.
+                 *
+                 * @param lingerMillis the linger time in milliseconds, 0 to send the partial batches only on
+                 *                     BulkLoader#flush and BulkLoader#close.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if lingerMillis is negative.
+                 */
+                BulkLoaderConfig &setLingerMillis(int lingerMillis);
+
+                /**
+                 * Gets the maximum number of batches which are being stored on a member at the same time.
+                 *
+                 * @return the maximum number of in flight batches per member.
+                 */
+                int getMaxInFlightPerMember() const;
+
+                /**
+                 * Sets the maximum number of batches which are being stored on a member at the same time. When the
+                 * limit is reached, the producer adding the entries is blocked until a batch on that member completes.
+                 *
+                 * @param maxInFlightPerMember the maximum number of in flight batches per member.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if maxInFlightPerMember is smaller than 1.
+                 */
+                BulkLoaderConfig &setMaxInFlightPerMember(int maxInFlightPerMember);
+
+                /**
+                 * @return the listener notified of each completed batch, NULL if none is set.
+                 */
+                map::BulkLoadListener *getListener() const;
+
+                /**
+                 * Sets the listener notified of each completed batch. The listener is notified from the io threads,
+                 * hence it should not block. It should live longer than the loader.
+                 *
+                 * @param listener the listener, NULL to remove the listener.
+                 * @return the updated config.
+                 */
+                BulkLoaderConfig &setListener(map::BulkLoadListener *listener);
+
+            private:
+                int batchSize;
+                int lingerMillis;
+                int maxInFlightPerMember;
+                map::BulkLoadListener *listener;
+            };
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif /* HAZELCAST_CLIENT_CONFIG_BULKLOADERCONFIG_H_ */
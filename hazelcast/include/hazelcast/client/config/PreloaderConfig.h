@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_CONFIG_PRELOADERCONFIG_H_
+#define HAZELCAST_CLIENT_CONFIG_PRELOADERCONFIG_H_
+
+#include <string>
+#include <stdint.h>
+
+#include "hazelcast/util/HazelcastDll.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace config {
+            /**
+             * Configuration of a map::Preloader, see IMap#newPreloader.
+             */
+            class HAZELCAST_API PreloaderConfig {
+            public:
+                static const std::string DEFAULT_DIRECTORY;
+                static const int DEFAULT_STORE_INTERVAL_SECONDS;
+                static const int DEFAULT_MAX_KEYS;
+                static const int DEFAULT_BATCH_SIZE;
+                static const int DEFAULT_MAX_IN_FLIGHT_BATCHES;
+                static const int64_t DEFAULT_MAX_BYTES_PER_SECOND;
+
+                PreloaderConfig();
+
+                /**
+                 * Gets the directory of the key snapshot files. The snapshot of a map is stored in the file named
+                 * after the map with the ".keys" extension.
+                 *
+                 * @return the snapshot directory.
+                 */
+                const std::string &getDirectory() const;
+
+                /**
+                 * Sets the directory of the key snapshot files. The directory should exist.
+                 *
+                 * @param directory the snapshot directory.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if directory is empty.
+                 */
+                PreloaderConfig &setDirectory(const std::string &directory);
+
+                /**
+                 * Gets the period in seconds of storing the hot keys of the map to the snapshot.
+                 *
+                 * @return the store interval in seconds.
+                 */
+                int getStoreIntervalSeconds() const;
+
+                /**
+                 * Sets the period in seconds of storing the hot keys of the map, as estimated by the hot key profiler
+                 * of the client, to the snapshot. The keys are not stored periodically if the profiler is disabled.
+                 *
+                 * The profiler tracks at most hazelcast_client_hot_key_top_k keys (20 by default) across all the maps,
+                 * so a single store adds only a few keys. The stored hot keys are followed by the keys which were
+                 * preloaded or stored before, up to the maximum number of keys, so the snapshot does not shrink to the
+                 * top K keys. Raise the top K of the profiler to capture more keys per store.
+                 *
+                 * @param storeIntervalSeconds the store interval in seconds, 0 to store the snapshot only on
+                 *                             Preloader#storeSnapshot and Preloader#storeHotKeySnapshot.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if storeIntervalSeconds is negative.
+                 */
+                PreloaderConfig &setStoreIntervalSeconds(int storeIntervalSeconds);
+
+                /**
+                 * Gets the maximum number of keys in a snapshot.
+                 *
+                 * @return the maximum number of keys.
+                 */
+                int getMaxKeys() const;
+
+                /**
+                 * Sets the maximum number of keys in a snapshot. The keys beyond the limit are neither stored nor
+                 * loaded.
+                 *
+                 * @param maxKeys the maximum number of keys.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if maxKeys is smaller than 1.
+                 */
+                PreloaderConfig &setMaxKeys(int maxKeys);
+
+                /**
+                 * Gets the maximum number of keys of a partition which are loaded with a single call.
+                 *
+                 * @return the batch size.
+                 */
+                int getBatchSize() const;
+
+                /**
+                 * Sets the maximum number of keys of a partition which are loaded with a single MapGetAll call.
+                 *
+                 * @param batchSize the maximum number of keys in a batch.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if batchSize is smaller than 1.
+                 */
+                PreloaderConfig &setBatchSize(int batchSize);
+
+                /**
+                 * Gets the maximum number of batches which are being loaded at the same time.
+                 *
+                 * @return the maximum number of in flight batches.
+                 */
+                int getMaxInFlightBatches() const;
+
+                /**
+                 * Sets the maximum number of batches which are being loaded at the same time.
+                 *
+                 * @param maxInFlightBatches the maximum number of in flight batches.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if maxInFlightBatches is smaller than 1.
+                 */
+                PreloaderConfig &setMaxInFlightBatches(int maxInFlightBatches);
+
+                /**
+                 * Gets the bandwidth budget of the preload in bytes per second.
+                 *
+                 * @return the maximum number of bytes per second, 0 if unlimited.
+                 */
+                int64_t getMaxBytesPerSecond() const;
+
+                /**
+                 * Sets the bandwidth budget of the preload. The requests and the responses of the batches are
+                 * counted, the next batch is delayed while the preload is above the budget.
+                 *
+                 * @param maxBytesPerSecond the maximum number of bytes per second, 0 for unlimited.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if maxBytesPerSecond is negative.
+                 */
+                PreloaderConfig &setMaxBytesPerSecond(int64_t maxBytesPerSecond);
+
+            private:
+                std::string directory;
+                int storeIntervalSeconds;
+                int maxKeys;
+                int batchSize;
+                int maxInFlightBatches;
+                int64_t maxBytesPerSecond;
+            };
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif /* HAZELCAST_CLIENT_CONFIG_PRELOADERCONFIG_H_ */
@@ -17,6 +17,7 @@
 #define HAZELCAST_CLIENT_CONFIG_RELIABLETOPICCONFIG_H_
 
 #include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/client/topic/TopicOverloadPolicy.h"
 #include <string>
 
 #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
@@ -30,6 +31,9 @@ namespace hazelcast {
             class HAZELCAST_API ReliableTopicConfig {
             public:
                 static const int DEFAULT_READ_BATCH_SIZE;
+                static const topic::TopicOverloadPolicy DEFAULT_TOPIC_OVERLOAD_POLICY;
+                static const int DEFAULT_PUBLISH_BATCH_SIZE;
+                static const int DEFAULT_PUBLISH_LINGER_MILLIS;
 
                 ReliableTopicConfig();
 
@@ -68,8 +72,70 @@ namespace hazelcast {
                  * @throws IllegalArgumentException if readBatchSize is smaller than 1.
                  */
                 ReliableTopicConfig &setReadBatchSize(int batchSize);
+
+                /**
+                 * Gets the TopicOverloadPolicy for this reliable topic.
+                 *
+                 * @return the TopicOverloadPolicy, DISCARD_OLDEST by default, so that a full ringbuffer overwrites
+                 *         its oldest message as publish always did.
+                 */
+                topic::TopicOverloadPolicy getTopicOverloadPolicy() const;
+
+                /**
+                 * Sets the TopicOverloadPolicy for this reliable topic. Check the TopicOverloadPolicy for more details
+                 * about this setting.
+                 *
+                 * @param topicOverloadPolicy the TopicOverloadPolicy.
+                 * @return the updated reliable topic config.
+                 */
+                ReliableTopicConfig &setTopicOverloadPolicy(topic::TopicOverloadPolicy topicOverloadPolicy);
+
+                /**
+                 * Gets the maximum number of messages which are stored to the ringbuffer in a single call.
+                 *
+                 * @return the publish batch size.
+                 */
+                int getPublishBatchSize() const;
+
+                /**
+                 * Sets the maximum number of messages which are stored to the ringbuffer in a single call.
+                 *
+                 * The messages published while a batch is being stored are collected into the next batch, hence a
+                 * burst of messages is stored with a few calls instead of a call per message. The overload policy is
+                 * applied to a batch as a whole.
+                 *
+                 * @param publishBatchSize the maximum number of messages in a batch, between 1 and
+                 *                         Ringbuffer::MAX_BATCH_SIZE.
+                 * @return the updated reliable topic config.
+                 * @throws IllegalArgumentException if publishBatchSize is out of range.
+                 */
+                ReliableTopicConfig &setPublishBatchSize(int publishBatchSize);
+
+                /**
+                 * Gets the maximum time in milliseconds a published message waits for more messages to fill its batch.
+                 *
+                 * @return the publish linger time in milliseconds.
+                 */
+                int getPublishLingerMillis() const;
+
+                /**
+                 * Sets the maximum time in milliseconds a message published by ReliableTopic#publishAsync waits for
+                 * more messages before its batch is stored. A full batch is stored right away. A higher value improves
+                 * the throughput of sparse publishers at the cost of latency.
+                 *
+                 * ReliableTopic#publish does not wait.
+                 *
+                 * @param publishLingerMillis the linger time in milliseconds, 0 to store the batches as soon as
+                 *                            possible.
+                 * @return the updated reliable topic config.
+                 * @throws IllegalArgumentException if publishLingerMillis is negative.
+                 */
+                ReliableTopicConfig &setPublishLingerMillis(int publishLingerMillis);
             private:
                 int readBatchSize;
+                topic::TopicOverloadPolicy topicOverloadPolicy;
+                int publishBatchSize;
+                int publishLingerMillis;
                 std::string name;
             };
         }
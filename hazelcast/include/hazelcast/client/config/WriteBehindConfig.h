@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_CONFIG_WRITEBEHINDCONFIG_H_
+#define HAZELCAST_CLIENT_CONFIG_WRITEBEHINDCONFIG_H_
+
+#include "hazelcast/util/HazelcastDll.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace config {
+            /**
+             * Configuration of a map::WriteBehindBuffer, see IMap#newWriteBehindBuffer.
+             */
+            class HAZELCAST_API WriteBehindConfig {
+            public:
+                /**
+                 * What a set does when the buffer is full.
+                 */
+                enum OverflowPolicy {
+                    /**
+                     * The buffered entries are sent right away and the set waits until there is room in the buffer.
+                     */
+                    BLOCK = 0,
+                    /**
+                     * The set throws HazelcastOverloadException.
+                     */
+                    FAIL = 1
+                };
+
+                static const int DEFAULT_COALESCING_WINDOW_MILLIS;
+                static const int DEFAULT_BATCH_SIZE;
+                static const int DEFAULT_MAX_BUFFERED_ENTRIES;
+
+                WriteBehindConfig();
+
+                /**
+                 * Gets the maximum time in milliseconds an update waits in the buffer.
+                 *
+                 * @return the coalescing window in milliseconds.
+                 */
+                int getCoalescingWindowMillis() const;
+
+                /**
+                 * Sets the maximum time in milliseconds an update waits in the buffer. The updates of the same key
+                 * within the window are coalesced, only the last value is sent.
+                 *
+                 * @param coalescingWindowMillis the window in milliseconds.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if coalescingWindowMillis is smaller than 1.
+                 */
+                WriteBehindConfig &setCoalescingWindowMillis(int coalescingWindowMillis);
+
+                /**
+                 * Gets the maximum number of entries of a partition which are sent with a single MapPutAll call.
+                 *
+                 * @return the batch size.
+                 */
+                int getBatchSize() const;
+
+                /**
+                 * Sets the maximum number of entries of a partition which are sent with a single MapPutAll call. The
+                 * entries of a partition are sent before the window ends once there are this many of them.
+                 *
+                 * @param batchSize the maximum number of entries in a batch.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if batchSize is smaller than 1.
+                 */
+                WriteBehindConfig &setBatchSize(int batchSize);
+
+                /**
+                 * Gets the maximum number of distinct keys waiting in the buffer.
+                 *
+                 * @return the buffer capacity.
+                 */
+                int getMaxBufferedEntries() const;
+
+                /**
+                 * Sets the maximum number of distinct keys waiting in the buffer. The updates of a buffered key are
+                 * always accepted, the new keys are handled by the overflow policy when the buffer is full.
+                 *
+                 * @param maxBufferedEntries the buffer capacity.
+                 * @return the updated config.
+                 * @throws IllegalArgumentException if maxBufferedEntries is smaller than 1.
+                 */
+                WriteBehindConfig &setMaxBufferedEntries(int maxBufferedEntries);
+
+                /**
+                 * @return the overflow policy, BLOCK by default.
+                 */
+                OverflowPolicy getOverflowPolicy() const;
+
+                /**
+                 * @param overflowPolicy what a set does when the buffer is full.
+                 * @return the updated config.
+                 */
+                WriteBehindConfig &setOverflowPolicy(OverflowPolicy overflowPolicy);
+
+            private:
+                int coalescingWindowMillis;
+                int batchSize;
+                int maxBufferedEntries;
+                OverflowPolicy overflowPolicy;
+            };
+        }
+    }
+}
+
+#endif /* HAZELCAST_CLIENT_CONFIG_WRITEBEHINDCONFIG_H_ */
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_CONNECTION_CALLCOMPLETIONLISTENER_H_
+#define HAZELCAST_CLIENT_CONNECTION_CALLCOMPLETIONLISTENER_H_
+
+#include "hazelcast/util/HazelcastDll.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace connection {
+            /**
+             * Notified once when a call completes, either with a response or with an exception. The result itself
+             * is collected from the CallFuture of the call, which does not block once the listener is notified.
+             *
+             * The listener is usually called from the io thread, hence it should only hand the work over to another
+             * thread.
+             */
+            class HAZELCAST_API CallCompletionListener {
+            public:
+                virtual ~CallCompletionListener() {
+                }
+
+                virtual void onComplete() = 0;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_CONNECTION_CALLCOMPLETIONLISTENER_H_
@@ -39,6 +39,8 @@ namespace hazelcast {
         namespace connection {
             class CallPromise;
 
+            class CallCompletionListener;
+
             class Connection;
 
             class CallFuture {
@@ -57,6 +59,11 @@ namespace hazelcast {
 
                 int64_t getCallId() const;
 
+                /**
+                 * Sets the listener to be notified when the call completes, see CallPromise#setCompletionListener.
+                 */
+                void setCompletionListener(boost::shared_ptr<CallCompletionListener> listener);
+
                 const Connection &getConnection() const;
             private:
                 boost::shared_ptr<CallPromise> promise;
@@ -22,8 +22,11 @@
 #include "hazelcast/util/HazelcastDll.h"
 #include "hazelcast/util/Future.h"
 #include "hazelcast/util/AtomicInt.h"
+#include "hazelcast/util/Mutex.h"
 
 #include <memory>
+#include <stdint.h>
+#include <boost/shared_ptr.hpp>
 
 namespace hazelcast {
     namespace client {
@@ -33,7 +36,14 @@ namespace hazelcast {
         namespace impl {
             class BaseEventHandler;
         };
+        namespace spi {
+            namespace impl {
+                class AdmissionController;
+            }
+        }
         namespace connection {
+            class CallCompletionListener;
+
             class CallPromise {
             public:
                 CallPromise();
@@ -56,12 +66,37 @@ namespace hazelcast {
 
                 int incrementAndGetResendCount();
 
+                /**
+                 * Sets the time the request is sent, in milliseconds
+                 */
+                void setSendTime(int64_t sendTimeMillis);
+
+                int64_t getSendTime() const;
+
                 void resetFuture();
+
+                /**
+                 * Sets the listener to be notified when the call completes. If the call is already completed, the
+                 * listener is notified immediately in the caller thread.
+                 */
+                void setCompletionListener(boost::shared_ptr<CallCompletionListener> listener);
+
+                /**
+                 * Sets the admission controller which admitted the call, the call is released when it completes.
+                 */
+                void setAdmissionController(spi::impl::AdmissionController *admissionController);
             private:
+                void notifyCompletion();
+
                 util::Future<std::auto_ptr<protocol::ClientMessage> > future;
                 std::auto_ptr<protocol::ClientMessage> request;
                 std::auto_ptr<impl::BaseEventHandler> eventHandler;
                 util::AtomicInt resendCount;
+                int64_t sendTime;
+                util::Mutex completionLock;
+                bool completed;
+                boost::shared_ptr<CallCompletionListener> completionListener;
+                spi::impl::AdmissionController *admissionController;
             };
         }
     }
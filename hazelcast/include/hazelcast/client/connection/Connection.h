@@ -23,6 +23,8 @@
 #include "hazelcast/client/connection/WriteHandler.h"
 #include "hazelcast/util/SynchronizedMap.h"
 #include "hazelcast/util/Atomic.h"
+#include "hazelcast/util/AtomicInt.h"
+#include "hazelcast/util/Mutex.h"
 #include "hazelcast/util/Closeable.h"
 #include "hazelcast/client/protocol/ClientMessageBuilder.h"
 #include "hazelcast/client/protocol/IMessageHandler.h"
@@ -89,6 +91,41 @@ namespace hazelcast {
 
                 void setConnectionId(int connectionId);
 
+                /**
+                 * Records that a call is sent over the connection and waits for its response
+                 */
+                void callStarted();
+
+                /**
+                 * Records that a call does not wait for its response any more
+                 */
+                void callEnded();
+
+                /**
+                 * Adds the response time of a call to the moving average of the response times
+                 */
+                void recordResponseTime(int64_t responseTimeMillis);
+
+                /**
+                 * @return number of calls waiting for their responses on this connection
+                 */
+                int getPendingCallCount();
+
+                /**
+                 * @return exponentially weighted moving average of the response times in milliseconds
+                 */
+                double getAverageResponseTime();
+
+                /**
+                 * @return number of messages waiting to be written to the socket
+                 */
+                size_t getWriteQueueSize();
+
+                /**
+                 * @return number of bytes waiting to be written to the socket
+                 */
+                int64_t getWriteQueueBytes();
+
                 util::Atomic<time_t> lastRead;
                 util::AtomicBoolean live;
             private:
@@ -107,6 +144,10 @@ namespace hazelcast {
                 std::auto_ptr<protocol::ClientMessage> responseMessage;
 
                 int connectionId;
+
+                util::AtomicInt pendingCallCount;
+                util::Mutex responseTimeLock;
+                double averageResponseTime;
             };
 
         }
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_CONNECTION_CONNECTIONGROUP_H_
+#define HAZELCAST_CLIENT_CONNECTION_CONNECTIONGROUP_H_
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/Mutex.h"
+
+#include <boost/shared_ptr.hpp>
+#include <vector>
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace connection {
+            class Connection;
+
+            /**
+            * The connections opened to a single member. Each member can be connected through a fixed number of
+            * connections (stripes), each with its own socket and write queue. An invocation is bound to a stripe so
+            * that all the invocations of a partition are written to the same connection in order.
+            */
+            class HAZELCAST_API ConnectionGroup {
+            public:
+                /**
+                * @param stripeCount number of connections that can be opened to the member
+                */
+                ConnectionGroup(int stripeCount);
+
+                int getStripeCount() const;
+
+                /**
+                * @return the connection of the stripe or NULL shared pointer if the stripe is not connected
+                */
+                boost::shared_ptr<Connection> get(int stripe);
+
+                /**
+                * @return the connection of the lowest connected stripe or NULL shared pointer if none is connected
+                */
+                boost::shared_ptr<Connection> getAny();
+
+                void set(int stripe, boost::shared_ptr<Connection> connection);
+
+                /**
+                * Removes the connection with the given socket from its stripe.
+                *
+                * @return the removed connection or NULL shared pointer if no stripe holds such a connection
+                */
+                boost::shared_ptr<Connection> remove(int socketId);
+
+                /**
+                * @return the connections of all the connected stripes
+                */
+                std::vector<boost::shared_ptr<Connection> > getConnections();
+
+            private:
+                util::Mutex lock;
+                std::vector<boost::shared_ptr<Connection> > stripes;
+            };
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_CONNECTION_CONNECTIONGROUP_H_
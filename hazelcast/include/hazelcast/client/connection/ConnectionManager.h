@@ -25,6 +25,7 @@
 #include "hazelcast/client/connection/OutSelector.h"
 #include "hazelcast/client/connection/OwnerConnectionFuture.h"
 #include "hazelcast/client/connection/HeartBeater.h"
+#include "hazelcast/client/connection/ConnectionGroup.h"
 #include "hazelcast/client/protocol/Principal.h"
 #include "hazelcast/util/Atomic.h"
 #include "hazelcast/util/Thread.h"
@@ -69,6 +70,15 @@ namespace hazelcast {
                 */
                 boost::shared_ptr<Connection> createOwnerConnection(const Address &address);
 
+                /**
+                * Authenticates the given connection as the new owner connection
+                *
+                * @param connection an open connection, see openConnection
+                * @return ownerConnection
+                * @throws Exception authentication failed
+                */
+                boost::shared_ptr<Connection> createOwnerConnection(std::auto_ptr<Connection> connection);
+
                 /**
                 * Gets a shared ptr to connection if available to given address
                 *
@@ -93,6 +103,19 @@ namespace hazelcast {
                 */
                 boost::shared_ptr<Connection> getOrConnect(const Address &resolvedAddress, int tryCount);
 
+                /**
+                * Tries to connect to an address in member list using the connection stripe of the partition. The
+                * invocations of a partition shall use this method so that they are written to the same connection.
+                *
+                * @param address hintAddress
+                * @param tryCount The number of times it shall try during connection establishment if not connected
+                * @param partitionId The partition of the invocation, any stripe is used if negative
+                * @return authenticated connection
+                * @throws Exception authentication failed or no connection found
+                */
+                boost::shared_ptr<Connection> getOrConnect(const Address &resolvedAddress, int tryCount,
+                                                           int partitionId);
+
                 /**
                 * Tries to connect to an address in member list.
                 *
@@ -144,11 +167,24 @@ namespace hazelcast {
                 std::auto_ptr<Connection> connectTo(const Address &address, bool ownerConnection);
 
                 /**
+                * Opens a connection without authenticating it.
+                *
                 * @param address
                 * @param ownerConnection
+                * @return Return the newly opened connection.
+                */
+                std::auto_ptr<Connection> openConnection(const Address &address, bool ownerConnection);
+
+                /**
+                * @return The connections of all the stripes to all the members
                 */
                 std::vector<boost::shared_ptr<Connection> > getConnections();
 
+                /**
+                * @return The connections of the connected stripes to the member at the address
+                */
+                std::vector<boost::shared_ptr<Connection> > getConnections(const Address &address);
+
                 /**
                 * Called heartbeat timeout is detected on a connection.
                 *
@@ -171,9 +207,23 @@ namespace hazelcast {
 
             private:
 
-                boost::shared_ptr<Connection> getOrConnectResolved(const Address &resolvedAddress);
+                boost::shared_ptr<Connection> getOrConnectResolved(const Address &resolvedAddress, int stripe);
+
+                boost::shared_ptr<Connection> getOrConnectStripe(const Address &resolvedAddress, int stripe);
+
+                /**
+                * Gets the group of the address, creates it if there is none. Called with connectionGroupsLock held.
+                */
+                boost::shared_ptr<ConnectionGroup> getConnectionGroup(const Address &address);
+
+                /**
+                * @return the connection of the stripe, NULL if the stripe is not connected
+                */
+                boost::shared_ptr<Connection> getStripeConnection(const Address &address, int stripe);
+
+                int getStripe(int partitionId);
 
-                boost::shared_ptr<Connection> getOrConnect(const Address &resolvedAddress);
+                size_t nextSelectorIndex();
 
                 boost::shared_ptr<Connection> getRandomConnection();
 
@@ -188,16 +238,20 @@ namespace hazelcast {
                 boost::shared_ptr<Connection> getOwnerConnection();
 
                 std::vector<byte> PROTOCOL;
-                util::SynchronizedMap<Address, Connection, addressComparator> connections;
+                util::SynchronizedMap<Address, ConnectionGroup, addressComparator> connectionGroups;
                 util::SynchronizedMap<int, Connection> socketConnections;
                 spi::ClientContext &clientContext;
                 SocketInterceptor *socketInterceptor;
-                InSelector inSelector;
-                OutSelector outSelector;
-                std::auto_ptr<util::Thread> inSelectorThread;
-                std::auto_ptr<util::Thread> outSelectorThread;
+                std::vector<boost::shared_ptr<InSelector> > inSelectors;
+                std::vector<boost::shared_ptr<OutSelector> > outSelectors;
+                std::vector<boost::shared_ptr<util::Thread> > selectorThreads;
+                int connectionsPerMember;
                 util::AtomicBoolean live;
                 util::Mutex lockMutex;
+                // the connections are added to and removed from the groups under this lock, so that a connection
+                // established while its member is removed is never left in a removed group, and a group whose
+                // connections are all closed is removed
+                util::Mutex connectionGroupsLock;
                 std::auto_ptr<protocol::Principal> principal;
 
                 connection::HeartBeater heartBeater;
@@ -208,6 +262,8 @@ namespace hazelcast {
 
                 util::Atomic<int64_t> callIdGenerator;
                 util::Atomic<int> connectionIdCounter;
+                util::Atomic<int> stripeCounter;
+                util::Atomic<int> selectorCounter;
             };
         }
     }
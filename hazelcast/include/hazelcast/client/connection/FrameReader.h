@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef HAZELCAST_CLIENT_CONNECTION_FRAMEREADER_H_
+#define HAZELCAST_CLIENT_CONNECTION_FRAMEREADER_H_
+
+#include <stddef.h>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/ByteBuffer.h"
+
+namespace hazelcast {
+    namespace client {
+        class Socket;
+
+        namespace protocol {
+            class ClientMessageBuilder;
+        }
+
+        namespace connection {
+            /**
+             * Reads the frames of a connection through a staging buffer and passes them to the message builder.
+             *
+             * Once the header of a large frame is processed, the rest of the frame is received directly into the
+             * frame buffer. The staging buffer grows when the reads fill it completely and shrinks back when the
+             * reads use only a small part of it for a while, so that each connection uses a buffer suited to its
+             * traffic.
+             */
+            class HAZELCAST_API FrameReader {
+            public:
+                static const size_t MAX_BUFFER_SIZE = 1 << 20;
+                static const int SHRINK_THRESHOLD = 64;
+
+                /**
+                 * @param bufferSize the initial size of the staging buffer, it should not be less than the message
+                 * header size
+                 */
+                FrameReader(protocol::ClientMessageBuilder &builder, size_t bufferSize);
+
+                ~FrameReader();
+
+                /**
+                 * Reads the available bytes from the socket and passes the completed frames to the builder.
+                 * @throw IOException if the socket read fails
+                 */
+                void readFrom(Socket &socket);
+
+                /**
+                 * @return the current size of the staging buffer
+                 */
+                size_t getBufferSize() const;
+
+            private:
+                FrameReader(const FrameReader &);
+
+                FrameReader &operator=(const FrameReader &);
+
+                void adaptBufferSize(size_t numBytesRead, bool isBufferFilled);
+
+                void resizeBuffer(size_t newSize);
+
+                protocol::ClientMessageBuilder &builder;
+                char *buffer;
+                size_t initialBufferSize;
+                size_t bufferSize;
+                int underusedReadCount;
+                util::ByteBuffer byteBuffer;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_CONNECTION_FRAMEREADER_H_
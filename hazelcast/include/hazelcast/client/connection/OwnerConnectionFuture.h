@@ -22,6 +22,7 @@
 
 #include "hazelcast/util/HazelcastDll.h"
 #include <boost/shared_ptr.hpp>
+#include <memory>
 
 #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
 #pragma warning(push)
@@ -49,6 +50,11 @@ namespace hazelcast {
 
                 boost::shared_ptr<Connection> createNew(const Address& address);
 
+                /**
+                 * Sets the given authenticated connection as the owner connection
+                 */
+                boost::shared_ptr<Connection> createNew(std::auto_ptr<Connection> connection);
+
                 void closeIfAddressMatches(const Address& address);
 
                 void close();
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_CONNECTION_PARALLELCONNECTOR_H_
+#define HAZELCAST_CLIENT_CONNECTION_PARALLELCONNECTOR_H_
+
+#include <deque>
+#include <vector>
+#include <string>
+#include <memory>
+#include <boost/shared_ptr.hpp>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/ConditionVariable.h"
+#include "hazelcast/util/Thread.h"
+#include "hazelcast/client/Address.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace connection {
+            class Connection;
+
+            class ConnectionManager;
+
+            /**
+             * Opens connections to a set of addresses in parallel, a thread per address, so that an unreachable
+             * address does not delay the connection to the reachable ones.
+             *
+             * The connections are handed out by next() in the order they are established, they are not
+             * authenticated. The connections which are not handed out are closed when the connector is cancelled,
+             * including the ones established after the cancellation.
+             *
+             * The destructor waits for the pending attempts, which are bounded by the connection timeout. Hence the
+             * connector should be kept until the next connection round rather than destroyed right after the first
+             * connection is taken.
+             */
+            class HAZELCAST_API ParallelConnector {
+            public:
+                ParallelConnector(ConnectionManager &connectionManager, const std::vector<Address> &addresses,
+                                  bool ownerConnection);
+
+                virtual ~ParallelConnector();
+
+                /**
+                 * Waits until one more connection is established or all the attempts are completed.
+                 *
+                 * @return the next established connection, NULL if all the attempts are completed and there is no
+                 *         connection left
+                 */
+                std::auto_ptr<Connection> next();
+
+                /**
+                 * Closes the established connections which are not taken yet, and the ones to be established.
+                 */
+                void cancel();
+
+                /**
+                 * @return the error of the last failed attempt, empty if no attempt failed
+                 */
+                std::string getLastError();
+
+            private:
+                static void staticConnect(util::ThreadArgs &args);
+
+                void connect(const Address &address);
+
+                ConnectionManager &connectionManager;
+                std::vector<Address> addresses;
+                bool ownerConnection;
+                util::Mutex lock;
+                util::ConditionVariable stateChanged;
+                std::deque<Connection *> established;
+                size_t pendingAttempts;
+                bool cancelled;
+                std::string lastError;
+                std::vector<boost::shared_ptr<util::Thread> > threads;
+            };
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_CONNECTION_PARALLELCONNECTOR_H_
@@ -20,8 +20,8 @@
 #ifndef HAZELCAST_ReadHandler
 #define HAZELCAST_ReadHandler
 
-#include "hazelcast/util/ByteBuffer.h"
 #include "hazelcast/client/connection/IOHandler.h"
+#include "hazelcast/client/connection/FrameReader.h"
 #include "hazelcast/client/protocol/ClientMessageBuilder.h"
 
 namespace hazelcast {
@@ -48,10 +48,8 @@ namespace hazelcast {
                 void run();
 
             private:
-                char* buffer;
-                util::ByteBuffer byteBuffer;
-
                 protocol::ClientMessageBuilder builder;
+                FrameReader reader;
             };
         }
     }
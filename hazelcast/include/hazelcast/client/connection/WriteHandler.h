@@ -25,6 +25,11 @@
 #include "hazelcast/util/ConcurrentQueue.h"
 #include "hazelcast/client/connection/IOHandler.h"
 #include "hazelcast/util/AtomicBoolean.h"
+#include "hazelcast/util/Atomic.h"
+
+#include <deque>
+#include <vector>
+#include <utility>
 
 #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
 #pragma warning(push)
@@ -47,7 +52,12 @@ namespace hazelcast {
 
             class WriteHandler : public IOHandler {
             public:
-                WriteHandler(Connection &connection, OutSelector &oListener, size_t bufferSize);
+                /**
+                 * @param maxFragmentSize messages with a payload larger than this value are written as fragments of at
+                 * most this payload size. Fragmentation is disabled if the value is not positive.
+                 */
+                WriteHandler(Connection &connection, OutSelector &oListener, size_t bufferSize,
+                             int32_t maxFragmentSize);
 
                 ~WriteHandler();
 
@@ -57,13 +67,66 @@ namespace hazelcast {
 
                 void run();
 
+                /**
+                 * @return number of messages waiting to be written
+                 */
+                size_t getQueueSize();
+
+                /**
+                 * @return number of bytes of the messages waiting to be written, including the parts of the
+                 * fragmented messages which are not written yet
+                 */
+                int64_t getQueuedBytes();
+
             private:
+                /**
+                 * Picks the next frame to be written. Whole messages and fragments of the large messages are picked
+                 * in turns, so that a large message can not block the messages queued after it.
+                 *
+                 * A message may overtake a large message only if both are for known and different partitions. The
+                 * first message which may not overtake the large messages in progress is held back, together with
+                 * everything queued after it, until they are written completely.
+                 *
+                 * @return true if there is a frame to be written, false otherwise
+                 */
+                bool pollNextFrame();
+
+                bool pollNextWholeMessage();
+
+                bool pollNextFragment();
+
+                void setLastMessage(protocol::ClientMessage *message, int32_t frameLen, int32_t releasedBytes);
+
+                /**
+                 * @return number of bytes of the current frame which are written to the socket
+                 */
+                int32_t writeLastMessage();
+
+                bool isFragmentationRequired(const protocol::ClientMessage &message) const;
+
+                bool mayOvertakeFragmentedMessages(const protocol::ClientMessage &message) const;
+
+                // large message to be fragmented and the offset of its first payload byte which is not written yet
+                typedef std::pair<protocol::ClientMessage *, int32_t> FragmentedMessage;
+
                 util::ConcurrentQueue<protocol::ClientMessage> writeQueue;
                 bool ready;
                 util::AtomicBoolean informSelector;
                 protocol::ClientMessage *lastMessage;
                 int32_t numBytesWrittenToSocketForMessage;
                 int32_t lastMessageFrameLen;
+                int32_t maxFragmentSize;
+                std::deque<FragmentedMessage> fragmentedMessages;
+                // the message polled from the queue which waits for the fragmented messages to be written
+                protocol::ClientMessage *heldMessage;
+                // the header of the fragment being written, its payload is written from the message buffer
+                std::vector<byte> fragmentHeader;
+                int32_t fragmentHeaderLen;
+                int32_t fragmentDataStart;
+                bool fragmentTurn;
+                util::Atomic<int64_t> queuedBytes;
+                // number of bytes which leave the queue when the last message is written completely
+                int32_t lastMessageReleasedBytes;
             };
         }
     }
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_COROUTINE_AWAITABLE_H_
+#define HAZELCAST_CLIENT_COROUTINE_AWAITABLE_H_
+
+/**
+ * co_await support for the asynchronous operations of the client. It needs a C++20 compiler, hence it is only
+ * compiled if HZ_USE_COROUTINES is defined, see the HZ_USE_COROUTINES cmake option. The rest of the client does not
+ * depend on it.
+ */
+#if defined(HZ_USE_COROUTINES)
+
+#if !defined(__cpp_impl_coroutine)
+#error "HZ_USE_COROUTINES needs a compiler with C++20 coroutine support"
+#endif
+
+#include "hazelcast/client/Future.h"
+#include "hazelcast/client/connection/CallCompletionListener.h"
+#include "hazelcast/client/exception/ProtocolExceptions.h"
+
+#include <atomic>
+#include <coroutine>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hazelcast {
+    namespace client {
+        namespace coroutine {
+            /**
+             * Resumes the coroutines awaiting the client operations. The completions are signalled by the io
+             * threads of the client, hence an implementation shall only hand the handle over to its own threads,
+             * e.g. to an event loop, and never resume it in the calling thread.
+             */
+            class Executor {
+            public:
+                virtual ~Executor() {
+                }
+
+                virtual void execute(std::coroutine_handle<> handle) = 0;
+            };
+
+            /**
+             * Cancels the awaits it is passed to. A cancelled await resumes the coroutine with a
+             * CancellationException. The operation itself is not aborted on the cluster, its response is ignored.
+             * The copies of a token share the same state.
+             */
+            class CancellationToken {
+            public:
+                CancellationToken() : state(std::make_shared<State>()) {
+                }
+
+                void cancel() {
+                    std::map<int64_t, std::function<void()> > callbacks;
+                    {
+                        std::lock_guard<std::mutex> guard(state->mutex);
+                        if (state->cancelled) {
+                            return;
+                        }
+                        state->cancelled = true;
+                        callbacks.swap(state->callbacks);
+                    }
+                    for (std::map<int64_t, std::function<void()> >::iterator it = callbacks.begin();
+                         it != callbacks.end(); ++it) {
+                        it->second();
+                    }
+                }
+
+                bool isCancelled() const {
+                    std::lock_guard<std::mutex> guard(state->mutex);
+                    return state->cancelled;
+                }
+
+                /**
+                 * Internal API. Registers the callback to be called on cancel.
+                 *
+                 * @return the id of the registration, 0 if the token is already cancelled and the callback is not
+                 * registered.
+                 */
+                int64_t registerCallback(std::function<void()> callback) {
+                    std::lock_guard<std::mutex> guard(state->mutex);
+                    if (state->cancelled) {
+                        return 0;
+                    }
+                    int64_t id = ++state->lastId;
+                    state->callbacks[id] = std::move(callback);
+                    return id;
+                }
+
+                /**
+                 * Internal API.
+                 */
+                void deregisterCallback(int64_t id) {
+                    std::lock_guard<std::mutex> guard(state->mutex);
+                    state->callbacks.erase(id);
+                }
+
+            private:
+                struct State {
+                    State() : cancelled(false), lastId(0) {
+                    }
+
+                    std::mutex mutex;
+                    bool cancelled;
+                    int64_t lastId;
+                    std::map<int64_t, std::function<void()> > callbacks;
+                };
+
+                std::shared_ptr<State> state;
+            };
+
+            /**
+             * The awaiter of a client Future, see awaitable. The coroutine is suspended without blocking a thread
+             * and resumed on the executor when the operation completes or the await is cancelled, whichever comes
+             * first. The result is deserialized on the executor thread.
+             */
+            template<typename V>
+            class FutureAwaiter {
+            public:
+                FutureAwaiter(const Future<V> &future, Executor &executor, const CancellationToken &token)
+                        : future(future), executor(&executor), token(token) {
+                }
+
+                bool await_ready() const {
+                    return token.isCancelled();
+                }
+
+                void await_suspend(std::coroutine_handle<> handle) {
+                    std::shared_ptr<ResumeState> resumeState = std::make_shared<ResumeState>(handle, *executor);
+                    state = resumeState;
+
+                    // the coroutine may be resumed, hence this awaiter destroyed, as soon as the first resumer is
+                    // installed. Only the locals are used from then on.
+                    Future<V> callFuture(future);
+                    CancellationToken cancellationToken(token);
+                    int64_t registration = cancellationToken.registerCallback([resumeState]() {
+                        resumeState->resume(true);
+                    });
+                    if (0 == registration) {
+                        resumeState->resume(true);
+                        return;
+                    }
+                    resumeState->setRegistration(registration);
+                    callFuture.setCompletionListener(boost::shared_ptr<connection::CallCompletionListener>(
+                            new CompletionListener(resumeState)));
+                }
+
+                std::unique_ptr<V> await_resume() {
+                    if (state.get() == NULL || state->isCancelled()) {
+                        throw exception::CancellationException("FutureAwaiter::await_resume",
+                                                               "The await of the operation is cancelled.");
+                    }
+                    token.deregisterCallback(state->getRegistration());
+                    return std::unique_ptr<V>(future.get().release());
+                }
+
+            private:
+                class ResumeState {
+                public:
+                    ResumeState(std::coroutine_handle<> handle, Executor &executor)
+                            : handle(handle), executor(executor), claimed(false), cancelled(false), registration(0) {
+                    }
+
+                    void resume(bool cancel) {
+                        if (claimed.exchange(true)) {
+                            return;
+                        }
+                        cancelled = cancel;
+                        executor.execute(handle);
+                    }
+
+                    bool isCancelled() const {
+                        return cancelled;
+                    }
+
+                    void setRegistration(int64_t id) {
+                        registration.store(id);
+                    }
+
+                    int64_t getRegistration() const {
+                        return registration.load();
+                    }
+
+                private:
+                    std::coroutine_handle<> handle;
+                    Executor &executor;
+                    std::atomic<bool> claimed;
+                    bool cancelled;
+                    std::atomic<int64_t> registration;
+                };
+
+                class CompletionListener : public connection::CallCompletionListener {
+                public:
+                    CompletionListener(const std::shared_ptr<ResumeState> &state) : state(state) {
+                    }
+
+                    virtual void onComplete() {
+                        state->resume(false);
+                    }
+
+                private:
+                    std::shared_ptr<ResumeState> state;
+                };
+
+                Future<V> future;
+                Executor *executor;
+                CancellationToken token;
+                std::shared_ptr<ResumeState> state;
+            };
+
+            /**
+             * Makes the future awaitable, e.g.
+             *
+             *     std::unique_ptr<V> value = co_await coroutine::awaitable(map.getAsync(key), executor);
+             *
+             * @param future the future of the operation
+             * @param executor resumes the coroutine, it shall outlive the await
+             * @param token cancels the await
+             * @throws CancellationException from co_await if the await is cancelled
+             * @throws IException from co_await, the exception thrown by the operation if it fails
+             */
+            template<typename V>
+            FutureAwaiter<V> awaitable(const Future<V> &future, Executor &executor,
+                                       const CancellationToken &token = CancellationToken()) {
+                return FutureAwaiter<V>(future, executor, token);
+            }
+        }
+    }
+}
+
+#endif // HZ_USE_COROUTINES
+
+#endif //HAZELCAST_CLIENT_COROUTINE_AWAITABLE_H_
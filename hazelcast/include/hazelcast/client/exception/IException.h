@@ -21,6 +21,7 @@
 
 #include "hazelcast/util/HazelcastDll.h"
 #include <string>
+#include <memory>
 #include <stdexcept>
 
 #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
@@ -73,6 +74,12 @@ namespace hazelcast {
                 const std::string &getMessage() const;
 
                 virtual void raise();
+
+                /**
+                 * @return a copy of the exception with its most derived type, so that it can be stored and raised
+                 * later, e.g. from another thread.
+                 */
+                virtual std::auto_ptr<IException> clone() const;
             private:
                 std::string src;
                 std::string msg;
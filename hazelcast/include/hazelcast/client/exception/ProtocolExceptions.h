@@ -48,6 +48,10 @@ namespace hazelcast {
                 int32_t getCauseErrorCode() const {
                     return causeErrorCode;
                 }
+
+                virtual std::auto_ptr<IException> clone() const {
+                    return std::auto_ptr<IException>(new ProtocolException(*this));
+                }
             private:
                 int32_t errorCode;
                 int32_t causeErrorCode;
@@ -67,6 +71,9 @@ namespace hazelcast {
                 virtual void raise() {\
                     throw *this;\
                 }\
+                virtual std::auto_ptr<IException> clone() const {\
+                    return std::auto_ptr<IException>(new ClassName(*this));\
+                }\
             }\
 
             DEFINE_PROTOCOL_EXCEPTION(ArrayIndexOutOfBoundsException);
@@ -169,6 +176,10 @@ namespace hazelcast {
                     return detailedErrorMessage;
                 }
 
+                virtual std::auto_ptr<IException> clone() const {
+                    return std::auto_ptr<IException>(new UndefinedErrorCodeException(*this));
+                }
+
             private:
                 int32_t error;
                 int64_t messageCallId;
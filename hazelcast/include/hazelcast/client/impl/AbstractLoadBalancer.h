@@ -25,6 +25,7 @@
 #include "hazelcast/util/Mutex.h"
 
 #include <vector>
+#include <boost/shared_ptr.hpp>
 
 #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
 #pragma warning(push)
@@ -43,6 +44,12 @@ namespace hazelcast {
 
                 std::vector<Member> getMembers();
 
+                /**
+                 * @return the current member list. The list is replaced, never modified, when the membership changes,
+                 * hence it can be read without copying it.
+                 */
+                boost::shared_ptr<const std::vector<Member> > getMembersSnapshot();
+
                 virtual void init(Cluster &cluster);
 
                 void memberAdded(const MembershipEvent &membershipEvent);
@@ -53,10 +60,12 @@ namespace hazelcast {
 
                 virtual ~AbstractLoadBalancer();
 
+            protected:
+                Cluster *cluster;
+
             private:
                 util::Mutex membersLock;
-                std::vector<Member> membersRef;
-                Cluster *cluster;
+                boost::shared_ptr<const std::vector<Member> > membersRef;
             };
         }
     }
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_IMPL_BATCHENTRYEVENTHANDLER_H_
+#define HAZELCAST_CLIENT_IMPL_BATCHENTRYEVENTHANDLER_H_
+
+#include <map>
+#include <vector>
+#include <string>
+#include <boost/shared_ptr.hpp>
+
+#include "hazelcast/client/LazyEntryEvent.h"
+#include "hazelcast/client/BatchEntryListener.h"
+#include "hazelcast/client/MapEvent.h"
+#include "hazelcast/client/impl/BaseEventHandler.h"
+#include "hazelcast/client/impl/BatchEventFlusher.h"
+#include "hazelcast/client/spi/ClusterService.h"
+#include "hazelcast/client/serialization/pimpl/SerializationService.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/Util.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace impl {
+            /**
+             * Accumulates the entry events of a map listener registration and delivers them to a BatchEntryListener
+             * when maxBatchSize events are pending or at most maxDelayMillis after the first pending event.
+             *
+             * Events are received from the io thread in order, hence a single pending batch keeps the per partition
+             * ordering of the events. A full batch is delivered by the io thread, and a batch whose deadline passes is
+             * delivered by the BatchEventFlusher shared by all the batch listeners of the client. The same lock guards
+             * the pending batch and the delivery, so that a batch flushed by the flusher thread can not overtake a
+             * batch flushed by the io thread.
+             */
+            template<typename K, typename V, typename BaseType>
+            class BatchEntryEventHandler : public BaseType, public BatchEventFlusher::Flushable {
+            public:
+                BatchEntryEventHandler(const std::string &instanceName, spi::ClusterService &clusterService,
+                                       serialization::pimpl::SerializationService &serializationService,
+                                       BatchEventFlusher &flusher, BatchEntryListener<K, V> &listener,
+                                       bool includeValue, int maxBatchSize, int maxDelayMillis)
+                : instanceName(new std::string(instanceName))
+                , clusterService(clusterService)
+                , serializationService(serializationService)
+                , flusher(flusher)
+                , listener(listener)
+                , includeValue(includeValue)
+                , maxBatchSize(maxBatchSize > 0 ? maxBatchSize : 1)
+                , maxDelayMillis(maxDelayMillis > 0 ? maxDelayMillis : 1) {
+                    pendingEvents.reserve((size_t) this->maxBatchSize);
+                }
+
+                virtual ~BatchEntryEventHandler() {
+                    flusher.cancel(*this);
+                    flush();
+                }
+
+                virtual void handleEntry(std::auto_ptr<serialization::pimpl::Data> key,
+                                         std::auto_ptr<serialization::pimpl::Data> value,
+                                         std::auto_ptr<serialization::pimpl::Data> oldValue,
+                                         std::auto_ptr<serialization::pimpl::Data> mergingValue,
+                                         const int32_t &eventType, const std::string &uuid,
+                                         const int32_t &numberOfAffectedEntries) {
+                    if (addEvent(key, value, oldValue, mergingValue, eventType, uuid, numberOfAffectedEntries)) {
+                        // scheduled without the lock, since the flusher thread takes the lock while flushing
+                        flusher.schedule(*this, util::currentTimeMillis() + maxDelayMillis);
+                    }
+                }
+
+                /**
+                 * Delivers the pending events to the listener, if there is any.
+                 */
+                virtual void flush() {
+                    util::LockGuard guard(lock);
+                    flushInternal();
+                }
+
+            private:
+                /**
+                 * @return true if the event is the first one of a new batch, hence the batch should be scheduled
+                 */
+                bool addEvent(std::auto_ptr<serialization::pimpl::Data> &key,
+                              std::auto_ptr<serialization::pimpl::Data> &value,
+                              std::auto_ptr<serialization::pimpl::Data> &oldValue,
+                              std::auto_ptr<serialization::pimpl::Data> &mergingValue,
+                              const int32_t &eventType, const std::string &uuid,
+                              const int32_t &numberOfAffectedEntries) {
+                    util::LockGuard guard(lock);
+                    if (eventType == EntryEventType::EVICT_ALL || eventType == EntryEventType::CLEAR_ALL) {
+                        flushInternal();
+                        MapEvent mapEvent(*getMember(uuid), (EntryEventType::Type) eventType, *instanceName,
+                                          numberOfAffectedEntries);
+                        if (eventType == EntryEventType::CLEAR_ALL) {
+                            listener.mapCleared(mapEvent);
+                        } else {
+                            listener.mapEvicted(mapEvent);
+                        }
+                        return false;
+                    }
+
+                    boost::shared_ptr<serialization::pimpl::Data> valueData;
+                    boost::shared_ptr<serialization::pimpl::Data> oldValueData;
+                    boost::shared_ptr<serialization::pimpl::Data> mergingValueData;
+                    if (includeValue) {
+                        valueData = boost::shared_ptr<serialization::pimpl::Data>(value);
+                        oldValueData = boost::shared_ptr<serialization::pimpl::Data>(oldValue);
+                        mergingValueData = boost::shared_ptr<serialization::pimpl::Data>(mergingValue);
+                    }
+                    pendingEvents.push_back(LazyEntryEvent<K, V>(instanceName, getMember(uuid),
+                                                                 (EntryEventType::Type) eventType,
+                                                                 boost::shared_ptr<serialization::pimpl::Data>(key),
+                                                                 valueData, oldValueData, mergingValueData,
+                                                                 serializationService));
+                    if (pendingEvents.size() >= (size_t) maxBatchSize) {
+                        flushInternal();
+                        return false;
+                    }
+                    return pendingEvents.size() == 1;
+                }
+
+                void flushInternal() {
+                    if (!pendingEvents.empty()) {
+                        std::vector<LazyEntryEvent<K, V> > events;
+                        events.reserve((size_t) maxBatchSize);
+                        events.swap(pendingEvents);
+                        members.clear();
+                        listener.entriesChanged(events);
+                    }
+                }
+
+                /**
+                 * The members are cached per batch, so that all the events of a batch from the same member share a
+                 * single Member instance.
+                 */
+                boost::shared_ptr<const Member> getMember(const std::string &uuid) {
+                    typename std::map<std::string, boost::shared_ptr<const Member> >::const_iterator it =
+                            members.find(uuid);
+                    if (it != members.end()) {
+                        return it->second;
+                    }
+                    boost::shared_ptr<const Member> member(clusterService.getMember(uuid));
+                    members[uuid] = member;
+                    return member;
+                }
+
+                boost::shared_ptr<const std::string> instanceName;
+                spi::ClusterService &clusterService;
+                serialization::pimpl::SerializationService &serializationService;
+                BatchEventFlusher &flusher;
+                BatchEntryListener<K, V> &listener;
+                bool includeValue;
+                int maxBatchSize;
+                int maxDelayMillis;
+                util::Mutex lock;
+                std::vector<LazyEntryEvent<K, V> > pendingEvents;
+                std::map<std::string, boost::shared_ptr<const Member> > members;
+            };
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_IMPL_BATCHENTRYEVENTHANDLER_H_
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef HAZELCAST_CLIENT_IMPL_BATCHEVENTFLUSHER_H_
+#define HAZELCAST_CLIENT_IMPL_BATCHEVENTFLUSHER_H_
+
+#include <map>
+#include <memory>
+#include <stdint.h>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/ConditionVariable.h"
+#include "hazelcast/util/Thread.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace impl {
+            /**
+             * Delivers the pending batches of all the batch listeners of a client when their deadlines pass. A single
+             * thread serves all the listeners. It is started with the first scheduled batch and sleeps until the
+             * earliest deadline.
+             */
+            class HAZELCAST_API BatchEventFlusher {
+            public:
+                class HAZELCAST_API Flushable {
+                public:
+                    virtual ~Flushable() {
+                    }
+
+                    /**
+                     * Delivers the pending events, if there is any.
+                     */
+                    virtual void flush() = 0;
+                };
+
+                BatchEventFlusher();
+
+                virtual ~BatchEventFlusher();
+
+                /**
+                 * Flushes the flushable at the deadline. If it is already scheduled, the earlier deadline is kept.
+                 *
+                 * @param deadline the time in milliseconds
+                 */
+                void schedule(Flushable &flushable, int64_t deadline);
+
+                /**
+                 * Removes the flushable from the schedule. If it is being flushed, waits until the flush is done,
+                 * so that the flushable can be destroyed after this call returns.
+                 */
+                void cancel(Flushable &flushable);
+
+                /**
+                 * Stops the thread. The scheduled batches are not flushed after this call.
+                 */
+                void shutdown();
+
+            private:
+                BatchEventFlusher(const BatchEventFlusher &);
+
+                BatchEventFlusher &operator=(const BatchEventFlusher &);
+
+                static void staticRunFlusher(util::ThreadArgs &args);
+
+                void runFlusher();
+
+                util::Mutex lock;
+                util::ConditionVariable condition;
+                std::map<Flushable *, int64_t> deadlines;
+                Flushable *flushing;
+                bool live;
+                std::auto_ptr<util::Thread> flushThread;
+            };
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_IMPL_BATCHEVENTFLUSHER_H_
@@ -20,9 +20,11 @@
 #define HAZELCAST_CLIENT_IMPL_DATAARRAYIMPL_H_
 
 #include <vector>
+#include <boost/shared_ptr.hpp>
 
 #include "hazelcast/util/Util.h"
 #include "hazelcast/client/exception/IllegalArgumentException.h"
+#include "hazelcast/client/exception/IException.h"
 #include "hazelcast/util/Comparator.h"
 #include "hazelcast/client/DataArray.h"
 #include "hazelcast/client/serialization/pimpl/SerializationService.h"
@@ -93,12 +95,28 @@ namespace hazelcast {
                     return get(index);
                 }
 
+                /**
+                 * Internal API. Deserializes and caches the item at the given index. The items at different indexes
+                 * can be deserialized by different threads at the same time.
+                 */
+                void deserialize(size_t index) {
+                    deserializedEntries[index].get();
+                }
+
+                /**
+                 * Internal API. Stores the error of a failed deserialize call, it is thrown when the item is accessed.
+                 */
+                void setDeserializationError(size_t index, const boost::shared_ptr<exception::IException> &error) {
+                    deserializedEntries[index].error = error;
+                }
+
             private:
                 struct Item {
                     const serialization::pimpl::Data *data;
                     bool isDeserialized;
                     T *value;
                     serialization::pimpl::SerializationService *serializationService;
+                    boost::shared_ptr<exception::IException> error;
 
                     ~Item() {
                         if (isDeserialized) {
@@ -110,6 +128,9 @@ namespace hazelcast {
                         if (isDeserialized) {
                             return value;
                         }
+                        if (NULL != error.get()) {
+                            error->raise();
+                        }
 
                         value = serializationService->toObject<T>(*data).release();
                         isDeserialized = true;
@@ -123,6 +144,9 @@ namespace hazelcast {
                             value = NULL;
                             return result;
                         }
+                        if (NULL != error.get()) {
+                            error->raise();
+                        }
 
                         return serializationService->toObject<T>(*data);
                     }
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_IMPL_DESERIALIZATIONEXECUTOR_H_
+#define HAZELCAST_CLIENT_IMPL_DESERIALIZATIONEXECUTOR_H_
+
+#include <vector>
+#include <exception>
+#include <stdint.h>
+#include <boost/shared_ptr.hpp>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/BlockingConcurrentQueue.h"
+#include "hazelcast/util/ConditionVariable.h"
+#include "hazelcast/util/Thread.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/AtomicBoolean.h"
+#include "hazelcast/client/exception/IException.h"
+#include "hazelcast/client/exception/ProtocolExceptions.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace impl {
+            /**
+             * The thread pool which deserializes the large query and bulk results of a client in parallel.
+             *
+             * A result is split into chunks of chunkSize items. The chunks are deserialized by the pool threads and
+             * by the calling thread together, and the call returns when all of them are completed. The results with
+             * at most chunkSize items, and all the results if the pool size is 0, are left to be deserialized lazily
+             * on access.
+             */
+            class HAZELCAST_API DeserializationExecutor {
+            public:
+                class Task {
+                public:
+                    virtual ~Task() {
+                    }
+
+                    virtual void run() = 0;
+                };
+
+                DeserializationExecutor(int32_t poolSize, int32_t chunkSize);
+
+                virtual ~DeserializationExecutor();
+
+                /**
+                 * Stops the pool threads. The later results are deserialized lazily.
+                 */
+                void shutdown();
+
+                /**
+                 * Deserializes the items of the array in parallel if the array is large enough. The error of an item
+                 * which fails to deserialize is stored in the array and thrown when the item is accessed. An error
+                 * which is not an IException is stored as a HazelcastSerializationException.
+                 *
+                 * @param array a DataArrayImpl or an EntryArrayImpl
+                 */
+                template<typename Array>
+                void deserializeAll(Array &array) {
+                    size_t size = array.size();
+                    if (!isParallel(size)) {
+                        return;
+                    }
+
+                    std::vector<boost::shared_ptr<Task> > tasks;
+                    for (size_t begin = 0; begin < size; begin += chunkSize) {
+                        size_t end = begin + chunkSize < size ? begin + chunkSize : size;
+                        tasks.push_back(boost::shared_ptr<Task>(new DeserializeTask<Array>(array, begin, end)));
+                    }
+                    invokeAll(tasks);
+                }
+
+                /**
+                 * Runs the tasks on the pool threads and the calling thread, returns when all of them are completed,
+                 * even if some of them throw.
+                 */
+                void invokeAll(const std::vector<boost::shared_ptr<Task> > &tasks);
+
+            private:
+                template<typename Array>
+                class DeserializeTask : public Task {
+                public:
+                    DeserializeTask(Array &array, size_t begin, size_t end) : array(array), begin(begin), end(end) {
+                    }
+
+                    virtual void run() {
+                        for (size_t i = begin; i < end; ++i) {
+                            // the error is stored in the item, the caller gets it when it accesses the item
+                            try {
+                                array.deserialize(i);
+                            } catch (exception::IException &e) {
+                                array.setDeserializationError(i, boost::shared_ptr<exception::IException>(
+                                        e.clone().release()));
+                            } catch (std::exception &e) {
+                                array.setDeserializationError(i, boost::shared_ptr<exception::IException>(
+                                        new exception::HazelcastSerializationException("DeserializeTask::run",
+                                                                                       e.what())));
+                            } catch (...) {
+                                array.setDeserializationError(i, boost::shared_ptr<exception::IException>(
+                                        new exception::HazelcastSerializationException("DeserializeTask::run",
+                                                                                       "Unknown error")));
+                            }
+                        }
+                    }
+
+                private:
+                    Array &array;
+                    size_t begin;
+                    size_t end;
+                };
+
+                /**
+                 * The tasks of an invokeAll call. Each thread joining the batch claims the next task until none is
+                 * left, hence the tasks are balanced among the threads.
+                 */
+                class Batch {
+                public:
+                    Batch(const std::vector<boost::shared_ptr<Task> > &tasks);
+
+                    void runTasks();
+
+                    void awaitCompletion();
+
+                private:
+                    std::vector<boost::shared_ptr<Task> > tasks;
+                    size_t nextTask;
+                    size_t remainingTasks;
+                    util::Mutex lock;
+                    util::ConditionVariable completed;
+                };
+
+                static void executorRun(util::ThreadArgs &args);
+
+                bool isParallel(size_t itemCount);
+
+                void start();
+
+                int32_t poolSize;
+                size_t chunkSize;
+                util::Mutex startLock;
+                std::vector<boost::shared_ptr<util::Thread> > threads;
+                util::BlockingConcurrentQueue<boost::shared_ptr<Batch> > q;
+                util::AtomicBoolean live;
+            };
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_IMPL_DESERIALIZATIONEXECUTOR_H_
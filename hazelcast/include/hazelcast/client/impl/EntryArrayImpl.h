@@ -20,9 +20,12 @@
 #define HAZELCAST_CLIENT_IMPL_ENTRYARRAYIMPL_H_
 
 #include <vector>
+#include <algorithm>
+#include <boost/shared_ptr.hpp>
 
 #include "hazelcast/util/Util.h"
 #include "hazelcast/client/exception/IllegalArgumentException.h"
+#include "hazelcast/client/exception/IException.h"
 #include "hazelcast/util/Comparator.h"
 #include "hazelcast/client/query/PagingPredicate.h"
 #include "hazelcast/client/EntryArray.h"
@@ -65,18 +68,18 @@ namespace hazelcast {
                         throw exception::IllegalArgumentException("EntryArrayImpl", "end should not be greater than array size!");
                     }
 
-                    // make sure that items are deserialized
-                    for (size_t i = 0; i < size; ++i) {
-                        array[i];
-                    }
-
+                    // reserve so that the items can point to the data entries of this array
+                    dataEntries.reserve(end - begin);
                     for (size_t i = begin; i < end; ++i) {
                         Item &item = array.deserializedEntries[i];
                         dataEntries.push_back(*item.data);
                         deserializedEntries.push_back(item);
+                        deserializedEntries.back().data = &dataEntries.back();
                         // invalidate the entry at the original array
                         item.isValueDeserialized = false;
                         item.isKeyDeserialized = false;
+                        item.key = NULL;
+                        item.value = NULL;
                     }
                 }
 
@@ -159,16 +162,48 @@ namespace hazelcast {
                  * Sorts the entries
                  */
                 void sort(query::IterationType iterationType, const util::Comparator<std::pair<const K *, const V *> > *comparator) {
-                    // make sure that all entries are deserialized, we do this since the std::sort requires that we use
-                    // const methods when writing the < operator
-                    for (typename std::vector<Item>::iterator it = deserializedEntries.begin();it != deserializedEntries.end(); ++it) {
-                        it->getKey();
-                        it->getValue();
-                        it->comparator = comparator;
-                        it->type = iterationType;
-                    }
+                    prepareForSort(iterationType, comparator);
                     std::sort(deserializedEntries.begin(), deserializedEntries.end());
                 }
+
+                /**
+                 * Internal API. Puts the smallest sortedCount entries in order at the beginning of the array, the order
+                 * of the remaining entries is unspecified. Only the sides of the entries that the ordering needs are
+                 * deserialized, the other sides are deserialized on access.
+                 */
+                void partialSort(query::IterationType iterationType,
+                                 const util::Comparator<std::pair<const K *, const V *> > *comparator, size_t sortedCount) {
+                    if (sortedCount > deserializedEntries.size()) {
+                        sortedCount = deserializedEntries.size();
+                    }
+                    prepareForSort(iterationType, comparator);
+                    std::partial_sort(deserializedEntries.begin(), deserializedEntries.begin() + sortedCount,
+                                      deserializedEntries.end());
+                }
+
+                /**
+                 * Internal API. Deserializes and caches the key and the value at the given index. The entries at
+                 * different indexes can be deserialized by different threads at the same time.
+                 */
+                void deserialize(size_t index) {
+                    Item &item = deserializedEntries[index];
+                    item.getKey();
+                    item.getValue();
+                }
+
+                /**
+                 * Internal API. Stores the error of a failed deserialize call, it is thrown when the key, or the value
+                 * if the key is already deserialized, is accessed.
+                 */
+                void setDeserializationError(size_t index, const boost::shared_ptr<exception::IException> &error) {
+                    Item &item = deserializedEntries[index];
+                    if (item.isKeyDeserialized) {
+                        item.valueError = error;
+                    } else {
+                        item.keyError = error;
+                    }
+                }
+
             private:
                 struct Item {
                     const std::pair<serialization::pimpl::Data, serialization::pimpl::Data> *data;
@@ -179,11 +214,16 @@ namespace hazelcast {
                     serialization::pimpl::SerializationService *serializationService;
                     const util::Comparator<std::pair<const K *, const V *> > *comparator;
                     query::IterationType type;
+                    boost::shared_ptr<exception::IException> keyError;
+                    boost::shared_ptr<exception::IException> valueError;
 
                     const K *getKey() {
                         if (isKeyDeserialized) {
                             return key;
                         }
+                        if (NULL != keyError.get()) {
+                            keyError->raise();
+                        }
 
                         key = serializationService->toObject<K>(data->first).release();
                         isKeyDeserialized = true;
@@ -197,6 +237,9 @@ namespace hazelcast {
                             key = NULL;
                             return result;
                         }
+                        if (NULL != keyError.get()) {
+                            keyError->raise();
+                        }
 
                         return serializationService->toObject<K>(data->first);
                     }
@@ -205,6 +248,9 @@ namespace hazelcast {
                         if (isValueDeserialized) {
                             return value;
                         }
+                        if (NULL != valueError.get()) {
+                            valueError->raise();
+                        }
 
                         value = serializationService->toObject<V>(data->second).release();
                         isValueDeserialized = true;
@@ -218,6 +264,9 @@ namespace hazelcast {
                             value = NULL;
                             return result;
                         }
+                        if (NULL != valueError.get()) {
+                            valueError->raise();
+                        }
 
                         return serializationService->toObject<V>(data->second);
                     }
@@ -251,6 +300,26 @@ namespace hazelcast {
                 serialization::pimpl::SerializationService &serializationService;
                 std::vector<Item> deserializedEntries;
 
+                /**
+                 * std::sort requires that we use const methods when writing the < operator, hence the sides that the
+                 * comparison uses are deserialized beforehand. The comparator falls back to the key on ties.
+                 */
+                void prepareForSort(query::IterationType iterationType,
+                                    const util::Comparator<std::pair<const K *, const V *> > *comparator) {
+                    bool needsKey = NULL != comparator || query::VALUE != iterationType;
+                    bool needsValue = NULL != comparator || query::VALUE == iterationType;
+                    for (typename std::vector<Item>::iterator it = deserializedEntries.begin();it != deserializedEntries.end(); ++it) {
+                        if (needsKey) {
+                            it->getKey();
+                        }
+                        if (needsValue) {
+                            it->getValue();
+                        }
+                        it->comparator = comparator;
+                        it->type = iterationType;
+                    }
+                }
+
                 /**
                  *  @throws IllegalArgumentException If provided index is greater than the maximum array index.
                  */
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_IMPL_HOTKEYPROFILER_H_
+#define HAZELCAST_CLIENT_IMPL_HOTKEYPROFILER_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdint.h>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/AtomicBoolean.h"
+#include "hazelcast/util/Thread.h"
+#include "hazelcast/client/HotKeyStats.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace serialization {
+            namespace pimpl {
+                class Data;
+            }
+        }
+
+        namespace spi {
+            class PartitionService;
+        }
+
+        namespace impl {
+            /**
+             * Samples the key based proxy operations to find the most accessed keys, partitions and members.
+             *
+             * One of every sampleRate operations is sampled. A sampled key is counted in a count-min sketch, and the
+             * topK keys with the highest estimates are kept as candidates, ordered by their estimates so that the
+             * coldest one is evicted first. The memory used is bounded by the sketch and the candidates, however many
+             * distinct keys are accessed.
+             *
+             * An operation which is not sampled only decrements a countdown. The countdowns are striped by the thread id,
+             * like the cells of AtomicLongAccumulator, so the threads do not contend on a single lock. Only a sampled
+             * operation takes the lock of the sketch.
+             *
+             * All the counts are halved every dump interval, or every DEFAULT_DECAY_INTERVAL_SECONDS if the logging is
+             * disabled. Hence the statistics follow the recent load, and a key which was hot a while ago drops out.
+             */
+            class HAZELCAST_API HotKeyProfiler {
+            public:
+                /**
+                 * @param sampleRate one of every this many operations is sampled, 0 disables the profiler
+                 * @param topK the number of the most accessed keys to track
+                 * @param dumpIntervalSeconds the period of logging and halving the statistics, 0 disables the logging
+                 * @param partitionService resolves the partition owners of the sampled operations
+                 */
+                HotKeyProfiler(int32_t sampleRate, int32_t topK, int32_t dumpIntervalSeconds,
+                               spi::PartitionService &partitionService);
+
+                virtual ~HotKeyProfiler();
+
+                bool isEnabled() const {
+                    return sampleRate > 0;
+                }
+
+                /**
+                 * Counts an operation on the key, if the operation is sampled.
+                 *
+                 * @param objectName the name of the distributed object
+                 * @param key the serialized key
+                 * @param partitionId the partition of the key
+                 */
+                void record(const std::string &objectName, const serialization::pimpl::Data &key, int partitionId);
+
+                HotKeyStats getStats();
+
+                /**
+                 * Stops the periodic logging and halving.
+                 */
+                void shutdown();
+
+            private:
+                static const int SKETCH_DEPTH = 4;
+                static const int SKETCH_WIDTH = 2048;
+                static const int SAMPLE_STRIPE_COUNT = 16;
+                static const int DEFAULT_DECAY_INTERVAL_SECONDS = 60;
+
+                struct SampleCountdown {
+                    SampleCountdown();
+
+                    util::Mutex lock;
+                    int32_t remaining;
+                    // keeps the countdowns of the threads on separate cache lines
+                    char padding[64];
+                };
+
+                struct KeyId {
+                    KeyId(const std::string &objectName, const std::vector<byte> &key);
+
+                    bool operator<(const KeyId &rhs) const;
+
+                    std::string objectName;
+                    std::vector<byte> key;
+                };
+
+                struct Candidate {
+                    int partitionId;
+                    int64_t count;
+                };
+
+                typedef std::map<KeyId, Candidate> CandidateMap;
+                typedef std::set<std::pair<int64_t, const KeyId *> > CandidateOrder;
+
+                HotKeyProfiler(const HotKeyProfiler &);
+
+                HotKeyProfiler &operator=(const HotKeyProfiler &);
+
+                static void staticRunDumper(util::ThreadArgs &args);
+
+                void runDumper();
+
+                void dump();
+
+                bool shouldSample();
+
+                void decay();
+
+                int64_t addToSketch(uint32_t keyHash);
+
+                void updateCandidates(const KeyId &id, int partitionId, int64_t count);
+
+                const int32_t sampleRate;
+                const int32_t topK;
+                const int32_t dumpIntervalSeconds;
+                spi::PartitionService &partitionService;
+
+                SampleCountdown *countdowns;
+
+                // guards the values below
+                util::Mutex lock;
+                int64_t sampledOperations;
+                std::vector<int64_t> sketch;
+                CandidateMap candidates;
+                CandidateOrder candidateOrder;
+                std::map<int, int64_t> partitionCounts;
+                std::map<Address, int64_t, addressComparator> memberCounts;
+
+                util::AtomicBoolean live;
+                std::auto_ptr<util::Thread> dumpThread;
+            };
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_IMPL_HOTKEYPROFILER_H_
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_IMPL_IDGENERATORSUPPORT_H_
+#define HAZELCAST_CLIENT_IMPL_IDGENERATORSUPPORT_H_
+
+#include <deque>
+#include <string>
+#include <stdint.h>
+#include <boost/shared_ptr.hpp>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/ConditionVariable.h"
+#include "hazelcast/client/IAtomicLong.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace impl {
+            /**
+             * Hands out the ids of an IdGenerator from the blocks reserved on its IAtomicLong.
+             *
+             * The ids are taken from the current block under a short lock, no call is made while it is held. Once
+             * half of the current block is used, the next block is fetched asynchronously, until the configured
+             * number of blocks is in reserve. A caller waits for the cluster only if both the current block and the
+             * reserve are exhausted, the other callers wait for the same fetch instead of sending their own.
+             */
+            class HAZELCAST_API IdGeneratorSupport {
+            public:
+                /**
+                 * @param atomicLong the cluster wide block counter, counting in units of blockUnit ids
+                 * @param blockUnit the number of ids per increment of the counter
+                 * @param blockSize the number of ids fetched with a single call, rounded up to a multiple of the unit
+                 * @param prefetchBlocks the number of blocks to keep in reserve
+                 */
+                IdGeneratorSupport(const IAtomicLong &atomicLong, int64_t blockUnit, int64_t blockSize,
+                                   int prefetchBlocks);
+
+                /**
+                 * Hands out the ids in [next, end) before the reserved blocks.
+                 */
+                void reset(int64_t next, int64_t end);
+
+                int64_t newId();
+
+            private:
+                struct State {
+                    State();
+
+                    util::Mutex lock;
+                    util::ConditionVariable blockFetched;
+                    int64_t next;
+                    int64_t end;
+                    // the first ids of the reserved blocks
+                    std::deque<int64_t> reserve;
+                    bool fetching;
+                    int64_t failedFetches;
+                    std::string lastFailure;
+                };
+
+                class FetchCompletion;
+
+                void fetch();
+
+                static void onFetchCompleted(State &state, Future<int64_t> &future, int64_t blockUnit,
+                                             int64_t blockSize);
+
+                IAtomicLong atomicLong;
+                int64_t blockUnit;
+                int64_t blockSize;
+                size_t prefetchBlocks;
+                boost::shared_ptr<State> state;
+            };
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_IMPL_IDGENERATORSUPPORT_H_
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef HAZELCAST_CLIENT_IMPL_LOADAWARELB_H_
+#define HAZELCAST_CLIENT_IMPL_LOADAWARELB_H_
+
+#include "hazelcast/client/impl/AbstractLoadBalancer.h"
+#include "hazelcast/util/Mutex.h"
+
+#include <stdint.h>
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        class Member;
+
+        namespace impl {
+            /**
+             * Load balancer that avoids the slow and the busy members.
+             *
+             * Two members are picked at random and the one with the lower cost is returned (power of two choices).
+             * The cost of a member is computed from the connection of the client to it: the number of the calls
+             * waiting for their responses, the number of the messages waiting to be written, and the moving average
+             * of the response times. A member that the client is not connected to has no known cost and may be
+             * unreachable, hence the connected candidate is returned instead. If neither candidate is connected,
+             * the first one is returned.
+             *
+             * Usage:
+             * <code>
+             * impl::LoadAwareLB loadBalancer;
+             * clientConfig.setLoadBalancer(&loadBalancer);
+             * </code>
+             */
+            class HAZELCAST_API LoadAwareLB : public AbstractLoadBalancer {
+            public:
+                LoadAwareLB();
+
+                const Member next();
+
+            private:
+                /**
+                 * @return the cost of the member, negative if the client is not connected to it
+                 */
+                double getCost(const Member &member);
+
+                size_t nextRandom(size_t bound);
+
+                util::Mutex randomLock;
+                uint64_t randomState;
+            };
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_IMPL_LOADAWARELB_H_
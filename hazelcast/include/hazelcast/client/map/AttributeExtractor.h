@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef HAZELCAST_CLIENT_MAP_ATTRIBUTEEXTRACTOR_H_
+#define HAZELCAST_CLIENT_MAP_ATTRIBUTEEXTRACTOR_H_
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            /**
+             * Extracts an attribute from the map values, so that a QueryCache can index the values by the attribute.
+             *
+             * @tparam V the type of the map values
+             * @tparam A the type of the attribute. It should be copyable and comparable with operator<
+             *
+             * @see QueryCache#addIndex
+             */
+            template<typename V, typename A>
+            class AttributeExtractor {
+            public:
+                virtual ~AttributeExtractor() {
+                }
+
+                /**
+                 * @param value the map value
+                 * @return the attribute of the value
+                 */
+                virtual A extract(const V &value) const = 0;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_MAP_ATTRIBUTEEXTRACTOR_H_
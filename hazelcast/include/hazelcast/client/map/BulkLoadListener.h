@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_MAP_BULKLOADLISTENER_H_
+#define HAZELCAST_CLIENT_MAP_BULKLOADLISTENER_H_
+
+#include <stdint.h>
+
+#include "hazelcast/util/HazelcastDll.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace exception {
+            class IException;
+        }
+
+        namespace map {
+            /**
+             * Listener notified of the outcome of each batch stored by a BulkLoader.
+             *
+             * The listener is notified from the io threads, it should not block.
+             *
+             * @see config::BulkLoaderConfig#setListener
+             */
+            class HAZELCAST_API BulkLoadListener {
+            public:
+                virtual ~BulkLoadListener() {
+                }
+
+                /**
+                 * Invoked when a batch is stored.
+                 *
+                 * @param partitionId the partition of the entries of the batch
+                 * @param entryCount the number of entries in the batch
+                 * @param latencyMillis the time from sending the batch until it is stored
+                 */
+                virtual void batchStored(int partitionId, int32_t entryCount, int64_t latencyMillis) = 0;
+
+                /**
+                 * Invoked when a batch could not be stored. The entries of the batch are not retried by the loader.
+                 *
+                 * @param partitionId the partition of the entries of the batch
+                 * @param entryCount the number of entries in the batch
+                 * @param error the cause of the failure
+                 */
+                virtual void batchFailed(int partitionId, int32_t entryCount, const exception::IException &error) = 0;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_MAP_BULKLOADLISTENER_H_
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_MAP_BULKLOADSTATS_H_
+#define HAZELCAST_CLIENT_MAP_BULKLOADSTATS_H_
+
+#include <stdint.h>
+
+#include "hazelcast/util/HazelcastDll.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            /**
+             * A snapshot of the progress of a BulkLoader, see BulkLoader#getStats.
+             */
+            class HAZELCAST_API BulkLoadStats {
+            public:
+                BulkLoadStats(int64_t addedEntries, int64_t storedEntries, int64_t failedEntries,
+                              int64_t storedBatches, int64_t failedBatches, int64_t elapsedMillis);
+
+                /**
+                 * @return the number of entries added to the loader
+                 */
+                int64_t getAddedEntries() const;
+
+                /**
+                 * @return the number of entries stored to the map
+                 */
+                int64_t getStoredEntries() const;
+
+                /**
+                 * @return the number of entries of the failed batches
+                 */
+                int64_t getFailedEntries() const;
+
+                /**
+                 * @return the number of batches stored to the map
+                 */
+                int64_t getStoredBatches() const;
+
+                /**
+                 * @return the number of batches which could not be stored
+                 */
+                int64_t getFailedBatches() const;
+
+                /**
+                 * @return the time since the loader is created, or the lifetime of the loader once it is closed
+                 */
+                int64_t getElapsedMillis() const;
+
+                /**
+                 * @return the number of entries stored per second
+                 */
+                double getThroughput() const;
+
+            private:
+                int64_t addedEntries;
+                int64_t storedEntries;
+                int64_t failedEntries;
+                int64_t storedBatches;
+                int64_t failedBatches;
+                int64_t elapsedMillis;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_MAP_BULKLOADSTATS_H_
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_MAP_BULKLOADER_H_
+#define HAZELCAST_CLIENT_MAP_BULKLOADER_H_
+
+#include <map>
+#include <string>
+
+#include "hazelcast/client/map/impl/BulkLoaderImpl.h"
+#include "hazelcast/client/map/BulkLoadStats.h"
+#include "hazelcast/client/config/BulkLoaderConfig.h"
+#include "hazelcast/client/spi/ClientContext.h"
+#include "hazelcast/client/serialization/pimpl/SerializationService.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            /**
+             * Loads a large number of entries into an IMap without materializing them in a single std::map.
+             *
+             * The entries are added one by one and stored in batches per partition, keeping a bounded number of
+             * batches in flight per member. When the members can not keep up, add blocks the producer until a
+             * batch completes. The outcome of each batch is reported to the BulkLoadListener of the config, if any,
+             * and accumulated in getStats(). The failed batches are not retried.
+             *
+             * A BulkLoader can be used by multiple producer threads. The entries are stored in the order they are
+             * added only per partition.
+             *
+             * Example:
+             * <code>
+             * std::auto_ptr&lt;map::BulkLoader&lt;int, std::string&gt; &gt; loader = map.newBulkLoader();
+             * while (source.hasNext()) {
+             *     loader->add(source.key(), source.value());
+             * }
+             * loader->close();
+             * </code>
+             *
+             * @see IMap#newBulkLoader
+             */
+            template<typename K, typename V>
+            class BulkLoader {
+            public:
+                /**
+                 * Internal API. Constructor, see IMap#newBulkLoader
+                 */
+                BulkLoader(const std::string &mapName, spi::ClientContext &context,
+                           const config::BulkLoaderConfig &config)
+                : serializationService(context.getSerializationService())
+                , loader(mapName, context, config) {
+                }
+
+                /**
+                 * Adds an entry to be stored to the map. It blocks if the batch of the entry is full and the owner of
+                 * the partition has too many batches in flight.
+                 *
+                 * @param key the key of the entry
+                 * @param value the value of the entry
+                 * @throws IllegalStateException if the loader is closed
+                 */
+                void add(const K &key, const V &value) {
+                    loader.add(serializationService.toData<K>(&key), serializationService.toData<V>(&value));
+                }
+
+                /**
+                 * Adds the given entries, see add.
+                 */
+                void addAll(const std::map<K, V> &entries) {
+                    for (typename std::map<K, V>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+                        add(it->first, it->second);
+                    }
+                }
+
+                /**
+                 * Sends the partially filled batches and waits until all the batches in flight complete.
+                 */
+                void flush() {
+                    loader.flush();
+                }
+
+                /**
+                 * Flushes the loader and releases its resources. No entry can be added afterwards.
+                 */
+                void close() {
+                    loader.close();
+                }
+
+                /**
+                 * @return the progress of the load
+                 */
+                BulkLoadStats getStats() {
+                    return loader.getStats();
+                }
+
+            private:
+                serialization::pimpl::SerializationService &serializationService;
+                impl::BulkLoaderImpl loader;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_MAP_BULKLOADER_H_
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_MAP_MAPCURSOR_H_
+#define HAZELCAST_CLIENT_MAP_MAPCURSOR_H_
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "hazelcast/client/Future.h"
+#include "hazelcast/client/proxy/ProxyImpl.h"
+#include "hazelcast/client/EntryArray.h"
+#include "hazelcast/client/impl/EntryArrayImpl.h"
+#include "hazelcast/client/impl/DeserializationExecutor.h"
+#include "hazelcast/client/query/PagingPredicate.h"
+#include "hazelcast/client/query/EntryComparator.h"
+#include "hazelcast/client/spi/ClientContext.h"
+#include "hazelcast/client/spi/InvocationService.h"
+#include "hazelcast/client/serialization/pimpl/SerializationService.h"
+#include "hazelcast/client/protocol/codec/MapEntriesWithPagingPredicateCodec.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            /**
+             * Walks the entries of a map page by page, in the order of the keys or of the given comparator.
+             *
+             * Each page is fetched with a PagingPredicate anchored at the last entry of the previous page, hence the
+             * memory used does not depend on the size of the map. As soon as a page is returned by nextPage(), the
+             * request of the following page is sent to the cluster, so that it is transferred while the caller
+             * processes the current page. The entries of a page are deserialized in parallel if the page is large,
+             * see ClientProperties::PROP_DESERIALIZATION_POOL_SIZE.
+             *
+             * The cursor is not a snapshot: the entries updated during the walk may or may not be seen. The keys must
+             * be comparable at the members if no comparator is given. A MapCursor is not thread-safe.
+             *
+             * Example:
+             * <code>
+             * std::auto_ptr&lt;map::MapCursor&lt;int, Employee&gt; &gt; cursor = employees.newCursor(1000);
+             * for (std::auto_ptr&lt;EntryArray&lt;int, Employee&gt; &gt; page = cursor->nextPage(); page.get() != NULL;
+             *      page = cursor->nextPage()) {
+             *     for (size_t i = 0; i &lt; page->size(); ++i) {
+             *         process(*page->getKey(i), *page->getValue(i));
+             *     }
+             * }
+             * </code>
+             *
+             * @see IMap#newCursor
+             */
+            template<typename K, typename V>
+            class MapCursor {
+            public:
+                /**
+                 * Internal API. Constructor, see IMap#newCursor. The request of the first page is sent right away.
+                 *
+                 * @throws IllegalArgumentException if pageSize is 0
+                 */
+                MapCursor(const std::string &mapName, spi::ClientContext &context, size_t pageSize,
+                          std::auto_ptr<query::Predicate> predicate,
+                          std::auto_ptr<query::EntryComparator<K, V> > comparator)
+                : mapName(mapName)
+                , context(context)
+                , serializationService(context.getSerializationService())
+                , pageSize(pageSize)
+                , pagingPredicate(predicate, comparator, pageSize)
+                , exhausted(false) {
+                    if (0 == pageSize) {
+                        throw exception::IllegalArgumentException("MapCursor::MapCursor", "pageSize should be positive");
+                    }
+                    pagingPredicate.setIterationType(query::ENTRY);
+                    requestNextPage();
+                }
+
+                /**
+                 * Returns the next page, waiting for it if it is not received yet.
+                 *
+                 * If the page can not be fetched, the exception is thrown and the next call requests the same page
+                 * again.
+                 *
+                 * @return the entries of the next page, at most pageSize of them. NULL if there is no entry left.
+                 */
+                std::auto_ptr<EntryArray<K, V> > nextPage() {
+                    if (exhausted) {
+                        return std::auto_ptr<EntryArray<K, V> >();
+                    }
+
+                    if (NULL == pendingPage.get()) {
+                        requestNextPage();
+                    }
+
+                    std::auto_ptr<EntryVector> dataEntries;
+                    try {
+                        dataEntries = pendingPage->get();
+                    } catch (...) {
+                        pendingPage.reset();
+                        throw;
+                    }
+                    pendingPage.reset();
+
+                    // every member returns up to a page of entries after the anchor, the page is the smallest of them
+                    client::impl::EntryArrayImpl<K, V> entries(*dataEntries, serializationService);
+                    context.getDeserializationExecutor().deserializeAll(entries);
+                    entries.partialSort(query::ENTRY, pagingPredicate.getComparator(), pageSize);
+
+                    size_t size = entries.size();
+                    if (size < pageSize) {
+                        exhausted = true;
+                        if (0 == size) {
+                            return std::auto_ptr<EntryArray<K, V> >();
+                        }
+                    }
+
+                    size_t end = size < pageSize ? size : pageSize;
+                    std::auto_ptr<EntryArray<K, V> > page(new client::impl::EntryArrayImpl<K, V>(entries, 0, end));
+                    if (!exhausted) {
+                        // only the last anchor is kept, so that the request size does not grow with the pages
+                        std::pair<K *, V *> anchor(new K(*page->getKey(end - 1)), new V(*page->getValue(end - 1)));
+                        pagingPredicate.reset();
+                        pagingPredicate.setIterationType(query::ENTRY);
+                        pagingPredicate.setAnchor(0, anchor);
+                        pagingPredicate.setPage(1);
+                        requestNextPage();
+                    }
+                    return page;
+                }
+
+            private:
+                static std::auto_ptr<EntryVector> decodePage(protocol::ClientMessage &response,
+                                                             serialization::pimpl::SerializationService &) {
+                    return std::auto_ptr<EntryVector>(new EntryVector(
+                            protocol::codec::MapEntriesWithPagingPredicateCodec::ResponseParameters::decode(
+                                    response).response));
+                }
+
+                void requestNextPage() {
+                    std::auto_ptr<protocol::ClientMessage> request =
+                            protocol::codec::MapEntriesWithPagingPredicateCodec::RequestParameters::encode(
+                                    mapName, serializationService.toData<serialization::IdentifiedDataSerializable>(
+                                            &pagingPredicate));
+                    connection::CallFuture future = context.getInvocationService().invokeOnRandomTarget(request);
+                    pendingPage.reset(new Future<EntryVector>(future, serializationService, decodePage));
+                }
+
+                std::string mapName;
+                spi::ClientContext &context;
+                serialization::pimpl::SerializationService &serializationService;
+                size_t pageSize;
+                query::PagingPredicate<K, V> pagingPredicate;
+                std::auto_ptr<Future<EntryVector> > pendingPage;
+                bool exhausted;
+
+                // prevent copy operations
+                MapCursor(const MapCursor &rhs);
+
+                MapCursor &operator=(const MapCursor &rhs);
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_MAP_MAPCURSOR_H_
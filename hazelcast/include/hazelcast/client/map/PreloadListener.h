@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_MAP_PRELOADLISTENER_H_
+#define HAZELCAST_CLIENT_MAP_PRELOADLISTENER_H_
+
+#include <vector>
+#include <utility>
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            /**
+             * Receives the entries loaded by a Preloader, typically to put them into a client side cache.
+             *
+             * The listener is notified from the background thread of the preloader, once per loaded batch. The keys
+             * of the snapshot which are not in the map are not passed.
+             *
+             * @see IMap#newPreloader
+             */
+            template<typename K, typename V>
+            class PreloadListener {
+            public:
+                virtual ~PreloadListener() {
+                }
+
+                /**
+                 * Invoked when a batch of entries is loaded.
+                 *
+                 * @param entries the loaded entries of a single partition
+                 */
+                virtual void entriesPreloaded(const std::vector<std::pair<K, V> > &entries) = 0;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_MAP_PRELOADLISTENER_H_
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_MAP_PRELOADER_H_
+#define HAZELCAST_CLIENT_MAP_PRELOADER_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "hazelcast/client/map/impl/PreloaderImpl.h"
+#include "hazelcast/client/map/PreloadListener.h"
+#include "hazelcast/client/config/PreloaderConfig.h"
+#include "hazelcast/client/spi/ClientContext.h"
+#include "hazelcast/client/serialization/pimpl/SerializationService.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            /**
+             * Warms up a client side cache of a map from the keys persisted by a previous run of the application, so
+             * that a restarted client does not send a burst of gets to the cluster while its cache is cold.
+             *
+             * On creation, the keys of the local snapshot file of the map, if any, are loaded in the background
+             * with MapGetAll batches grouped per partition, with a bounded number of batches in flight and within
+             * the bandwidth budget of the config. The loaded entries are passed to the PreloadListener.
+             *
+             * The snapshot is replaced with storeSnapshot, or with the hot keys of the map as estimated by the hot key
+             * profiler of the client (see ClientProperties::PROP_HOT_KEY_SAMPLE_RATE). The hot keys are also stored
+             * periodically and when the preloader is closed, if the profiler is enabled. The profiler reports at most
+             * its top K keys (ClientProperties::PROP_HOT_KEY_TOP_K) across all the objects. Hence a hot key snapshot
+             * puts the current hot keys first, then keeps the keys which were preloaded or stored before, up to the
+             * maximum number of keys of the config.
+             *
+             * Example:
+             * <code>
+             * std::auto_ptr&lt;map::Preloader&lt;int, std::string&gt; &gt; preloader = map.newPreloader(cacheLoader);
+             * preloader->awaitPreload(30000);
+             * </code>
+             *
+             * @see IMap#newPreloader
+             */
+            template<typename K, typename V>
+            class Preloader {
+            public:
+                /**
+                 * Internal API. Constructor, see IMap#newPreloader
+                 */
+                Preloader(const std::string &mapName, spi::ClientContext &context, PreloadListener<K, V> &listener,
+                          const config::PreloaderConfig &config)
+                : adapter(context.getSerializationService(), listener)
+                , preloader(mapName, context, config, adapter) {
+                }
+
+                /**
+                 * Replaces the snapshot of the map with the given keys, e.g. the keys of the client side cache.
+                 *
+                 * @param keys the keys to be preloaded on the next start
+                 * @throws IOException if the snapshot can not be written
+                 */
+                void storeSnapshot(const std::vector<K> &keys) {
+                    serialization::pimpl::SerializationService &serializationService = adapter.serializationService;
+                    std::vector<serialization::pimpl::Data> dataKeys;
+                    dataKeys.reserve(keys.size());
+                    for (typename std::vector<K>::const_iterator it = keys.begin(); it != keys.end(); ++it) {
+                        dataKeys.push_back(serializationService.toData<K>(&(*it)));
+                    }
+                    preloader.storeSnapshot(dataKeys);
+                }
+
+                /**
+                 * Replaces the snapshot of the map with its hot keys, as estimated by the hot key profiler, followed
+                 * by the keys of the previous snapshot which were preloaded or stored by this preloader, up to the
+                 * maximum number of keys.
+                 *
+                 * @return false if the profiler is disabled or has not sampled any key of the map, the snapshot is
+                 * then left as is
+                 * @throws IOException if the snapshot can not be written
+                 */
+                bool storeHotKeySnapshot() {
+                    return preloader.storeHotKeySnapshot();
+                }
+
+                /**
+                 * Waits until the preload is completed.
+                 *
+                 * @param timeoutMillis the maximum time to wait
+                 * @return true if the preload is completed, false if the timeout passed
+                 */
+                bool awaitPreload(int64_t timeoutMillis) {
+                    return preloader.awaitPreload(timeoutMillis);
+                }
+
+                /**
+                 * @return true if all the keys of the snapshot are loaded, or if there is no snapshot
+                 */
+                bool isPreloadCompleted() {
+                    return preloader.isPreloadCompleted();
+                }
+
+                /**
+                 * @return the number of the entries passed to the listener
+                 */
+                int64_t getPreloadedEntryCount() {
+                    return preloader.getPreloadedEntryCount();
+                }
+
+                /**
+                 * @return the number of the batches which could not be loaded, they are not retried
+                 */
+                int64_t getFailedBatchCount() {
+                    return preloader.getFailedBatchCount();
+                }
+
+                /**
+                 * Stops the preload and the periodic stores. The hot keys are stored one last time if the periodic
+                 * store is enabled.
+                 */
+                void close() {
+                    preloader.close();
+                }
+
+            private:
+                class ListenerAdapter : public impl::PreloaderImpl::Listener {
+                public:
+                    ListenerAdapter(serialization::pimpl::SerializationService &serializationService,
+                                    PreloadListener<K, V> &listener)
+                    : serializationService(serializationService)
+                    , listener(listener) {
+                    }
+
+                    virtual void entriesPreloaded(const impl::PreloaderImpl::Entries &entries) {
+                        std::vector<std::pair<K, V> > objects;
+                        objects.reserve(entries.size());
+                        for (impl::PreloaderImpl::Entries::const_iterator it = entries.begin();
+                             it != entries.end(); ++it) {
+                            std::auto_ptr<K> key = serializationService.toObject<K>(it->first);
+                            std::auto_ptr<V> value = serializationService.toObject<V>(it->second);
+                            objects.push_back(std::make_pair(*key, *value));
+                        }
+                        listener.entriesPreloaded(objects);
+                    }
+
+                    serialization::pimpl::SerializationService &serializationService;
+
+                private:
+                    PreloadListener<K, V> &listener;
+                };
+
+                // declared before the preloader, so that it outlives the background thread of the preloader
+                ListenerAdapter adapter;
+                impl::PreloaderImpl preloader;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_MAP_PRELOADER_H_
@@ -0,0 +1,557 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef HAZELCAST_CLIENT_MAP_QUERYCACHE_H_
+#define HAZELCAST_CLIENT_MAP_QUERYCACHE_H_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <boost/shared_ptr.hpp>
+
+#include "hazelcast/client/IMap.h"
+#include "hazelcast/client/EntryListener.h"
+#include "hazelcast/client/EntryEvent.h"
+#include "hazelcast/client/MapEvent.h"
+#include "hazelcast/client/query/Predicate.h"
+#include "hazelcast/client/query/impl/predicates/PredicateDataSerializerHook.h"
+#include "hazelcast/client/serialization/ObjectDataOutput.h"
+#include "hazelcast/client/serialization/ObjectDataInput.h"
+#include "hazelcast/client/exception/IllegalArgumentException.h"
+#include "hazelcast/client/exception/IllegalStateException.h"
+#include "hazelcast/client/map/AttributeExtractor.h"
+#include "hazelcast/client/map/impl/QueryCacheIndex.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/LockGuard.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4355) //for this in the initializer list
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            /**
+             * A continuously updated local view of the entries of a map which match a predicate.
+             *
+             * The cache is populated with a single query when it is constructed and it is then kept up to date with
+             * the entry events of the map, hence reading from the cache does not need any network traffic. Two entry
+             * listeners are registered: one with the predicate, which delivers the entries that enter or are updated
+             * in the view, and one with the negation of the predicate without values, which delivers only the keys
+             * of the entries that leave the view. The events received while the initial query runs are replayed on
+             * top of the query result, so that no update is lost.
+             *
+             * The values can be indexed locally by an attribute, see addIndex. The indexes are kept sorted, hence an
+             * index serves both the equality and the range lookups.
+             *
+             * The view is eventually consistent with the map. It is cleared when the map is cleared or evicted. The
+             * cache is thread-safe. The listeners are removed by destroy() or when the cache is destructed.
+             *
+             * Example:
+             * <code>
+             * map::QueryCache&lt;int, Employee&gt; activeEmployees(employees, std::auto_ptr&lt;query::Predicate&gt;(
+             *         new query::SqlPredicate("active = true")));
+             * activeEmployees.addIndex(std::string("department"),
+             *         std::auto_ptr&lt;map::AttributeExtractor&lt;Employee, std::string&gt; &gt;(new DepartmentExtractor()));
+             * std::vector&lt;Employee&gt; sales = activeEmployees.values(std::string("department"), std::string("sales"));
+             * </code>
+             */
+            template<typename K, typename V>
+            class QueryCache {
+            public:
+                /**
+                 * Registers the listeners and populates the cache with the entries of the map matching the predicate.
+                 *
+                 * @param map the map to be viewed
+                 * @param predicate the predicate that the entries of the view match
+                 */
+                QueryCache(IMap<K, V> &map, std::auto_ptr<query::Predicate> predicate)
+                        : imap(map), predicate(predicate), leavingPredicate(*this->predicate), matchingListener(*this),
+                          leavingListener(*this), populating(true), destroyed(false) {
+                    matchingRegistrationId = imap.addEntryListener(matchingListener, *this->predicate, true);
+                    try {
+                        leavingRegistrationId = imap.addEntryListener(leavingListener, leavingPredicate, false);
+                        populate();
+                    } catch (exception::IException &) {
+                        destroy();
+                        throw;
+                    }
+                }
+
+                virtual ~QueryCache() {
+                    destroy();
+                }
+
+                /**
+                 * Removes the listeners from the map. The cache is not updated any more, its contents stay readable.
+                 */
+                void destroy() {
+                    {
+                        util::LockGuard guard(lock);
+                        if (destroyed) {
+                            return;
+                        }
+                        destroyed = true;
+                    }
+
+                    imap.removeEntryListener(matchingRegistrationId);
+                    if (!leavingRegistrationId.empty()) {
+                        imap.removeEntryListener(leavingRegistrationId);
+                    }
+                }
+
+                /**
+                 * @return the number of cached entries
+                 */
+                int size() {
+                    util::LockGuard guard(lock);
+                    return (int) entries.size();
+                }
+
+                /**
+                 * @return true if there are no cached entries
+                 */
+                bool isEmpty() {
+                    util::LockGuard guard(lock);
+                    return entries.empty();
+                }
+
+                /**
+                 * @param key the key of the entry
+                 * @return true if the entry is in the view
+                 */
+                bool containsKey(const K &key) {
+                    util::LockGuard guard(lock);
+                    return entries.find(key) != entries.end();
+                }
+
+                /**
+                 * @param key the key of the entry
+                 * @return a copy of the cached value, NULL if the entry is not in the view
+                 */
+                boost::shared_ptr<V> get(const K &key) {
+                    util::LockGuard guard(lock);
+                    typename std::map<K, V>::const_iterator it = entries.find(key);
+                    if (it == entries.end()) {
+                        return boost::shared_ptr<V>();
+                    }
+                    return boost::shared_ptr<V>(new V(it->second));
+                }
+
+                /**
+                 * @return the keys of the view in ascending order
+                 */
+                std::vector<K> keySet() {
+                    util::LockGuard guard(lock);
+                    std::vector<K> result;
+                    result.reserve(entries.size());
+                    for (typename std::map<K, V>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+                        result.push_back(it->first);
+                    }
+                    return result;
+                }
+
+                /**
+                 * @return the values of the view in the order of their keys
+                 */
+                std::vector<V> values() {
+                    util::LockGuard guard(lock);
+                    std::vector<V> result;
+                    result.reserve(entries.size());
+                    for (typename std::map<K, V>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+                        result.push_back(it->second);
+                    }
+                    return result;
+                }
+
+                /**
+                 * @return the entries of the view in ascending key order
+                 */
+                std::vector<std::pair<K, V> > entrySet() {
+                    util::LockGuard guard(lock);
+                    return std::vector<std::pair<K, V> >(entries.begin(), entries.end());
+                }
+
+                /**
+                 * Indexes the cached values by the attribute that the extractor returns. The index is kept up to date
+                 * as the view changes.
+                 *
+                 * @param attribute the name of the index
+                 * @param extractor extracts the attribute from the values
+                 * @throws IllegalArgumentException if there is already an index with the same name
+                 */
+                template<typename A>
+                void addIndex(const std::string &attribute, std::auto_ptr<AttributeExtractor<V, A> > extractor) {
+                    util::LockGuard guard(lock);
+                    if (indexes.find(attribute) != indexes.end()) {
+                        throw exception::IllegalArgumentException("QueryCache::addIndex",
+                                                                  "There is already an index for the attribute " +
+                                                                  attribute);
+                    }
+
+                    boost::shared_ptr<impl::QueryCacheIndex<K, V> > index(new impl::AttributeIndex<K, V, A>(extractor));
+                    for (typename std::map<K, V>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+                        index->insert(it->first, it->second);
+                    }
+                    indexes[attribute] = index;
+                }
+
+                /**
+                 * @param attribute the name of the index
+                 * @param value the attribute value
+                 * @return the keys of the entries whose attribute is equal to the value
+                 * @throws IllegalArgumentException if there is no index of the attribute type with the given name
+                 */
+                template<typename A>
+                std::vector<K> keySet(const std::string &attribute, const A &value) {
+                    util::LockGuard guard(lock);
+                    std::vector<K> result;
+                    getIndex<A>(attribute).find(value, result);
+                    return result;
+                }
+
+                /**
+                 * @param attribute the name of the index
+                 * @param from the lowest attribute value, inclusive
+                 * @param to the highest attribute value, inclusive
+                 * @return the keys of the entries whose attribute is between from and to, in attribute order
+                 * @throws IllegalArgumentException if there is no index of the attribute type with the given name
+                 */
+                template<typename A>
+                std::vector<K> keySet(const std::string &attribute, const A &from, const A &to) {
+                    util::LockGuard guard(lock);
+                    std::vector<K> result;
+                    getIndex<A>(attribute).findBetween(from, to, result);
+                    return result;
+                }
+
+                /**
+                 * @param attribute the name of the index
+                 * @param value the attribute value
+                 * @return the values whose attribute is equal to the value
+                 * @throws IllegalArgumentException if there is no index of the attribute type with the given name
+                 */
+                template<typename A>
+                std::vector<V> values(const std::string &attribute, const A &value) {
+                    util::LockGuard guard(lock);
+                    std::vector<K> keys;
+                    getIndex<A>(attribute).find(value, keys);
+                    return valuesOf(keys);
+                }
+
+                /**
+                 * @param attribute the name of the index
+                 * @param from the lowest attribute value, inclusive
+                 * @param to the highest attribute value, inclusive
+                 * @return the values whose attribute is between from and to, in attribute order
+                 * @throws IllegalArgumentException if there is no index of the attribute type with the given name
+                 */
+                template<typename A>
+                std::vector<V> values(const std::string &attribute, const A &from, const A &to) {
+                    util::LockGuard guard(lock);
+                    std::vector<K> keys;
+                    getIndex<A>(attribute).findBetween(from, to, keys);
+                    return valuesOf(keys);
+                }
+
+            private:
+                /**
+                 * The negation of a predicate which is owned by the cache. It is serialized as a NotPredicate.
+                 */
+                class LeavingPredicate : public query::Predicate {
+                public:
+                    LeavingPredicate(const query::Predicate &predicate) : predicate(predicate) {
+                    }
+
+                    int getFactoryId() const {
+                        return query::impl::predicates::F_ID;
+                    }
+
+                    int getClassId() const {
+                        return query::impl::predicates::NOT_PREDICATE;
+                    }
+
+                    void writeData(serialization::ObjectDataOutput &out) const {
+                        out.writeObject<serialization::IdentifiedDataSerializable>(&predicate);
+                    }
+
+                    void readData(serialization::ObjectDataInput &in) {
+                        throw exception::IException("QueryCache::LeavingPredicate::readData",
+                                                    "Client should not need to use readData method!!!");
+                    }
+
+                private:
+                    const query::Predicate &predicate;
+                };
+
+                /**
+                 * Receives the entries that match the predicate after an update
+                 */
+                class MatchingListener : public EntryListener<K, V> {
+                public:
+                    MatchingListener(QueryCache &cache) : cache(cache) {
+                    }
+
+                    void entryAdded(const EntryEvent<K, V> &event) {
+                        cache.onUpdate(event);
+                    }
+
+                    void entryRemoved(const EntryEvent<K, V> &event) {
+                        cache.onRemove(event);
+                    }
+
+                    void entryUpdated(const EntryEvent<K, V> &event) {
+                        cache.onUpdate(event);
+                    }
+
+                    void entryEvicted(const EntryEvent<K, V> &event) {
+                        cache.onRemove(event);
+                    }
+
+                    void entryExpired(const EntryEvent<K, V> &event) {
+                        cache.onRemove(event);
+                    }
+
+                    void entryMerged(const EntryEvent<K, V> &event) {
+                        cache.onUpdate(event);
+                    }
+
+                    void mapEvicted(const MapEvent &event) {
+                        cache.onClear();
+                    }
+
+                    void mapCleared(const MapEvent &event) {
+                        cache.onClear();
+                    }
+
+                private:
+                    QueryCache &cache;
+                };
+
+                /**
+                 * Receives the keys of the entries that do not match the predicate after an update
+                 */
+                class LeavingListener : public EntryListener<K, V> {
+                public:
+                    LeavingListener(QueryCache &cache) : cache(cache) {
+                    }
+
+                    void entryAdded(const EntryEvent<K, V> &event) {
+                        cache.onRemove(event);
+                    }
+
+                    void entryRemoved(const EntryEvent<K, V> &event) {
+                        cache.onRemove(event);
+                    }
+
+                    void entryUpdated(const EntryEvent<K, V> &event) {
+                        cache.onRemove(event);
+                    }
+
+                    void entryEvicted(const EntryEvent<K, V> &event) {
+                        cache.onRemove(event);
+                    }
+
+                    void entryExpired(const EntryEvent<K, V> &event) {
+                        cache.onRemove(event);
+                    }
+
+                    void entryMerged(const EntryEvent<K, V> &event) {
+                        cache.onRemove(event);
+                    }
+
+                    void mapEvicted(const MapEvent &event) {
+                        // handled by the matching listener
+                    }
+
+                    void mapCleared(const MapEvent &event) {
+                        // handled by the matching listener
+                    }
+
+                private:
+                    QueryCache &cache;
+                };
+
+                /**
+                 * An event received during the initial query. A NULL value stands for a removal, a NULL key for a
+                 * clear.
+                 */
+                struct PendingEvent {
+                    boost::shared_ptr<K> key;
+                    boost::shared_ptr<V> value;
+                };
+
+                void populate() {
+                    std::vector<std::pair<K, V> > result = imap.entrySet(*predicate);
+
+                    util::LockGuard guard(lock);
+                    for (typename std::vector<std::pair<K, V> >::const_iterator it = result.begin();
+                         it != result.end(); ++it) {
+                        put(it->first, it->second);
+                    }
+
+                    // the events are newer than or as new as the query result, replaying them in order ends up in
+                    // the latest state of each entry
+                    for (typename std::vector<PendingEvent>::const_iterator it = pendingEvents.begin();
+                         it != pendingEvents.end(); ++it) {
+                        if (NULL == it->key.get()) {
+                            clear();
+                        } else if (NULL == it->value.get()) {
+                            remove(*it->key);
+                        } else {
+                            put(*it->key, *it->value);
+                        }
+                    }
+                    pendingEvents.clear();
+                    populating = false;
+                }
+
+                void onUpdate(const EntryEvent<K, V> &event) {
+                    const K *key = event.getKeyObject();
+                    const V *value = event.getValueObject();
+                    if (NULL == key || NULL == value) {
+                        return;
+                    }
+
+                    util::LockGuard guard(lock);
+                    if (populating) {
+                        PendingEvent pendingEvent;
+                        pendingEvent.key.reset(new K(*key));
+                        pendingEvent.value.reset(new V(*value));
+                        pendingEvents.push_back(pendingEvent);
+                        return;
+                    }
+                    put(*key, *value);
+                }
+
+                void onRemove(const EntryEvent<K, V> &event) {
+                    const K *key = event.getKeyObject();
+                    if (NULL == key) {
+                        return;
+                    }
+
+                    util::LockGuard guard(lock);
+                    if (populating) {
+                        PendingEvent pendingEvent;
+                        pendingEvent.key.reset(new K(*key));
+                        pendingEvents.push_back(pendingEvent);
+                        return;
+                    }
+                    remove(*key);
+                }
+
+                void onClear() {
+                    util::LockGuard guard(lock);
+                    if (populating) {
+                        pendingEvents.push_back(PendingEvent());
+                        return;
+                    }
+                    clear();
+                }
+
+                void put(const K &key, const V &value) {
+                    typename std::map<K, V>::iterator it = entries.find(key);
+                    if (it == entries.end()) {
+                        it = entries.insert(std::pair<K, V>(key, value)).first;
+                    } else {
+                        for (typename IndexMap::const_iterator index = indexes.begin(); index != indexes.end(); ++index) {
+                            index->second->remove(key, it->second);
+                        }
+                        it->second = value;
+                    }
+
+                    for (typename IndexMap::const_iterator index = indexes.begin(); index != indexes.end(); ++index) {
+                        index->second->insert(key, value);
+                    }
+                }
+
+                void remove(const K &key) {
+                    typename std::map<K, V>::iterator it = entries.find(key);
+                    if (it == entries.end()) {
+                        return;
+                    }
+
+                    for (typename IndexMap::const_iterator index = indexes.begin(); index != indexes.end(); ++index) {
+                        index->second->remove(key, it->second);
+                    }
+                    entries.erase(it);
+                }
+
+                void clear() {
+                    entries.clear();
+                    for (typename IndexMap::const_iterator index = indexes.begin(); index != indexes.end(); ++index) {
+                        index->second->clear();
+                    }
+                }
+
+                template<typename A>
+                const impl::AttributeIndex<K, V, A> &getIndex(const std::string &attribute) const {
+                    typename IndexMap::const_iterator it = indexes.find(attribute);
+                    if (it == indexes.end()) {
+                        throw exception::IllegalArgumentException("QueryCache::getIndex",
+                                                                  "There is no index for the attribute " + attribute);
+                    }
+
+                    const impl::AttributeIndex<K, V, A> *index =
+                            dynamic_cast<const impl::AttributeIndex<K, V, A> *>(it->second.get());
+                    if (NULL == index) {
+                        throw exception::IllegalArgumentException("QueryCache::getIndex",
+                                                                  "The index for the attribute " + attribute +
+                                                                  " is of another attribute type");
+                    }
+                    return *index;
+                }
+
+                std::vector<V> valuesOf(const std::vector<K> &keys) const {
+                    std::vector<V> result;
+                    result.reserve(keys.size());
+                    for (typename std::vector<K>::const_iterator it = keys.begin(); it != keys.end(); ++it) {
+                        result.push_back(entries.find(*it)->second);
+                    }
+                    return result;
+                }
+
+                typedef std::map<std::string, boost::shared_ptr<impl::QueryCacheIndex<K, V> > > IndexMap;
+
+                IMap<K, V> imap;
+                std::auto_ptr<query::Predicate> predicate;
+                LeavingPredicate leavingPredicate;
+                MatchingListener matchingListener;
+                LeavingListener leavingListener;
+                std::string matchingRegistrationId;
+                std::string leavingRegistrationId;
+                util::Mutex lock;
+                std::map<K, V> entries;
+                IndexMap indexes;
+                std::vector<PendingEvent> pendingEvents;
+                bool populating;
+                bool destroyed;
+
+                // prevent copy operations
+                QueryCache(const QueryCache &rhs);
+
+                QueryCache &operator=(const QueryCache &rhs);
+            };
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_MAP_QUERYCACHE_H_
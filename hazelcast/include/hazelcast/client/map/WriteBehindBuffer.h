@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_MAP_WRITEBEHINDBUFFER_H_
+#define HAZELCAST_CLIENT_MAP_WRITEBEHINDBUFFER_H_
+
+#include <string>
+#include <boost/shared_ptr.hpp>
+
+#include "hazelcast/client/map/impl/WriteBehindBufferImpl.h"
+#include "hazelcast/client/config/WriteBehindConfig.h"
+#include "hazelcast/client/spi/ClientContext.h"
+#include "hazelcast/client/serialization/pimpl/SerializationService.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            /**
+             * Buffers the updates of an IMap on the client and stores them in the background, for the workloads
+             * which update the same keys frequently and only care about the last value.
+             *
+             * The updates of a key within the coalescing window are coalesced, only the last value is stored. The
+             * buffered updates are stored per partition with a single MapPutAll call. The updates made through the
+             * buffer are visible to its get right away, they are visible to the other readers of the map once they
+             * are stored. When the buffer is full, set either blocks or fails, see WriteBehindConfig#OverflowPolicy.
+             *
+             * The failed updates are not retried, their number is reported by getFailedEntryCount. A buffer can be
+             * used by multiple threads.
+             *
+             * Example:
+             * <code>
+             * std::auto_ptr&lt;map::WriteBehindBuffer&lt;std::string, int&gt; &gt; buffer = map.newWriteBehindBuffer();
+             * buffer->set("counter", 1);
+             * buffer->set("counter", 2); // replaces the buffered value
+             * buffer->close(); // stores 2
+             * </code>
+             *
+             * @see IMap#newWriteBehindBuffer
+             */
+            template<typename K, typename V>
+            class WriteBehindBuffer {
+            public:
+                /**
+                 * Internal API. Constructor, see IMap#newWriteBehindBuffer
+                 */
+                WriteBehindBuffer(const std::string &mapName, spi::ClientContext &context,
+                                  const config::WriteBehindConfig &config)
+                : serializationService(context.getSerializationService())
+                , buffer(mapName, context, config) {
+                }
+
+                /**
+                 * Buffers the value of the key, replacing the value buffered earlier if there is one.
+                 *
+                 * @param key the key of the entry
+                 * @param value the value of the entry
+                 * @throws HazelcastOverloadException if the buffer is full and the overflow policy is FAIL
+                 * @throws IllegalStateException if the buffer is closed
+                 */
+                void set(const K &key, const V &value) {
+                    buffer.set(serializationService.toData<K>(&key), serializationService.toData<V>(&value));
+                }
+
+                /**
+                 * Gets the value of the key, the buffered value if there is one.
+                 *
+                 * @param key the key of the entry
+                 * @return the value, NULL if there is no value for the key.
+                 */
+                boost::shared_ptr<V> get(const K &key) {
+                    std::auto_ptr<serialization::pimpl::Data> valueData =
+                            buffer.get(serializationService.toData<K>(&key));
+                    return boost::shared_ptr<V>(serializationService.toObject<V>(valueData.get()));
+                }
+
+                /**
+                 * Sends the buffered updates and waits until they are stored.
+                 */
+                void flush() {
+                    buffer.flush();
+                }
+
+                /**
+                 * Flushes the buffer and releases its resources. No update can be made afterwards.
+                 */
+                void close() {
+                    buffer.close();
+                }
+
+                /**
+                 * @return the number of keys waiting to be sent
+                 */
+                int64_t getBufferedEntryCount() {
+                    return buffer.getBufferedEntryCount();
+                }
+
+                /**
+                 * @return the number of updates which replaced a buffered value, hence were not sent
+                 */
+                int64_t getCoalescedUpdateCount() {
+                    return buffer.getCoalescedUpdateCount();
+                }
+
+                /**
+                 * @return the number of entries which could not be stored
+                 */
+                int64_t getFailedEntryCount() {
+                    return buffer.getFailedEntryCount();
+                }
+
+            private:
+                serialization::pimpl::SerializationService &serializationService;
+                impl::WriteBehindBufferImpl buffer;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_MAP_WRITEBEHINDBUFFER_H_
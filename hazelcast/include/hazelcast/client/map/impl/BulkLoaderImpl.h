@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_MAP_IMPL_BULKLOADERIMPL_H_
+#define HAZELCAST_CLIENT_MAP_IMPL_BULKLOADERIMPL_H_
+
+#include <map>
+#include <vector>
+#include <string>
+#include <memory>
+#include <utility>
+#include <stdint.h>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/ConditionVariable.h"
+#include "hazelcast/util/AtomicBoolean.h"
+#include "hazelcast/util/Thread.h"
+#include "hazelcast/client/Address.h"
+#include "hazelcast/client/serialization/pimpl/Data.h"
+#include "hazelcast/client/config/BulkLoaderConfig.h"
+#include "hazelcast/client/map/BulkLoadStats.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace spi {
+            class ClientContext;
+        }
+
+        namespace connection {
+            class CallFuture;
+        }
+
+        namespace exception {
+            class IException;
+        }
+
+        namespace map {
+            class BulkLoadListener;
+
+            namespace impl {
+                /**
+                 * Serialized form of a BulkLoader.
+                 *
+                 * The entries are buffered per partition. A full buffer, or one older than the linger time, is sent
+                 * with a single MapPutAll call to the owner of the partition. At most maxInFlightPerMember calls are
+                 * pending per member, a producer which fills a buffer of a busy member waits until one of the calls to
+                 * that member completes. The memory used by the loader is hence bounded by the partition buffers and
+                 * the in flight batches, no matter how many entries are loaded.
+                 *
+                 * A partition has at most one batch in flight, counted from the moment its buffer is taken until the
+                 * call completes, like the partitions of WriteBehindBufferImpl. A newer batch of the partition can hence
+                 * not overtake an older one, and the entries of a partition are stored in the order they are added. A
+                 * producer which fills the buffer of a partition with a batch in flight waits until that batch
+                 * completes.
+                 */
+                class HAZELCAST_API BulkLoaderImpl {
+                public:
+                    BulkLoaderImpl(const std::string &mapName, spi::ClientContext &context,
+                                   const config::BulkLoaderConfig &config);
+
+                    virtual ~BulkLoaderImpl();
+
+                    void add(const serialization::pimpl::Data &key, const serialization::pimpl::Data &value);
+
+                    void flush();
+
+                    void close();
+
+                    BulkLoadStats getStats();
+
+                private:
+                    typedef std::vector<std::pair<serialization::pimpl::Data, serialization::pimpl::Data> > Entries;
+
+                    struct Buffer {
+                        Buffer();
+
+                        Entries entries;
+                        int64_t creationTime;
+                        // true from taking a batch of the partition until its call completes
+                        bool inFlight;
+                    };
+
+                    class BatchCompletion;
+
+                    static void staticRunFlusher(util::ThreadArgs &args);
+
+                    void runFlusher();
+
+                    void checkOpen();
+
+                    /**
+                     * Takes the buffers which are older than the given time, all of them if olderThan is negative. The
+                     * buffers of the partitions with a batch in flight are skipped.
+                     */
+                    void takeBuffers(int64_t olderThan, std::map<int, Entries> &buffers);
+
+                    /**
+                     * Marks the partition as in flight and takes its entries, called with the lock held.
+                     */
+                    void takeBatch(int partitionId, Buffer &buffer, Entries &batch);
+
+                    void send(int partitionId, Entries &entries);
+
+                    /**
+                     * Clears the in flight mark of the partition once its batch is completed, called with the lock held.
+                     */
+                    void releasePartition(int partitionId);
+
+                    void onBatchCompleted(connection::CallFuture &future, int partitionId, const Address &member,
+                                          int32_t entryCount, int64_t sendTime);
+
+                    std::string mapName;
+                    spi::ClientContext &context;
+                    int batchSize;
+                    int lingerMillis;
+                    int maxInFlightPerMember;
+                    BulkLoadListener *listener;
+                    int64_t startTime;
+                    int64_t closeTime;
+
+                    util::Mutex lock;
+                    util::ConditionVariable batchCompleted;
+                    std::map<int, Buffer> buffers;
+                    std::map<Address, int, addressComparator> inFlightPerMember;
+                    // the batches taken from the buffers and not completed yet
+                    int inFlight;
+                    int64_t addedEntries;
+                    int64_t storedEntries;
+                    int64_t failedEntries;
+                    int64_t storedBatches;
+                    int64_t failedBatches;
+
+                    util::AtomicBoolean live;
+                    std::auto_ptr<util::Thread> flushThread;
+                };
+            }
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_MAP_IMPL_BULKLOADERIMPL_H_
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_MAP_IMPL_KEYSNAPSHOT_H_
+#define HAZELCAST_CLIENT_MAP_IMPL_KEYSNAPSHOT_H_
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/client/serialization/pimpl/Data.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            namespace impl {
+                /**
+                 * Reads and writes the key snapshot file of a map::Preloader.
+                 *
+                 * The file starts with a magic number, the format version and the map name, followed by the number of
+                 * keys and the serialized keys, each prefixed with its length. All the integers are big endian. A
+                 * snapshot is written to a temporary file which then replaces the previous snapshot, hence a reader
+                 * never sees a partially written snapshot.
+                 */
+                class HAZELCAST_API KeySnapshot {
+                public:
+                    static const int32_t MAGIC;
+                    static const int32_t VERSION;
+
+                    /**
+                     * @param directory the directory of the snapshot files
+                     * @param mapName the name of the map
+                     * @return the path of the snapshot file of the map
+                     */
+                    static std::string getPath(const std::string &directory, const std::string &mapName);
+
+                    /**
+                     * Stores the first maxKeys keys.
+                     *
+                     * @throws IOException if the file can not be written
+                     */
+                    static void store(const std::string &path, const std::string &mapName,
+                                      const std::vector<serialization::pimpl::Data> &keys, size_t maxKeys);
+
+                    /**
+                     * Loads the first maxKeys keys of the snapshot.
+                     *
+                     * @return false if there is no snapshot, or if it has an other version or map name, or if it is
+                     * truncated
+                     */
+                    static bool load(const std::string &path, const std::string &mapName, size_t maxKeys,
+                                     std::vector<serialization::pimpl::Data> &keys);
+                };
+            }
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_MAP_IMPL_KEYSNAPSHOT_H_
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_MAP_IMPL_PRELOADERIMPL_H_
+#define HAZELCAST_CLIENT_MAP_IMPL_PRELOADERIMPL_H_
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <utility>
+#include <stdint.h>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/ConditionVariable.h"
+#include "hazelcast/util/AtomicBoolean.h"
+#include "hazelcast/util/Thread.h"
+#include "hazelcast/client/serialization/pimpl/Data.h"
+#include "hazelcast/client/config/PreloaderConfig.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace spi {
+            class ClientContext;
+        }
+
+        namespace connection {
+            class CallFuture;
+        }
+
+        namespace map {
+            namespace impl {
+                /**
+                 * Serialized form of a Preloader.
+                 *
+                 * The preload runs on a background thread. The keys of the snapshot are grouped per partition and
+                 * loaded in batches with MapGetAll calls to the owners of the partitions. Up to maxInFlightBatches
+                 * calls are pending at a time, the oldest one is completed before the next one is sent. While the
+                 * bytes sent and received are above the bandwidth budget, the next batch waits. Once the preload is
+                 * completed, the same thread stores the hot keys of the map periodically.
+                 *
+                 * The keys which are preloaded or stored are tracked, up to maxKeys. A hot key snapshot stores the
+                 * hot keys of the map first, then the tracked keys, since the profiler reports only its top K keys.
+                 */
+                class HAZELCAST_API PreloaderImpl {
+                public:
+                    typedef std::vector<std::pair<serialization::pimpl::Data, serialization::pimpl::Data> > Entries;
+
+                    class Listener {
+                    public:
+                        virtual ~Listener() {
+                        }
+
+                        virtual void entriesPreloaded(const Entries &entries) = 0;
+                    };
+
+                    PreloaderImpl(const std::string &mapName, spi::ClientContext &context,
+                                  const config::PreloaderConfig &config, Listener &listener);
+
+                    virtual ~PreloaderImpl();
+
+                    void storeSnapshot(const std::vector<serialization::pimpl::Data> &keys);
+
+                    bool storeHotKeySnapshot();
+
+                    bool awaitPreload(int64_t timeoutMillis);
+
+                    bool isPreloadCompleted();
+
+                    int64_t getPreloadedEntryCount();
+
+                    int64_t getFailedBatchCount();
+
+                    void close();
+
+                private:
+                    struct Batch {
+                        Batch(int partitionId, const std::vector<serialization::pimpl::Data> &keys);
+
+                        int partitionId;
+                        std::vector<serialization::pimpl::Data> keys;
+                    };
+
+                    PreloaderImpl(const PreloaderImpl &);
+
+                    PreloaderImpl &operator=(const PreloaderImpl &);
+
+                    static void staticRun(util::ThreadArgs &args);
+
+                    void run();
+
+                    void preload();
+
+                    void createBatches(std::vector<serialization::pimpl::Data> &keys, std::vector<Batch> &batches);
+
+                    /**
+                     * Waits until the bytes transferred so far are within the bandwidth budget.
+                     */
+                    void throttle(int64_t startTime, int64_t transferredBytes);
+
+                    /**
+                     * Waits for the response of a batch and passes its entries to the listener.
+                     *
+                     * @return the size of the response
+                     */
+                    int64_t complete(connection::CallFuture &future);
+
+                    void completePreload();
+
+                    void trackKeys(const Entries &entries);
+
+                    /**
+                     * Copying a Data moves its bytes out of the source, hence the tracked keys are deep copies which
+                     * leave the entries of the listener and the snapshot keys intact.
+                     */
+                    static serialization::pimpl::Data copy(const serialization::pimpl::Data &data);
+
+                    std::string mapName;
+                    std::string path;
+                    spi::ClientContext &context;
+                    int storeIntervalSeconds;
+                    size_t maxKeys;
+                    size_t batchSize;
+                    size_t maxInFlightBatches;
+                    int64_t maxBytesPerSecond;
+                    Listener &listener;
+
+                    util::Mutex lock;
+                    util::ConditionVariable preloadCompleted;
+                    bool completed;
+                    int64_t preloadedEntries;
+                    int64_t failedBatches;
+
+                    // serializes the writers of the snapshot file, guards the tracked keys
+                    util::Mutex storeLock;
+                    std::vector<serialization::pimpl::Data> trackedKeys;
+
+                    util::AtomicBoolean live;
+                    std::auto_ptr<util::Thread> thread;
+                };
+            }
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_MAP_IMPL_PRELOADERIMPL_H_
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef HAZELCAST_CLIENT_MAP_IMPL_QUERYCACHEINDEX_H_
+#define HAZELCAST_CLIENT_MAP_IMPL_QUERYCACHEINDEX_H_
+
+#include <map>
+#include <set>
+#include <vector>
+#include <memory>
+
+#include "hazelcast/client/map/AttributeExtractor.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            namespace impl {
+                template<typename K, typename V>
+                class QueryCacheIndex {
+                public:
+                    virtual ~QueryCacheIndex() {
+                    }
+
+                    virtual void insert(const K &key, const V &value) = 0;
+
+                    virtual void remove(const K &key, const V &value) = 0;
+
+                    virtual void clear() = 0;
+                };
+
+                /**
+                 * Keeps the keys of the cached entries sorted by an attribute of their values, hence serves both the
+                 * equality and the range lookups.
+                 */
+                template<typename K, typename V, typename A>
+                class AttributeIndex : public QueryCacheIndex<K, V> {
+                public:
+                    AttributeIndex(std::auto_ptr<AttributeExtractor<V, A> > attributeExtractor)
+                            : extractor(attributeExtractor) {
+                    }
+
+                    void insert(const K &key, const V &value) {
+                        index[extractor->extract(value)].insert(key);
+                    }
+
+                    void remove(const K &key, const V &value) {
+                        typename std::map<A, std::set<K> >::iterator it = index.find(extractor->extract(value));
+                        if (it == index.end()) {
+                            return;
+                        }
+
+                        it->second.erase(key);
+                        if (it->second.empty()) {
+                            index.erase(it);
+                        }
+                    }
+
+                    void clear() {
+                        index.clear();
+                    }
+
+                    /**
+                     * Appends the keys of the entries whose attribute is equal to the given value
+                     */
+                    void find(const A &value, std::vector<K> &keys) const {
+                        typename std::map<A, std::set<K> >::const_iterator it = index.find(value);
+                        if (it != index.end()) {
+                            keys.insert(keys.end(), it->second.begin(), it->second.end());
+                        }
+                    }
+
+                    /**
+                     * Appends the keys of the entries whose attribute is in [from, to], in the order of the attribute
+                     */
+                    void findBetween(const A &from, const A &to, std::vector<K> &keys) const {
+                        if (to < from) {
+                            return;
+                        }
+
+                        typename std::map<A, std::set<K> >::const_iterator end = index.upper_bound(to);
+                        for (typename std::map<A, std::set<K> >::const_iterator it = index.lower_bound(from);
+                             it != end; ++it) {
+                            keys.insert(keys.end(), it->second.begin(), it->second.end());
+                        }
+                    }
+
+                private:
+                    std::auto_ptr<AttributeExtractor<V, A> > extractor;
+                    std::map<A, std::set<K> > index;
+                };
+            }
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_MAP_IMPL_QUERYCACHEINDEX_H_
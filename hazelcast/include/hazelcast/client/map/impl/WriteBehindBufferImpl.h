@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_MAP_IMPL_WRITEBEHINDBUFFERIMPL_H_
+#define HAZELCAST_CLIENT_MAP_IMPL_WRITEBEHINDBUFFERIMPL_H_
+
+#include <map>
+#include <vector>
+#include <string>
+#include <memory>
+#include <stdint.h>
+#include <boost/shared_ptr.hpp>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/ConditionVariable.h"
+#include "hazelcast/util/AtomicBoolean.h"
+#include "hazelcast/util/Thread.h"
+#include "hazelcast/client/serialization/pimpl/Data.h"
+#include "hazelcast/client/config/WriteBehindConfig.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace spi {
+            class ClientContext;
+        }
+
+        namespace connection {
+            class CallFuture;
+        }
+
+        namespace map {
+            namespace impl {
+                /**
+                 * Serialized form of a WriteBehindBuffer.
+                 *
+                 * The updates are buffered per partition and keyed by the serialized key, hence an update replaces
+                 * the buffered value of its key. A partition buffer is sent with a single MapPutAll call once it is
+                 * older than the coalescing window or holds batchSize entries. At most one batch per partition is in
+                 * flight, so the batches of a partition are stored in order, and the values of the in flight batch
+                 * stay visible to get until the batch completes.
+                 */
+                class HAZELCAST_API WriteBehindBufferImpl {
+                public:
+                    WriteBehindBufferImpl(const std::string &mapName, spi::ClientContext &context,
+                                          const config::WriteBehindConfig &config);
+
+                    virtual ~WriteBehindBufferImpl();
+
+                    void set(const serialization::pimpl::Data &key, const serialization::pimpl::Data &value);
+
+                    /**
+                     * @return the buffered value of the key, the value in the map if the key is not buffered.
+                     */
+                    std::auto_ptr<serialization::pimpl::Data> get(const serialization::pimpl::Data &key);
+
+                    void flush();
+
+                    void close();
+
+                    int64_t getBufferedEntryCount();
+
+                    int64_t getCoalescedUpdateCount();
+
+                    int64_t getFailedEntryCount();
+
+                private:
+                    typedef std::map<std::vector<byte>, boost::shared_ptr<serialization::pimpl::Data> > Values;
+                    typedef std::vector<std::pair<serialization::pimpl::Data, serialization::pimpl::Data> > Entries;
+
+                    struct PartitionBuffer {
+                        PartitionBuffer();
+
+                        Values buffered;
+                        Values inFlight;
+                        int64_t creationTime;
+                    };
+
+                    class BatchCompletion;
+
+                    static void staticRunFlusher(util::ThreadArgs &args);
+
+                    static std::auto_ptr<std::vector<byte> > copy(const std::vector<byte> &bytes);
+
+                    void runFlusher();
+
+                    void checkOpen();
+
+                    /**
+                     * Moves the buffers which are older than the given time, all of them if olderThan is negative,
+                     * to in flight. The partitions with a batch in flight are skipped.
+                     */
+                    void takeBatches(int64_t olderThan, std::map<int, Entries> &batches);
+
+                    void takeBatch(int partitionId, PartitionBuffer &buffer, Entries &batch);
+
+                    void send(int partitionId, Entries &entries);
+
+                    void onBatchCompleted(int partitionId, int32_t entryCount, connection::CallFuture *future);
+
+                    std::string mapName;
+                    spi::ClientContext &context;
+                    int coalescingWindowMillis;
+                    size_t batchSize;
+                    size_t maxBufferedEntries;
+                    config::WriteBehindConfig::OverflowPolicy overflowPolicy;
+
+                    util::Mutex lock;
+                    util::ConditionVariable stateChanged;
+                    std::map<int, PartitionBuffer> partitions;
+                    size_t bufferedEntries;
+                    int inFlightBatches;
+                    bool overflowed;
+                    int64_t coalescedUpdates;
+                    int64_t failedEntries;
+
+                    util::AtomicBoolean live;
+                    std::auto_ptr<util::Thread> flushThread;
+                };
+            }
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_MAP_IMPL_WRITEBEHINDBUFFERIMPL_H_
@@ -439,6 +439,27 @@ namespace hazelcast {
                 //Builder function
                 void append(const ClientMessage *msg);
 
+                /**
+                 * Writes the header of a fragment frame carrying length bytes of the payload of this message. The
+                 * fragment has the same correlation id, message type and partition id as this message. The first
+                 * fragment (BEGIN_FLAG) keeps the complete header of this message. The payload of the fragment is
+                 * written from the buffer of this message, hence it is never copied.
+                 *
+                 * @param header the buffer to write into, it should have room for getDataOffset() bytes
+                 * @param length number of payload bytes in the fragment
+                 * @param fragmentFlags BEGIN_FLAG, END_FLAG or 0 for an intermediate fragment
+                 * @return the length of the fragment header
+                 */
+                int32_t writeFragmentHeader(byte *header, int32_t length, uint8_t fragmentFlags) const;
+
+                /**
+                 * Reassembles the fragments of a message into a single message. The header is taken from the first
+                 * fragment and the buffer is allocated only once.
+                 *
+                 * @param fragments the fragments in the order they are received, starting with the BEGIN fragment
+                 */
+                static std::auto_ptr<ClientMessage> merge(const std::vector<ClientMessage *> &fragments);
+
                 int32_t getDataSize() const;
 
                 bool isRetryable() const;
@@ -453,6 +474,13 @@ namespace hazelcast {
                  * Returns the number of bytes sent on the socket
                  **/
                 int32_t writeTo(Socket &socket, int32_t offset, int32_t frameLen);
+
+                /**
+                 * Reads the bytes of the frame starting at offset directly from the socket into the message buffer.
+                 *
+                 * Returns the number of bytes read from the socket
+                 **/
+                int32_t readFrom(Socket &socket, int32_t offset, int32_t frameLen);
             private:
                 ClientMessage(int32_t size);
 
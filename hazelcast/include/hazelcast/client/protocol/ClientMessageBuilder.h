@@ -29,6 +29,7 @@
 
 #include <map>
 #include <list>
+#include <vector>
 #include <stdint.h>
 #include <memory>
 
@@ -37,6 +38,8 @@ namespace hazelcast {
         class ByteBuffer;
     }
     namespace client {
+        class Socket;
+
         namespace connection {
             class Connection;
         }
@@ -47,21 +50,68 @@ namespace hazelcast {
             class ClientMessageBuilder {
 
             public:
+                /**
+                 * Receives the messages completed by the builder.
+                 */
+                class MessageConsumer {
+                public:
+                    virtual ~MessageConsumer() {
+                    }
+
+                    virtual void onMessage(std::auto_ptr<ClientMessage> message) = 0;
+                };
+
+                /**
+                 * The completed messages are passed to the service together with the connection they are read from.
+                 */
                 ClientMessageBuilder(IMessageHandler &service, connection::Connection &connection);
 
+                ClientMessageBuilder(MessageConsumer &consumer);
+
                 virtual ~ClientMessageBuilder();
 
                 /**
-                * @returns true if message is completed, false otherwise
+                * @returns true if a complete frame (a message or a message fragment) is consumed from the buffer,
+                * false otherwise
                 */
                 bool onData(util::ByteBuffer &buffer);
 
+                /**
+                * Reads the rest of the frame being built directly from the socket into the frame buffer, without
+                * copying it through a staging buffer.
+                *
+                * @returns true if the frame is completed, false otherwise
+                */
+                bool onData(Socket &socket);
+
+                /**
+                * @returns the number of bytes missing to complete the frame being built, 0 if no frame is being built
+                */
+                int32_t getRemainingFrameLength() const;
+
                 /**
                  * Reset the builder so that the message is null pointer
                  */
                 void reset();
 
             private:
+                class HandlerConsumer : public MessageConsumer {
+                public:
+                    HandlerConsumer(IMessageHandler &messageHandler, connection::Connection &connection);
+
+                    virtual void onMessage(std::auto_ptr<ClientMessage> message);
+
+                private:
+                    IMessageHandler &messageHandler;
+                    connection::Connection &connection;
+                };
+
+                ClientMessageBuilder(const ClientMessageBuilder &);
+
+                ClientMessageBuilder &operator=(const ClientMessageBuilder &);
+
+                void onFrameCompleted();
+
                 void addToPartialMessages(std::auto_ptr<ClientMessage> message);
 
                 /**
@@ -69,7 +119,9 @@ namespace hazelcast {
                 */
                 bool appendExistingPartialMessage(std::auto_ptr<ClientMessage> message);
 
-                typedef std::map<int64_t, ClientMessage * > MessageMap;
+                static void deleteFragments(std::vector<ClientMessage *> &fragments);
+
+                typedef std::map<int64_t, std::vector<ClientMessage *> > MessageMap;
 
                 MessageMap partialMessages;
 
@@ -77,8 +129,8 @@ namespace hazelcast {
 
                 std::auto_ptr<ClientMessage> message;
 
-                IMessageHandler &messageHandler;
-                connection::Connection &connection;
+                std::auto_ptr<HandlerConsumer> handlerConsumer;
+                MessageConsumer &consumer;
 
                 int32_t frameLen;
                 int32_t offset;
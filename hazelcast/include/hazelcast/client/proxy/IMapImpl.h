@@ -17,6 +17,7 @@
 #define HAZELCAST_IMAP_IMPL
 
 #include "hazelcast/client/EntryArray.h"
+#include "hazelcast/client/impl/EntryArrayImpl.h"
 #include "hazelcast/client/query/PagingPredicate.h"
 #include "hazelcast/client/query/Predicate.h"
 #include "hazelcast/client/protocol/codec/MapExecuteWithPredicateCodec.h"
@@ -42,6 +43,8 @@ namespace hazelcast {
 
                 std::auto_ptr<serialization::pimpl::Data> getData(const serialization::pimpl::Data& key);
 
+                connection::CallFuture getAsyncData(const serialization::pimpl::Data& key);
+
                 std::auto_ptr<serialization::pimpl::Data> removeData(const serialization::pimpl::Data& key);
 
                 bool remove(const serialization::pimpl::Data& key, const serialization::pimpl::Data& value);
@@ -167,6 +170,51 @@ namespace hazelcast {
                     return response;
                 }
 
+                /**
+                 * @return the entries of the paging query for the current page of the predicate
+                 */
+                template <typename K, typename V>
+                EntryVector pagingPredicateData(query::PagingPredicate<K, V> &predicate,
+                                                query::IterationType iterationType) {
+                    EntryVector result;
+                    switch (iterationType) {
+                        case query::KEY: {
+                            std::vector<serialization::pimpl::Data> keys = keySetForPagingPredicateData(predicate);
+                            for (std::vector<serialization::pimpl::Data>::iterator it = keys.begin(); it != keys.end(); ++it) {
+                                result.push_back(std::pair<serialization::pimpl::Data, serialization::pimpl::Data>(
+                                        *it, serialization::pimpl::Data()));
+                            }
+                            return result;
+                        }
+                        case query::VALUE:
+                            return valuesForPagingPredicateData(predicate);
+                        default:
+                            return entrySetForPagingPredicateData(predicate);
+                    }
+                }
+
+                /**
+                 * Orders the entries only up to the end of the requested page and updates the anchors.
+                 *
+                 * @return the range of the requested page in the entries
+                 */
+                template <typename K, typename V>
+                std::pair<size_t, size_t> sortPage(client::impl::EntryArrayImpl<K, V> &entries,
+                                                   query::PagingPredicate<K, V> &predicate,
+                                                   query::IterationType iterationType) {
+                    // the result holds the pages after the nearest anchor up to the requested page
+                    const std::pair<size_t, std::pair<K *, V *> > *nearestAnchorEntry = predicate.getNearestAnchorEntry();
+                    size_t firstPage = (NULL == nearestAnchorEntry ? 0 : nearestAnchorEntry->first + 1);
+                    size_t sortedCount = predicate.getPageSize() * (predicate.getPage() - firstPage + 1);
+                    if (sortedCount > entries.size()) {
+                        sortedCount = entries.size();
+                    }
+
+                    entries.partialSort(iterationType, predicate.getComparator(), sortedCount);
+
+                    return updateAnchor<K, V>(entries, predicate, iterationType);
+                }
+
                 template <typename K, typename V>
                 std::pair<size_t, size_t> updateAnchor(EntryArray<K, V> &entries,
                                                  query::PagingPredicate<K, V> &predicate,
@@ -17,6 +17,7 @@
 #define HAZELCAST_IQUEUE_IMPL
 
 #include "hazelcast/client/proxy/ProxyImpl.h"
+#include "hazelcast/client/serialization/pimpl/Data.h"
 #include <vector>
 #include <boost/shared_ptr.hpp>
 
@@ -66,6 +67,12 @@ namespace hazelcast {
 
                 void clear();
             private:
+                /**
+                * Returns the partition of the queue and records the operation for the hot key profiler.
+                */
+                int getQueuePartitionId();
+
+                serialization::pimpl::Data nameData;
                 int partitionId;
             };
         }
@@ -111,12 +111,38 @@ namespace hazelcast {
                 std::string registerListener(std::auto_ptr<protocol::codec::IAddListenerCodec> addListenerCodec,
                                              impl::BaseEventHandler *handler);
 
+                /**
+                * Internal API.
+                *
+                * @return true if the listeners which are not key based should be registered as member local listeners
+                * on every member.
+                */
+                bool isSmartListenerRegistration() const;
+
                 /**
                 * Internal API.
                 * @param key
                 */
                 int getPartitionId(const serialization::pimpl::Data &key);
 
+                /**
+                * Internal API.
+                * Returns the partition id of the key of an operation and records the operation for the hot key
+                * profiler.
+                *
+                * @param key
+                */
+                int getKeyPartitionId(const serialization::pimpl::Data &key);
+
+                /**
+                * Internal API.
+                * Records an operation on the key for the hot key profiler.
+                *
+                * @param key
+                * @param partitionId the partition of the key
+                */
+                void recordKeyAccess(const serialization::pimpl::Data &key, int partitionId);
+
                 template<typename T>
                 serialization::pimpl::Data toData(const T &object) {
                     return context->getSerializationService().template toData<T>(&object);
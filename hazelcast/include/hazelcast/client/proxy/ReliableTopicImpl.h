@@ -29,7 +29,10 @@
 #include "hazelcast/client/protocol/ClientProtocolErrorCodes.h"
 #include "hazelcast/client/impl/ExecutionCallback.h"
 #include "hazelcast/client/topic/impl/reliable/ReliableTopicExecutor.h"
+#include "hazelcast/client/topic/impl/reliable/ReliableTopicPublisher.h"
+#include "hazelcast/client/topic/PublishFuture.h"
 #include "hazelcast/client/config/ReliableTopicConfig.h"
+#include "hazelcast/util/Mutex.h"
 
 #include <boost/shared_ptr.hpp>
 
@@ -45,16 +48,31 @@ namespace hazelcast {
     namespace client {
         namespace proxy {
             class HAZELCAST_API ReliableTopicImpl : public proxy::ProxyImpl {
+            public:
+                virtual ~ReliableTopicImpl();
+
             protected:
                 ReliableTopicImpl(const std::string &instanceName, spi::ClientContext *context,
                                   boost::shared_ptr<Ringbuffer<topic::impl::reliable::ReliableTopicMessage> > rb);
 
                 void publish(const serialization::pimpl::Data &data);
 
+                topic::PublishFuture publishAsync(const serialization::pimpl::Data &data);
+
             protected:
                 boost::shared_ptr<Ringbuffer<topic::impl::reliable::ReliableTopicMessage> > ringbuffer;
                 util::ILogger &logger;
                 const config::ReliableTopicConfig *config;
+
+            private:
+                /**
+                 * @return the publisher of the topic, created by the first publish call
+                 */
+                topic::impl::reliable::ReliableTopicPublisher &getPublisher();
+
+                util::Mutex publisherLock;
+                // shared with the calls in flight, which may complete after the topic is destroyed
+                boost::shared_ptr<topic::impl::reliable::ReliableTopicPublisher> topicPublisher;
             };
         }
     }
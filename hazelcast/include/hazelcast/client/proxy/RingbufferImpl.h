@@ -29,6 +29,9 @@
 #include "hazelcast/client/protocol/codec/RingbufferHeadSequenceCodec.h"
 #include "hazelcast/client/protocol/codec/RingbufferRemainingCapacityCodec.h"
 #include "hazelcast/client/protocol/codec/RingbufferAddCodec.h"
+#include "hazelcast/client/protocol/codec/RingbufferAddAllCodec.h"
+#include "hazelcast/client/exception/IllegalArgumentException.h"
+#include "hazelcast/util/IOUtil.h"
 #include "hazelcast/client/proxy/ProxyImpl.h"
 #include "hazelcast/util/Atomic.h"
 #include "hazelcast/client/Ringbuffer.h"
@@ -90,7 +93,7 @@ namespace hazelcast {
                 int64_t add(const E &item) {
                     serialization::pimpl::Data itemData = toData<E>(item);
                     std::auto_ptr<protocol::ClientMessage> msg = protocol::codec::RingbufferAddCodec::RequestParameters::encode(
-                            getName(), OVERWRITE, itemData);
+                            getName(), ringbuffer::OVERWRITE, itemData);
                     return invokeAndGetResult<int64_t, protocol::codec::RingbufferAddCodec::ResponseParameters>(msg, partitionId);
                 }
 
@@ -105,18 +108,44 @@ namespace hazelcast {
                     return toObject<E>(itemData);
                 }
 
-                connection::CallFuture readManyAsync(int64_t sequence, int32_t maxCount, time_t timeoutSeconds) {
-                    std::auto_ptr<protocol::ClientMessage> msg = protocol::codec::RingbufferReadManyCodec::RequestParameters::encode(
-                            getName(), sequence, 1, maxCount, (const serialization::pimpl::Data *)NULL);
+                Future<int64_t> addAllAsync(const std::vector<E> &items, ringbuffer::OverflowPolicy overflowPolicy) {
+                    if (items.empty()) {
+                        throw exception::IllegalArgumentException("RingbufferImpl::addAllAsync",
+                                                                  "items can't be empty");
+                    }
+                    if (items.size() > (size_t) Ringbuffer<E>::MAX_BATCH_SIZE) {
+                        throw exception::IllegalArgumentException("RingbufferImpl::addAllAsync",
+                                                                  "items can't be larger than " +
+                                                                  util::IOUtil::to_string<int32_t>(
+                                                                          Ringbuffer<E>::MAX_BATCH_SIZE));
+                    }
 
-                    return invokeAndGetFuture(msg, partitionId);
+                    std::auto_ptr<protocol::ClientMessage> msg = protocol::codec::RingbufferAddAllCodec::RequestParameters::encode(
+                            getName(), toDataCollection<E>(items), overflowPolicy);
+
+                    return Future<int64_t>(invokeAndGetFuture(msg, partitionId), context->getSerializationService(),
+                                           decodeAddAllResponse);
                 }
 
-                std::auto_ptr<DataArray<E> > getReadManyAsyncResponseObject(std::auto_ptr<protocol::ClientMessage> responseMsg) {
-                    protocol::codec::RingbufferReadManyCodec::ResponseParameters responseParameters =
-                            protocol::codec::RingbufferReadManyCodec::ResponseParameters::decode(*responseMsg);
-                    return std::auto_ptr<DataArray<E> >(new impl::DataArrayImpl<E>(responseParameters.items,
-                                                                            context->getSerializationService()));
+                Future<ringbuffer::ReadResultSet<E> > readManyAsync(int64_t startSequence, int32_t minCount,
+                                                                   int32_t maxCount,
+                                                                   const serialization::IdentifiedDataSerializable *filter = NULL) {
+                    checkReadManyArguments(startSequence, minCount, maxCount);
+
+                    std::auto_ptr<protocol::ClientMessage> msg;
+                    if (NULL == filter) {
+                        msg = protocol::codec::RingbufferReadManyCodec::RequestParameters::encode(
+                                getName(), startSequence, minCount, maxCount, (const serialization::pimpl::Data *) NULL);
+                    } else {
+                        serialization::pimpl::Data filterData = toData<serialization::IdentifiedDataSerializable>(
+                                *filter);
+                        msg = protocol::codec::RingbufferReadManyCodec::RequestParameters::encode(
+                                getName(), startSequence, minCount, maxCount, &filterData);
+                    }
+
+                    return Future<ringbuffer::ReadResultSet<E> >(invokeAndGetFuture(msg, partitionId),
+                                                                context->getSerializationService(),
+                                                                decodeReadManyResponse);
                 }
 
                 const std::string& getServiceName() const {
@@ -132,27 +161,40 @@ namespace hazelcast {
                 }
                 /***************** RingBuffer<E> interface implementation ends here ***********************************/
             private:
-                /**
-                 * Using this policy one can control the behavior what should to be done when an item is about to be added to the ringbuffer,
-                 * but there is 0 remaining capacity.
-                 *
-                 * Overflowing happens when a time-to-live is set and the oldest item in the ringbuffer (the head) is not old enough to expire.
-                 *
-                 * @see Ringbuffer#addAsync(Object, OverflowPolicy)
-                 * @see Ringbuffer#addAllAsync(java.util.Collection, OverflowPolicy)
-                 */
-                enum OverflowPolicy {
-
-                    /**
-                     * Using this policy the oldest item is overwritten no matter it is not old enough to retire. Using this policy you are
-                     * sacrificing the time-to-live in favor of being able to write.
-                     *
-                     * Example: if there is a time-to-live of 30 seconds, the buffer is full and the oldest item in the ring has been placed a
-                     * second ago, then there are 29 seconds remaining for that item. Using this policy you are going to overwrite no matter
-                     * what.
-                     */
-                     OVERWRITE = 0
-                };
+                static std::auto_ptr<int64_t> decodeAddAllResponse(protocol::ClientMessage &response,
+                                                                   serialization::pimpl::SerializationService &) {
+                    return std::auto_ptr<int64_t>(new int64_t(
+                            protocol::codec::RingbufferAddAllCodec::ResponseParameters::decode(response).response));
+                }
+
+                static std::auto_ptr<ringbuffer::ReadResultSet<E> > decodeReadManyResponse(
+                        protocol::ClientMessage &response, serialization::pimpl::SerializationService &service) {
+                    protocol::codec::RingbufferReadManyCodec::ResponseParameters responseParameters =
+                            protocol::codec::RingbufferReadManyCodec::ResponseParameters::decode(response);
+                    return std::auto_ptr<ringbuffer::ReadResultSet<E> >(new ringbuffer::ReadResultSet<E>(
+                            responseParameters.readCount, responseParameters.items, service));
+                }
+
+                static void checkReadManyArguments(int64_t startSequence, int32_t minCount, int32_t maxCount) {
+                    if (startSequence < 0) {
+                        throw exception::IllegalArgumentException("RingbufferImpl::readManyAsync",
+                                                                  "sequence can't be smaller than 0");
+                    }
+                    if (minCount < 0) {
+                        throw exception::IllegalArgumentException("RingbufferImpl::readManyAsync",
+                                                                  "minCount can't be smaller than 0");
+                    }
+                    if (maxCount < minCount) {
+                        throw exception::IllegalArgumentException("RingbufferImpl::readManyAsync",
+                                                                  "maxCount should be equal or larger than minCount");
+                    }
+                    if (maxCount > Ringbuffer<E>::MAX_BATCH_SIZE) {
+                        throw exception::IllegalArgumentException("RingbufferImpl::readManyAsync",
+                                                                  "maxCount can't be larger than " +
+                                                                  util::IOUtil::to_string<int32_t>(
+                                                                          Ringbuffer<E>::MAX_BATCH_SIZE));
+                    }
+                }
 
                 int32_t partitionId;
                 util::Atomic<int64_t> bufferCapacity;
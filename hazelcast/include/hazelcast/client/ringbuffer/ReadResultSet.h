@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_RINGBUFFER_READRESULTSET_H_
+#define HAZELCAST_CLIENT_RINGBUFFER_READRESULTSET_H_
+
+#include <vector>
+#include <stdint.h>
+
+#include "hazelcast/client/impl/DataArrayImpl.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace ringbuffer {
+            /**
+             * The result of a Ringbuffer#readManyAsync operation. The items are deserialized lazily when they are
+             * accessed.
+             *
+             * @param <E> type of the items in the ringbuffer
+             */
+            template<typename E>
+            class ReadResultSet : public impl::DataArrayImpl<E> {
+            public:
+                /**
+                 * Internal API. Constructor
+                 */
+                ReadResultSet(int32_t readCount, const std::vector<serialization::pimpl::Data> &items,
+                              serialization::pimpl::SerializationService &serializationService)
+                : impl::DataArrayImpl<E>(items, serializationService)
+                , readCount(readCount) {
+                }
+
+                /**
+                 * Returns the number of items that have been read before filtering.
+                 *
+                 * If no filter is set, then the readCount will be equal to size(). But if a filter is applied, it
+                 * could be that items are read, but are filtered out. So if you are trying to make another read based
+                 * on the ReadResultSet then you should increment the sequence by readCount and not by size().
+                 * Otherwise you will be re-reading the same filtered messages.
+                 *
+                 * @return the number of items read (including the filtered ones).
+                 */
+                int32_t getReadCount() const {
+                    return readCount;
+                }
+
+            private:
+                int32_t readCount;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_RINGBUFFER_READRESULTSET_H_
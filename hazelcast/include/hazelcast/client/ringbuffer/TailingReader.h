@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_RINGBUFFER_TAILINGREADER_H_
+#define HAZELCAST_CLIENT_RINGBUFFER_TAILINGREADER_H_
+
+#include <memory>
+#include <stdint.h>
+
+#include "hazelcast/client/Ringbuffer.h"
+#include "hazelcast/client/Future.h"
+#include "hazelcast/client/ringbuffer/ReadResultSet.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace ringbuffer {
+            /**
+             * Reads a ringbuffer continuously in batches, starting from a given sequence.
+             *
+             * The reader keeps the read of the next batch in flight while the caller processes the current batch:
+             * as soon as a batch is returned by next(), the read of the following batch is sent to the cluster. Hence
+             * the throughput is bound by the network bandwidth instead of the round trip time.
+             *
+             * A TailingReader is not thread-safe.
+             *
+             * Example:
+             * <code>
+             * TailingReader&lt;Event&gt; reader(*ringbuffer, ringbuffer->headSequence());
+             * while (running) {
+             *     std::auto_ptr&lt;ReadResultSet&lt;Event&gt; &gt; batch = reader.next();
+             *     for (size_t i = 0; i &lt; batch->size(); ++i) {
+             *         process(batch->get(i));
+             *     }
+             * }
+             * </code>
+             *
+             * @param <E> type of the items in the ringbuffer
+             */
+            template<typename E>
+            class TailingReader {
+            public:
+                /**
+                 * @param ringbuffer the ringbuffer to read. It should live longer than the reader.
+                 * @param startSequence the sequence of the first item to read
+                 * @param maxBatchSize the maximum number of items returned by a single next() call, at most
+                 *                     Ringbuffer::MAX_BATCH_SIZE
+                 * @param filter an optional server side filter, see Ringbuffer#readManyAsync. It should live longer
+                 *               than the reader.
+                 */
+                TailingReader(Ringbuffer<E> &ringbuffer, int64_t startSequence,
+                              int32_t maxBatchSize = Ringbuffer<E>::MAX_BATCH_SIZE,
+                              const serialization::IdentifiedDataSerializable *filter = NULL)
+                : ringbuffer(ringbuffer)
+                , sequence(startSequence)
+                , maxBatchSize(maxBatchSize)
+                , filter(filter) {
+                }
+
+                /**
+                 * Returns the next batch of items, waiting until at least one item is available. The read of the
+                 * following batch is started before returning.
+                 *
+                 * If the read fails, e.g. with a StaleSequenceException since the items at the current sequence are
+                 * already overwritten, the exception is thrown and the next call retries the read from the current
+                 * sequence. Use setSequence to continue from another sequence.
+                 *
+                 * @return the next batch of items, never empty unless a filter is set.
+                 */
+                std::auto_ptr<ReadResultSet<E> > next() {
+                    if (NULL == pendingRead.get()) {
+                        readNext();
+                    }
+
+                    std::auto_ptr<ReadResultSet<E> > result;
+                    try {
+                        result = pendingRead->get();
+                    } catch (...) {
+                        pendingRead.reset();
+                        throw;
+                    }
+
+                    sequence += result->getReadCount();
+                    readNext();
+                    return result;
+                }
+
+                /**
+                 * @return the sequence of the next item to be returned by next()
+                 */
+                int64_t getSequence() const {
+                    return sequence;
+                }
+
+                /**
+                 * Sets the sequence of the next item to be read. The read in flight, if any, is discarded.
+                 *
+                 * @param newSequence the sequence of the next item to be read
+                 */
+                void setSequence(int64_t newSequence) {
+                    pendingRead.reset();
+                    sequence = newSequence;
+                }
+
+            private:
+                void readNext() {
+                    pendingRead.reset(new Future<ReadResultSet<E> >(
+                            ringbuffer.readManyAsync(sequence, 1, maxBatchSize, filter)));
+                }
+
+                Ringbuffer<E> &ringbuffer;
+                int64_t sequence;
+                int32_t maxBatchSize;
+                const serialization::IdentifiedDataSerializable *filter;
+                std::auto_ptr<Future<ReadResultSet<E> > > pendingRead;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_RINGBUFFER_TAILINGREADER_H_
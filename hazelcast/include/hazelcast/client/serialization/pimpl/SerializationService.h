@@ -39,6 +39,7 @@
 #include "hazelcast/client/serialization/pimpl/SerializationConstants.h"
 #include "hazelcast/util/IOUtil.h"
 #include "hazelcast/util/ByteBuffer.h"
+#include "hazelcast/client/PartitionAware.h"
 #include <boost/shared_ptr.hpp>
 #include <string>
 #include <list>
@@ -75,7 +76,7 @@ namespace hazelcast {
 
                         ObjectDataOutput dataOutput(output, portableContext);
 
-                        writeHash(output);
+                        writeHash<T>(object, output);
 
                         dataOutput.writeObject<T>(object);
 
@@ -121,6 +122,30 @@ namespace hazelcast {
                     bool isNullData(const Data &data);
 
                     void writeHash(DataOutput &out);
+
+                    /**
+                     * Writes the partition hash of the partition key for PartitionAware objects. If the object does
+                     * not provide a partition key, the hash is left as 0 and it is calculated from the payload.
+                     */
+                    template<typename T>
+                    inline void writeHash(const PartitionAwareMarker *object, DataOutput &out) {
+                        typedef typename T::KEY_TYPE PK_TYPE;
+                        const PartitionAware<PK_TYPE> *partitionAwareObject =
+                                static_cast<const PartitionAware<PK_TYPE> *>(object);
+                        const PK_TYPE *partitionKey = partitionAwareObject->getPartitionKey();
+                        if (NULL == partitionKey) {
+                            writeHash(out);
+                            return;
+                        }
+
+                        Data partitionKeyData = toData<PK_TYPE>(partitionKey);
+                        out.writeInt(partitionKeyData.getPartitionHash());
+                    }
+
+                    template<typename T>
+                    inline void writeHash(const void *object, DataOutput &out) {
+                        writeHash(out);
+                    }
                 };
 
                 template<>
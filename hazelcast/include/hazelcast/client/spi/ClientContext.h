@@ -41,6 +41,22 @@ namespace hazelcast {
             class ConnectionManager;
         }
 
+        namespace impl {
+            class DeserializationExecutor;
+
+            class HotKeyProfiler;
+
+            class BatchEventFlusher;
+        }
+
+        namespace topic {
+            namespace impl {
+                namespace reliable {
+                    class ReliableTopicExecutor;
+                }
+            }
+        }
+
         namespace spi {
             class InvocationService;
 
@@ -77,6 +93,14 @@ namespace hazelcast {
 
                 Cluster &getCluster();
 
+                topic::impl::reliable::ReliableTopicExecutor &getReliableTopicExecutor();
+
+                client::impl::DeserializationExecutor &getDeserializationExecutor();
+
+                client::impl::HotKeyProfiler &getHotKeyProfiler();
+
+                client::impl::BatchEventFlusher &getBatchEventFlusher();
+
             private:
                 HazelcastClient &hazelcastClient;
             };
@@ -22,6 +22,7 @@
 #define HAZELCAST_CLUSTER_SERVICE
 
 #include "hazelcast/client/connection/ClusterListenerThread.h"
+#include "hazelcast/client/connection/ParallelConnector.h"
 #include "hazelcast/util/Mutex.h"
 #include "hazelcast/util/LockGuard.h"
 #include <set>
@@ -83,6 +84,16 @@ namespace hazelcast {
                 std::vector<Member> getMemberList();
 
                 std::string membersString();
+
+                /**
+                 * @return the connection to the member at the address if the client is connected to it, NULL otherwise
+                 */
+                boost::shared_ptr<connection::Connection> getConnection(const Address &address);
+
+                /**
+                 * @return the connections of the connected stripes to the member at the address
+                 */
+                std::vector<boost::shared_ptr<connection::Connection> > getConnections(const Address &address);
             private:
                 ClientContext &clientContext;
 
@@ -96,6 +107,12 @@ namespace hazelcast {
 
                 util::AtomicBoolean active;
 
+                /**
+                 * The connector of the last owner connection round. It is kept until the next round, so that the
+                 * owner connection is not delayed by the attempts to the unreachable addresses.
+                 */
+                std::auto_ptr<connection::ParallelConnector> ownerConnector;
+
                 void initMembershipListeners();
 
                 std::vector<Address> findServerAddressesToConnect(const Address *previousConnectionAddr) const;
@@ -107,6 +124,9 @@ namespace hazelcast {
 
                 void setMembers(std::auto_ptr<std::map<Address, Member, addressComparator> > map);
                 boost::shared_ptr<connection::Connection> connectToOne(const Address *previousConnectionAddr);
+
+                boost::shared_ptr<connection::Connection> connectToAny(const std::vector<Address> &addresses,
+                                                                       std::string &lastError);
                 // ------------------------------------------------------
             };
 
@@ -24,6 +24,7 @@
 #include "hazelcast/client/protocol/IMessageHandler.h"
 #include "hazelcast/util/AtomicBoolean.h"
 #include "hazelcast/client/protocol/ClientExceptionFactory.h"
+#include "hazelcast/client/spi/impl/AdmissionController.h"
 
 #include <boost/shared_ptr.hpp>
 #include <stdint.h>
@@ -102,6 +103,8 @@ namespace hazelcast {
 
                 int getRetryCount() const;
 
+                impl::AdmissionController &getAdmissionController();
+
                 void handleMessage(connection::Connection &connection, std::auto_ptr<protocol::ClientMessage> message);
 
                 /**
@@ -139,6 +142,7 @@ namespace hazelcast {
                 int retryWaitTime;
                 int retryCount;
                 spi::ClientContext& clientContext;
+                impl::AdmissionController admissionController;
                 // Is not using the Connection* for the key due to a possible ABA problem.
                 util::SynchronizedMap<int , util::SynchronizedMap<int64_t, connection::CallPromise > > callPromises;
                 util::SynchronizedMap<int, util::SynchronizedMap<int64_t, connection::CallPromise > > eventHandlerPromises;
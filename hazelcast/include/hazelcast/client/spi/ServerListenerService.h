@@ -27,6 +27,8 @@
 #include "hazelcast/client/protocol/ClientMessage.h"
 #include "hazelcast/util/SynchronizedMap.h"
 #include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/ThreadArgs.h"
+#include "hazelcast/util/Mutex.h"
 
 #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
 #pragma warning(push)
@@ -34,7 +36,13 @@
 #endif
 
 namespace hazelcast {
+    namespace util {
+        class Thread;
+    }
+
     namespace client {
+        class Address;
+
         namespace impl {
             class ClientRequest;
 
@@ -68,6 +76,8 @@ namespace hazelcast {
             namespace impl {
                 namespace listener {
                     class EventRegistration;
+
+                    class SmartListenerRegistration;
                 }
             }
 
@@ -75,6 +85,26 @@ namespace hazelcast {
             public:
                 ServerListenerService(spi::ClientContext &clientContext);
 
+                /**
+                 * Starts the thread which keeps the smart listener registrations in sync with the cluster members.
+                 * Does nothing if smart listener registration is not enabled.
+                 */
+                void start();
+
+                void shutdown();
+
+                /**
+                 * @return true if the listeners which are not key based are registered on every member as member
+                 * local registrations.
+                 */
+                bool isSmartListenerRegistration() const;
+
+                /**
+                 * Wakes up the smart listener registration thread so that the registrations are renewed for the
+                 * current members.
+                 */
+                void wakeup();
+
                 std::string registerListener(std::auto_ptr<protocol::codec::IAddListenerCodec> addListenerCodec,
                                              int partitionId, client::impl::BaseEventHandler *handler);
 
@@ -98,8 +128,31 @@ namespace hazelcast {
                 util::SynchronizedMap<std::string, const std::string > registrationAliasMap;
                 spi::ClientContext &clientContext;
 
+                bool smartListenerRegistration;
+                std::auto_ptr<util::Thread> smartListenerThread;
+
                 std::string registerInternal(std::auto_ptr<protocol::codec::IAddListenerCodec> &addListenerCodec,
                                              hazelcast::client::connection::CallFuture &future);
+
+                std::string registerSmartListener(std::auto_ptr<protocol::codec::IAddListenerCodec> &addListenerCodec,
+                                                  client::impl::BaseEventHandler *handler);
+
+                /**
+                 * @return the server side registration id, empty if the registration is already de-registered
+                 */
+                std::string registerOnMember(impl::listener::SmartListenerRegistration &registration,
+                                             const Address &member);
+
+                bool deRegisterSmartListener(impl::listener::SmartListenerRegistration &registration,
+                                             protocol::codec::IRemoveListenerCodec &removeListenerCodec);
+
+                bool removeSmartMemberRegistration(int64_t correlationId);
+
+                void syncSmartListenerRegistrations();
+
+                static void staticRunSmartListenerSync(util::ThreadArgs &args);
+
+                void runSmartListenerSync(util::Thread *currentThread);
             };
         }
     }
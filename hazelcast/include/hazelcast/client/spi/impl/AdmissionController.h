@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_SPI_IMPL_ADMISSIONCONTROLLER_H_
+#define HAZELCAST_CLIENT_SPI_IMPL_ADMISSIONCONTROLLER_H_
+
+#include <stdint.h>
+#include <string>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/ConditionVariable.h"
+#include "hazelcast/client/InvocationAdmissionStats.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        class ClientProperties;
+
+        namespace connection {
+            class Connection;
+        }
+
+        namespace spi {
+            namespace impl {
+                /**
+                 * Bounds the outstanding invocations of the client. An invocation is admitted before it is sent and
+                 * released when it is completed, a resent invocation keeps its admission. The limits are the number
+                 * of outstanding invocations of the client, the number of pending invocations of the target
+                 * connection and the number of bytes queued on the target connection.
+                 */
+                class HAZELCAST_API AdmissionController {
+                public:
+                    enum Policy {
+                        BLOCK,
+                        FAIL_FAST,
+                        CALLER_RUNS
+                    };
+
+                    AdmissionController(const ClientProperties &properties);
+
+                    /**
+                     * @return true if any of the limits is configured
+                     */
+                    bool isEnabled() const;
+
+                    /**
+                     * Admits an invocation to be sent over the connection. The admitted invocation shall be released
+                     * when it is completed.
+                     *
+                     * @return true if the invocation exceeds a limit and the caller shall wait for its response
+                     * before returning, see CALLER_RUNS
+                     * @throws HazelcastOverloadException if the invocation exceeds a limit and can not be admitted
+                     */
+                    bool acquire(connection::Connection &connection);
+
+                    void release();
+
+                    /**
+                     * Records the time a caller waited for the response of an invocation admitted with CALLER_RUNS.
+                     */
+                    void recordWait(int64_t waitMillis);
+
+                    int64_t getTimeoutMillis() const;
+
+                    InvocationAdmissionStats getStats();
+
+                private:
+                    bool isOverloaded(connection::Connection &connection) const;
+
+                    void recordWaitInternal(int64_t waitMillis);
+
+                    static Policy toPolicy(const std::string &name);
+
+                    int maxInvocations;
+                    int maxInvocationsPerConnection;
+                    int64_t maxWriteQueueBytes;
+                    Policy policy;
+                    int64_t timeoutMillis;
+
+                    util::Mutex lock;
+                    util::ConditionVariable releasedCondition;
+                    int outstanding;
+                    int waiters;
+                    int64_t admittedCount;
+                    int64_t waitedCount;
+                    int64_t totalWaitMillis;
+                    int64_t maxWaitMillis;
+                    int64_t rejectedCount;
+                    int64_t callerRunsCount;
+                };
+            }
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_SPI_IMPL_ADMISSIONCONTROLLER_H_
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_SPI_IMPL_LISTENER_DELEGATINGEVENTHANDLER_H_
+#define HAZELCAST_CLIENT_SPI_IMPL_LISTENER_DELEGATINGEVENTHANDLER_H_
+
+#include "hazelcast/client/impl/BaseEventHandler.h"
+
+#include <boost/shared_ptr.hpp>
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace spi {
+            namespace impl {
+                namespace listener {
+                    /**
+                     * Each registration promise owns its event handler. This handler lets the registrations of the
+                     * same listener on different members share one actual handler.
+                     */
+                    class HAZELCAST_API DelegatingEventHandler : public client::impl::BaseEventHandler {
+                    public:
+                        DelegatingEventHandler(boost::shared_ptr<client::impl::BaseEventHandler> delegate);
+
+                        virtual ~DelegatingEventHandler();
+
+                        void handle(std::auto_ptr<protocol::ClientMessage> message);
+
+                    private:
+                        boost::shared_ptr<client::impl::BaseEventHandler> delegate;
+                    };
+                }
+            }
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif // HAZELCAST_CLIENT_SPI_IMPL_LISTENER_DELEGATINGEVENTHANDLER_H_
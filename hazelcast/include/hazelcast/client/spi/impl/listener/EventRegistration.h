@@ -27,12 +27,13 @@
 #include <string>
 #include <stdint.h>
 #include <memory>
+#include <boost/shared_ptr.hpp>
 
+#include "hazelcast/client/Address.h"
 #include "hazelcast/util/HazelcastDll.h"
 
 namespace hazelcast {
     namespace client {
-        class Address;
         namespace protocol {
             class ClientMessage;
             namespace codec {
@@ -42,6 +43,8 @@ namespace hazelcast {
         namespace spi {
             namespace impl {
                 namespace listener {
+                    class SmartListenerRegistration;
+
 					class HAZELCAST_API EventRegistration {
 
                     public:
@@ -49,6 +52,11 @@ namespace hazelcast {
                                           const Address &member,
                                           std::auto_ptr<protocol::codec::IAddListenerCodec> addCodec);
 
+                        /**
+                         * Creates the registration of a listener which is registered on every member.
+                         */
+                        EventRegistration(boost::shared_ptr<SmartListenerRegistration> smartRegistration);
+
                         int64_t getCorrelationId() const;
 
                         const Address &getMemberAddress() const;
@@ -57,10 +65,17 @@ namespace hazelcast {
 
                         void setCorrelationId(int64_t callId);
 
+                        /**
+                         * @return the member registrations if the listener is registered on every member, NULL
+                         * otherwise
+                         */
+                        const boost::shared_ptr<SmartListenerRegistration> &getSmartRegistration() const;
+
                     private:
                         int64_t correlationId;
-                        const Address &memberAddress;
+                        Address memberAddress;
                         std::auto_ptr<protocol::codec::IAddListenerCodec> addCodec;
+                        boost::shared_ptr<SmartListenerRegistration> smartRegistration;
                     };
                 }
             }
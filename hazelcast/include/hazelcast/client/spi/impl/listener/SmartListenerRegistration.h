@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_SPI_IMPL_LISTENER_SMARTLISTENERREGISTRATION_H_
+#define HAZELCAST_CLIENT_SPI_IMPL_LISTENER_SMARTLISTENERREGISTRATION_H_
+
+#include "hazelcast/client/Address.h"
+#include "hazelcast/client/Member.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/ConditionVariable.h"
+#include "hazelcast/util/HazelcastDll.h"
+
+#include <boost/shared_ptr.hpp>
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <map>
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace impl {
+            class BaseEventHandler;
+        }
+        namespace protocol {
+            namespace codec {
+                class IAddListenerCodec;
+            }
+        }
+        namespace spi {
+            namespace impl {
+                namespace listener {
+                    /**
+                     * A listener registered on every member of the cluster. Each member registration is a member local
+                     * registration with its own server side registration id, and all of them share the same handler.
+                     */
+                    class HAZELCAST_API SmartListenerRegistration {
+                    public:
+                        struct MemberRegistration {
+                            std::string registrationId;
+                            int64_t correlationId;
+                        };
+
+                        typedef std::vector<std::pair<Address, MemberRegistration> > MemberRegistrations;
+
+                        SmartListenerRegistration(std::auto_ptr<protocol::codec::IAddListenerCodec> addCodec,
+                                                  boost::shared_ptr<client::impl::BaseEventHandler> handler);
+
+                        const protocol::codec::IAddListenerCodec &getAddCodec() const;
+
+                        boost::shared_ptr<client::impl::BaseEventHandler> getHandler() const;
+
+                        bool isRegisteredOn(const Address &member) const;
+
+                        /**
+                         * Marks the start of a registration request to a member. Each successful call must be
+                         * followed by a call to endMemberRegistration.
+                         * @return false if the registration is already closed and no member should be registered
+                         */
+                        bool beginMemberRegistration();
+
+                        void endMemberRegistration();
+
+                        void addMemberRegistration(const Address &member, const std::string &registrationId,
+                                                   int64_t correlationId);
+
+                        /**
+                         * @return true if there was a member registration with the given registration request
+                         * correlation id
+                         */
+                        bool removeMemberRegistration(int64_t correlationId);
+
+                        /**
+                         * Removes the registrations on the members which are not in the provided member list.
+                         * @return the removed registrations
+                         */
+                        MemberRegistrations removeMembersNotIn(const std::vector<Member> &members);
+
+                        /**
+                         * Closes the registration so that no new member registration is started, waits for the
+                         * member registrations in progress and removes all the member registrations.
+                         * @return the removed registrations
+                         */
+                        MemberRegistrations close();
+
+                    private:
+                        typedef std::map<Address, MemberRegistration, addressComparator> MemberRegistrationMap;
+
+                        std::auto_ptr<protocol::codec::IAddListenerCodec> addCodec;
+                        boost::shared_ptr<client::impl::BaseEventHandler> handler;
+                        MemberRegistrationMap memberRegistrations;
+                        bool closed;
+                        int inFlightRegistrations;
+                        mutable util::Mutex lock;
+                        util::ConditionVariable registrationsDone;
+                    };
+                }
+            }
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif // HAZELCAST_CLIENT_SPI_IMPL_LISTENER_SMARTLISTENERREGISTRATION_H_
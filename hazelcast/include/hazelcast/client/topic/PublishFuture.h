@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_TOPIC_PUBLISHFUTURE_H_
+#define HAZELCAST_CLIENT_TOPIC_PUBLISHFUTURE_H_
+
+#include <ctime>
+#include <boost/shared_ptr.hpp>
+
+#include "hazelcast/util/Future.h"
+#include "hazelcast/client/exception/ProtocolExceptions.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace topic {
+            /**
+             * The result of a ReliableTopic#publishAsync call. The messages published in the same batch share the
+             * result of the batch.
+             */
+            class PublishFuture {
+            public:
+                /**
+                 * Internal API. Constructor
+                 */
+                PublishFuture(const boost::shared_ptr<util::Future<bool> > &batchResult) : batchResult(batchResult) {
+                }
+
+                /**
+                 * Waits until the message is stored to the topic.
+                 *
+                 * @return true if the message is stored, false if it is discarded due to the
+                 *         TopicOverloadPolicy::DISCARD_NEWEST policy.
+                 * @throws TopicOverloadException if the topic is overloaded and the policy is TopicOverloadPolicy::FAIL
+                 * @throws IException if the message could not be stored
+                 */
+                bool get() {
+                    return batchResult->get();
+                }
+
+                /**
+                 * Waits at most the given time until the message is stored to the topic.
+                 *
+                 * @param timeoutInSeconds the maximum time to wait
+                 * @return see get()
+                 * @throws TimeoutException if the message is not stored in time. get can be called again later.
+                 */
+                bool get(time_t timeoutInSeconds) {
+                    try {
+                        return batchResult->get(timeoutInSeconds);
+                    } catch (exception::FutureWaitTimeout &) {
+                        throw exception::TimeoutException("PublishFuture::get(time_t)", "Wait is timed out");
+                    }
+                }
+
+            private:
+                boost::shared_ptr<util::Future<bool> > batchResult;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_CLIENT_TOPIC_PUBLISHFUTURE_H_
@@ -19,16 +19,16 @@
 #ifndef HAZELCAST_CLIENT_TOPIC_IMPL_RELIABLE_RELIABLETOPICEXECUTOR_H_
 #define HAZELCAST_CLIENT_TOPIC_IMPL_RELIABLE_RELIABLETOPICEXECUTOR_H_
 
-#include <memory>
+#include <vector>
+#include <set>
 #include <stdint.h>
+#include <boost/shared_ptr.hpp>
 
-#include "hazelcast/client/Ringbuffer.h"
-#include "hazelcast/client/DataArray.h"
 #include "hazelcast/util/HazelcastDll.h"
 #include "hazelcast/util/BlockingConcurrentQueue.h"
-#include "hazelcast/client/impl/ExecutionCallback.h"
 #include "hazelcast/util/Thread.h"
-#include "hazelcast/client/topic/impl/reliable/ReliableTopicMessage.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/AtomicBoolean.h"
 
 #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
 #pragma warning(push)
@@ -40,39 +40,61 @@ namespace hazelcast {
         namespace topic {
             namespace impl {
                 namespace reliable {
+                    /**
+                     * The thread pool shared by all the reliable topic listeners of a client.
+                     *
+                     * A listener does not own a thread. It is submitted to the pool when the read of its next batch
+                     * completes, hence the number of threads does not depend on the number of listeners.
+                     */
                     class HAZELCAST_API ReliableTopicExecutor {
                     public:
-                        enum MessageType {
-                            GET_ONE_MESSAGE,
-                            CANCEL
-                        };
+                        class Task {
+                        public:
+                            virtual ~Task() {
+                            }
 
-                        struct Message {
-                            MessageType type;
-                            int64_t sequence;
-                            int32_t maxCount;
-                            client::impl::ExecutionCallback<DataArray<ReliableTopicMessage> > *callback;
+                            virtual void run() = 0;
                         };
 
-                        ReliableTopicExecutor(Ringbuffer<topic::impl::reliable::ReliableTopicMessage> *rb);
+                        ReliableTopicExecutor(int32_t poolSize);
 
                         virtual ~ReliableTopicExecutor();
 
                         /**
-                         * Not thread safe method
+                         * Starts the pool threads if they are not started yet. Thread safe.
                          */
                         void start();
 
-                        void stop();
+                        /**
+                         * Stops the pool threads. The tasks which are not started yet are dropped. If it is called
+                         * from a pool thread, that thread is not joined, it stops when its current task returns.
+                         */
+                        void shutdown();
 
-                        void execute(const Message &m);
+                        /**
+                         * @return true if the calling thread is one of the pool threads
+                         */
+                        bool isPoolThread() const;
+
+                        /**
+                         * Schedules the task to be run by one of the pool threads. Never blocks, hence it can be
+                         * called from the io thread. The task is dropped if the executor is shut down.
+                         *
+                         * @return false if the task is dropped
+                         */
+                        bool execute(boost::shared_ptr<Task> task);
                     private:
-                        static void executerRun(util::ThreadArgs &args);
+                        static void executorRun(util::ThreadArgs &args);
+
+                        void joinThreads();
 
-                        Ringbuffer<topic::impl::reliable::ReliableTopicMessage> *ringbuffer;
-                        std::auto_ptr<util::Thread> runnerThread;
-                        util::BlockingConcurrentQueue<Message> q;
-                        util::AtomicBoolean shutdown;
+                        int32_t poolSize;
+                        util::Mutex startLock;
+                        std::vector<boost::shared_ptr<util::Thread> > threads;
+                        mutable util::Mutex poolThreadIdsLock;
+                        std::set<long> poolThreadIds;
+                        util::BlockingConcurrentQueue<boost::shared_ptr<Task> > q;
+                        util::AtomicBoolean live;
                     };
                 }
             }
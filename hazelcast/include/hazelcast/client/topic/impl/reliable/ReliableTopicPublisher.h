@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_CLIENT_TOPIC_IMPL_RELIABLE_RELIABLETOPICPUBLISHER_H_
+#define HAZELCAST_CLIENT_TOPIC_IMPL_RELIABLE_RELIABLETOPICPUBLISHER_H_
+
+#include <deque>
+#include <vector>
+#include <string>
+#include <memory>
+#include <stdint.h>
+#include <boost/shared_ptr.hpp>
+
+#include "hazelcast/util/HazelcastDll.h"
+#include "hazelcast/util/Future.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/ConditionVariable.h"
+#include "hazelcast/client/exception/IException.h"
+#include "hazelcast/client/serialization/pimpl/Data.h"
+#include "hazelcast/client/impl/BatchEventFlusher.h"
+#include "hazelcast/client/topic/TopicOverloadPolicy.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(push)
+#pragma warning(disable: 4251) //for dll export
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace spi {
+            class ClientContext;
+        }
+
+        namespace config {
+            class ReliableTopicConfig;
+        }
+
+        namespace connection {
+            class CallFuture;
+        }
+
+        namespace topic {
+            namespace impl {
+                namespace reliable {
+                    class ReliableTopicExecutor;
+
+                    /**
+                     * Coalesces the messages published to a reliable topic into ringbuffer add all calls.
+                     *
+                     * The messages are appended to the last pending batch until it holds publishBatchSize messages.
+                     * The batches are stored in order, one at a time, so the messages published while a batch is
+                     * being stored are collected into the next one. A batch is stored when it is full, when it is
+                     * older than publishLingerMillis or when a synchronous publish waits for it.
+                     *
+                     * The publisher does not own a thread. The response of a batch is handled on the shared
+                     * ReliableTopicExecutor, which also sends the next batch. The linger deadlines and the BLOCK
+                     * backoffs are scheduled on the client's BatchEventFlusher.
+                     *
+                     * The TopicOverloadPolicy is applied when the ringbuffer has no place for a batch.
+                     */
+                    class HAZELCAST_API ReliableTopicPublisher : public client::impl::BatchEventFlusher::Flushable {
+                    public:
+                        /**
+                         * The publisher keeps a reference to itself for the calls it sends, until it is shut down.
+                         */
+                        static boost::shared_ptr<ReliableTopicPublisher> create(
+                                const std::string &topicName, const std::string &ringbufferName, int partitionId,
+                                spi::ClientContext &context, const config::ReliableTopicConfig &config);
+
+                        virtual ~ReliableTopicPublisher();
+
+                        /**
+                         * Queues the message to be stored. Blocks if too many batches are waiting to be stored,
+                         * unless it is called from a ReliableTopicExecutor thread, e.g. by a message listener.
+                         *
+                         * @param message the serialized ReliableTopicMessage
+                         * @param flushNow true if the caller is going to wait for the result, the batch is stored
+                         *                 without waiting for more messages.
+                         * @return the result of the batch of the message
+                         */
+                        boost::shared_ptr<util::Future<bool> > publish(const serialization::pimpl::Data &message,
+                                                                       bool flushNow);
+
+                        /**
+                         * Stops publishing. The batches which are not stored yet fail.
+                         */
+                        void shutdown();
+
+                        /**
+                         * Called by the BatchEventFlusher when a linger deadline or a backoff passes.
+                         */
+                        virtual void flush();
+
+                    private:
+                        class StoreCompletion;
+
+                        class StoreTask;
+
+                        struct Batch {
+                            Batch();
+
+                            std::vector<serialization::pimpl::Data> messages;
+                            int64_t creationTime;
+                            bool urgent;
+                            int64_t backoffMillis;
+                            int64_t retryTime;
+                            boost::shared_ptr<util::Future<bool> > result;
+                        };
+
+                        ReliableTopicPublisher(const std::string &topicName, const std::string &ringbufferName,
+                                               int partitionId, spi::ClientContext &context,
+                                               const config::ReliableTopicConfig &config);
+
+                        static const size_t MAX_PENDING_BATCHES;
+                        static const int64_t INITIAL_BACKOFF_MILLIS;
+                        static const int64_t MAX_BACKOFF_MILLIS;
+
+                        /**
+                         * Takes the first pending batch as the current one if it is ready to be stored, otherwise
+                         * schedules its linger deadline. Called with the lock held.
+                         *
+                         * @return the batch to be sent, or an empty pointer
+                         */
+                        boost::shared_ptr<Batch> takeReadyBatch();
+
+                        /**
+                         * Sends the batch. If the call can not be made, the batch fails and the next one is sent.
+                         */
+                        void send(boost::shared_ptr<Batch> batch);
+
+                        /**
+                         * Handles the response of the current batch on a ReliableTopicExecutor thread.
+                         */
+                        void onStored(connection::CallFuture &future);
+
+                        /**
+                         * Completes the current batch and takes the next one.
+                         *
+                         * @return the next batch to be sent, or an empty pointer
+                         */
+                        boost::shared_ptr<Batch> complete(const boost::shared_ptr<Batch> &batch, bool stored,
+                                                          std::auto_ptr<exception::IException> error);
+
+                        /**
+                         * Fails all the batches, called when the client can not run the tasks of the publisher
+                         * anymore.
+                         */
+                        void failAll();
+
+                        std::string topicName;
+                        std::string ringbufferName;
+                        int partitionId;
+                        spi::ClientContext &context;
+                        ReliableTopicExecutor &executor;
+                        client::impl::BatchEventFlusher &flusher;
+                        topic::TopicOverloadPolicy overloadPolicy;
+                        int32_t overflowPolicy;
+                        size_t batchSize;
+                        int64_t lingerMillis;
+                        util::Mutex lock;
+                        util::ConditionVariable notFull;
+                        std::deque<boost::shared_ptr<Batch> > pendingBatches;
+                        // the batch being stored, including its backoff, empty if no batch is being stored
+                        boost::shared_ptr<Batch> currentBatch;
+                        bool retryScheduled;
+                        bool live;
+                        // released by the shutdown, the calls in flight keep their own references
+                        boost::shared_ptr<ReliableTopicPublisher> self;
+                    };
+                }
+            }
+        }
+    }
+}
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#pragma warning(pop)
+#endif
+
+#endif //HAZELCAST_CLIENT_TOPIC_IMPL_RELIABLE_RELIABLETOPICPUBLISHER_H_
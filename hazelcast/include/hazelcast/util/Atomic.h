@@ -70,6 +70,16 @@ namespace hazelcast {
                 return --v;
             }
 
+            T operator+=(T delta) {
+                LockGuard lockGuard(mutex);
+                return v += delta;
+            }
+
+            T operator-=(T delta) {
+                LockGuard lockGuard(mutex);
+                return v -= delta;
+            }
+
             bool operator<=(T i) {
                 LockGuard lockGuard(mutex);
                 return v <= i;
@@ -81,6 +81,14 @@ namespace hazelcast {
                 return numErased;
             }
 
+            /**
+             * @return number of items in the queue
+             */
+            size_t size() {
+                util::LockGuard lg(m);
+                return internalQueue.size();
+            }
+
         private:
             util::Mutex m;
             /**
@@ -21,6 +21,8 @@
 #ifndef HAZELCAST_ConditionVariable
 #define HAZELCAST_ConditionVariable
 
+#include <stdint.h>
+
 #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
 
 #define WIN32_LEAN_AND_MEAN
@@ -41,6 +43,8 @@ namespace hazelcast {
 
 			bool waitFor(Mutex &mutex, time_t timeInSec);
 
+            bool waitForMillis(Mutex &mutex, int64_t timeInMillis);
+
             void notify();
 
             void notify_all();
@@ -76,6 +80,8 @@ namespace hazelcast {
 
             bool waitFor(Mutex &mutex, time_t timeInSec );
 
+            bool waitForMillis(Mutex &mutex, int64_t timeInMillis);
+
             void notify();
 
             void notify_all();
@@ -24,6 +24,7 @@
 #include "hazelcast/util/ConditionVariable.h"
 #include "hazelcast/util/LockGuard.h"
 #include "hazelcast/util/ILogger.h"
+#include "hazelcast/util/Util.h"
 #include <memory>
 #include <cassert>
 
@@ -114,6 +115,22 @@ namespace hazelcast {
                 throw client::exception::FutureWaitTimeout("Future::get(timeInSeconds)", "Wait is timed out");
             };
 
+            /**
+             * Waits until the value or the exception is set, without consuming the value.
+             *
+             * @return true if the future is completed, false if the wait is timed out
+             */
+            bool waitFor(int64_t timeInMillis) {
+                LockGuard guard(mutex);
+                int64_t endTime = util::currentTimeMillis() + timeInMillis;
+                int64_t remaining = timeInMillis;
+                while (!(resultReady || exceptionReady) && remaining > 0) {
+                    conditionVariable.waitForMillis(mutex, remaining);
+                    remaining = endTime - util::currentTimeMillis();
+                }
+                return resultReady || exceptionReady;
+            }
+
             void reset() {
                 LockGuard guard(mutex);
 
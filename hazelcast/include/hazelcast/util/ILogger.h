@@ -22,8 +22,12 @@
 #define HAZELCAST_ILogger
 
 #include "hazelcast/util/HazelcastDll.h"
-#include "Mutex.h"
+#include "hazelcast/util/Mutex.h"
+#include "hazelcast/util/ConditionVariable.h"
+#include "hazelcast/client/LogRecord.h"
 #include <string>
+#include <vector>
+#include <memory>
 
 #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
 #pragma warning(push)
@@ -32,12 +36,20 @@
 
 namespace hazelcast {
     namespace client {
-        enum LogLevel {
-            SEVERE = 100, WARNING = 90, INFO = 50, FINEST = 20
-        };
+        class LogSink;
     }
 
     namespace util {
+        class Thread;
+
+        class ThreadArgs;
+
+        /**
+        * The logger of the client. The records are put into a bounded buffer and written to the sink by a
+        * background thread, hence the logging threads do not wait for the output. The records which do not fit into
+        * the buffer are dropped and their number is reported. The level shall be checked via isEnabled before a
+        * costly message is formatted.
+        */
         class HAZELCAST_API ILogger {
         public:
             static ILogger& getLogger();
@@ -52,12 +64,38 @@ namespace hazelcast {
 
             void finest(const std::string& message);
 
+            /**
+            * Logs the record if its level is enabled. The contents of the record are moved to the logger.
+            */
+            void log(client::LogRecord &record);
+
             void setPrefix(const std::string& prefix);
 
             bool isEnabled(int logLevel) const;
 
             bool isFinestEnabled() const;
+
+            /**
+            * Sets the destination of the records, the standard output is used if the sink is NULL. The sink is not
+            * owned by the logger. The records buffered so far are written to the previous sink first, which is not
+            * used anymore once this method returns.
+            */
+            void setSink(client::LogSink *sink);
+
+            /**
+            * If disabled, the records are written by the logging thread. Enabled by default.
+            */
+            void setAsync(bool async);
+
+            /**
+            * Waits until the buffered records are written to the sink.
+            */
+            void flush();
+
+            static void staticWrite(util::ThreadArgs& args);
         private:
+            static const size_t BUFFER_CAPACITY = 8192;
+
             int HazelcastLogLevel;
             std::string prefix;
 
@@ -65,13 +103,37 @@ namespace hazelcast {
 
             ~ILogger();
 
-            const char *getTime(char * buffer, size_t length) const;
+            const char *getTime(char * buffer, size_t length, int64_t timeMillis) const;
 
             ILogger(const ILogger&);
 
             ILogger& operator=(const ILogger&);
 
-            util::Mutex lockMutex;
+            void ensureWriterStarted();
+
+            void writeLoop();
+
+            void writeToSink(client::LogRecord &record);
+
+            void writeToStdout(const client::LogRecord &record);
+
+            void flushSink();
+
+            client::LogSink *sink;
+            bool async;
+            // guards the sink, it is never called by two threads at the same time
+            util::Mutex sinkMutex;
+
+            util::Mutex bufferMutex;
+            util::ConditionVariable bufferCondition;
+            util::ConditionVariable drainedCondition;
+            std::vector<client::LogRecord> buffer;
+            size_t bufferHead;
+            size_t bufferCount;
+            int64_t droppedCount;
+            bool writing;
+            bool live;
+            std::auto_ptr<util::Thread> writer;
         };
     }
 }
@@ -49,6 +49,11 @@ namespace hazelcast {
             static void closeResource(Closeable *closable);
 
         };
+
+        template<>
+        inline bool IOUtil::to_value<bool>(const std::string& str) {
+            return str == "true" || str == "1";
+        }
     }
 }
 
@@ -35,7 +35,7 @@ namespace hazelcast {
         class Socket;
     }
     namespace util {
-        class ServerSocket {
+        class HAZELCAST_API ServerSocket {
         public:
             ServerSocket(int port = 0);
 
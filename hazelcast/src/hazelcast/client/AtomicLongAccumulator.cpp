@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/AtomicLongAccumulator.h"
+#include "hazelcast/client/IAtomicLong.h"
+#include "hazelcast/client/exception/IllegalStateException.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/ILogger.h"
+#include "hazelcast/util/Util.h"
+
+namespace hazelcast {
+    namespace client {
+        AtomicLongAccumulator::Cell::Cell() : value(0), closed(false) {
+        }
+
+        AtomicLongAccumulator::AtomicLongAccumulator(const IAtomicLong &atomicLong,
+                                                     const config::AtomicLongAccumulatorConfig &config)
+        : atomicLong(new IAtomicLong(atomicLong))
+        , flushIntervalMillis(config.getFlushIntervalMillis())
+        , flushThreshold(config.getFlushThreshold())
+        , stripeCount(config.getStripeCount())
+        , cells(new Cell[config.getStripeCount()])
+        , lastValue(0)
+        , unflushedDelta(0)
+        , flushRequested(false)
+        , live(true) {
+            flushThread.reset(new util::Thread("hz.atomicLongAccumulator", staticRunFlusher, this));
+        }
+
+        AtomicLongAccumulator::~AtomicLongAccumulator() {
+            try {
+                close();
+            } catch (exception::IException &e) {
+                util::ILogger::getLogger().warning(
+                        std::string("[AtomicLongAccumulator::~AtomicLongAccumulator] Failed to flush the deltas of ") +
+                        atomicLong->getName() + ". " + e.what());
+            }
+            delete[] cells;
+        }
+
+        void AtomicLongAccumulator::add(int64_t delta) {
+            Cell &cell = getCell();
+            int64_t value;
+            {
+                util::LockGuard guard(cell.lock);
+                if (cell.closed) {
+                    throw exception::IllegalStateException("AtomicLongAccumulator::add",
+                                                           "The accumulator of " + atomicLong->getName() +
+                                                           " is closed");
+                }
+                value = (cell.value += delta);
+            }
+
+            // only the add which raises the request wakes the flusher up, the others find it already raised
+            if (flushThreshold > 0 && (value >= flushThreshold || value <= -flushThreshold) &&
+                flushRequested.compareAndSet(false, true)) {
+                signalFlusher();
+            }
+        }
+
+        void AtomicLongAccumulator::increment() {
+            add(1);
+        }
+
+        int64_t AtomicLongAccumulator::get() {
+            util::LockGuard guard(stateLock);
+            int64_t value = lastValue + unflushedDelta;
+            for (int i = 0; i < stripeCount; ++i) {
+                util::LockGuard cellGuard(cells[i].lock);
+                value += cells[i].value;
+            }
+            return value;
+        }
+
+        int64_t AtomicLongAccumulator::getPendingDelta() {
+            util::LockGuard guard(stateLock);
+            int64_t delta = unflushedDelta;
+            for (int i = 0; i < stripeCount; ++i) {
+                util::LockGuard cellGuard(cells[i].lock);
+                delta += cells[i].value;
+            }
+            return delta;
+        }
+
+        int64_t AtomicLongAccumulator::flush() {
+            return flushDeltas(false);
+        }
+
+        void AtomicLongAccumulator::close() {
+            if (!live.compareAndSet(true, false)) {
+                return;
+            }
+
+            signalFlusher();
+            flushThread->join();
+
+            for (int i = 0; i < stripeCount; ++i) {
+                util::LockGuard cellGuard(cells[i].lock);
+                cells[i].closed = true;
+            }
+
+            flushDeltas(true);
+        }
+
+        void AtomicLongAccumulator::staticRunFlusher(util::ThreadArgs &args) {
+            AtomicLongAccumulator *accumulator = (AtomicLongAccumulator *) args.arg0;
+            accumulator->runFlusher();
+        }
+
+        void AtomicLongAccumulator::runFlusher() {
+            int64_t nextFlushTime = util::currentTimeMillis() + flushIntervalMillis;
+            while (live) {
+                int64_t now = util::currentTimeMillis();
+                {
+                    util::LockGuard guard(flushSignalLock);
+                    while (live && !flushRequested && now < nextFlushTime) {
+                        flushCondition.waitForMillis(flushSignalLock, nextFlushTime - now);
+                        now = util::currentTimeMillis();
+                    }
+                }
+
+                if (!live) {
+                    return;
+                }
+
+                nextFlushTime = now + flushIntervalMillis;
+                try {
+                    flushDeltas(true);
+                } catch (exception::IException &e) {
+                    util::ILogger::getLogger().warning(
+                            std::string("[AtomicLongAccumulator::runFlusher] Failed to flush the deltas of ") +
+                            atomicLong->getName() + ", they will be added again with the next flush. " + e.what());
+                }
+            }
+        }
+
+        void AtomicLongAccumulator::signalFlusher() {
+            util::LockGuard guard(flushSignalLock);
+            flushCondition.notify();
+        }
+
+        AtomicLongAccumulator::Cell &AtomicLongAccumulator::getCell() {
+            // the thread ids are usually aligned addresses, hence they are mixed before the modulo
+            uint64_t hash = (uint64_t) util::getThreadId() * 0x9E3779B97F4A7C15ULL;
+            return cells[(hash >> 32) % (uint64_t) stripeCount];
+        }
+
+        int64_t AtomicLongAccumulator::drainCells() {
+            int64_t delta = 0;
+            for (int i = 0; i < stripeCount; ++i) {
+                util::LockGuard cellGuard(cells[i].lock);
+                delta += cells[i].value;
+                cells[i].value = 0;
+            }
+            return delta;
+        }
+
+        int64_t AtomicLongAccumulator::flushDeltas(bool skipIfEmpty) {
+            util::LockGuard guard(flushLock);
+            flushRequested = false;
+
+            int64_t delta;
+            {
+                util::LockGuard stateGuard(stateLock);
+                unflushedDelta += drainCells();
+                delta = unflushedDelta;
+                if (skipIfEmpty && 0 == delta) {
+                    return lastValue;
+                }
+            }
+
+            // on failure, the delta stays unflushed and is added with the next flush. The failed call may still have
+            // been applied by the cluster, hence the delta is added at least once, not exactly once.
+            int64_t value = atomicLong->addAndGet(delta);
+
+            util::LockGuard stateGuard(stateLock);
+            lastValue = value;
+            unflushedDelta -= delta;
+            return value;
+        }
+    }
+}
@@ -112,6 +112,11 @@ namespace hazelcast {
             return *this;
         }
 
+        ClientConfig& ClientConfig::setLogSink(LogSink *logSink) {
+            util::ILogger::getLogger().setSink(logSink);
+            return *this;
+        }
+
         ClientConfig& ClientConfig::addListener(LifecycleListener *listener) {
             lifecycleListeners.insert(listener);
             return *this;
@@ -37,6 +37,44 @@ namespace hazelcast {
         const std::string ClientProperties::PROP_REQUEST_RETRY_COUNT_DEFAULT = "20";
         const std::string ClientProperties::PROP_REQUEST_RETRY_WAIT_TIME = "hazelcast_client_request_retry_wait_time";
         const std::string ClientProperties::PROP_REQUEST_RETRY_WAIT_TIME_DEFAULT = "1";
+        const std::string ClientProperties::PROP_SMART_LISTENER_REGISTRATION = "hazelcast_client_smart_listener_registration";
+        const std::string ClientProperties::PROP_SMART_LISTENER_REGISTRATION_DEFAULT = "false";
+        const std::string ClientProperties::PROP_MESSAGE_FRAGMENT_SIZE = "hazelcast_client_message_fragment_size";
+        const std::string ClientProperties::PROP_MESSAGE_FRAGMENT_SIZE_DEFAULT = "0";
+
+        const std::string ClientProperties::PROP_RELIABLE_TOPIC_EXECUTOR_POOL_SIZE = "hazelcast_client_reliable_topic_executor_pool_size";
+        const std::string ClientProperties::PROP_RELIABLE_TOPIC_EXECUTOR_POOL_SIZE_DEFAULT = "2";
+
+        const std::string ClientProperties::PROP_DESERIALIZATION_POOL_SIZE = "hazelcast_client_deserialization_pool_size";
+        const std::string ClientProperties::PROP_DESERIALIZATION_POOL_SIZE_DEFAULT = "0";
+        const std::string ClientProperties::PROP_DESERIALIZATION_CHUNK_SIZE = "hazelcast_client_deserialization_chunk_size";
+        const std::string ClientProperties::PROP_DESERIALIZATION_CHUNK_SIZE_DEFAULT = "1000";
+
+        const std::string ClientProperties::PROP_CONNECTIONS_PER_MEMBER = "hazelcast_client_connections_per_member";
+        const std::string ClientProperties::PROP_CONNECTIONS_PER_MEMBER_DEFAULT = "1";
+        const std::string ClientProperties::PROP_IO_THREAD_COUNT = "hazelcast_client_io_thread_count";
+        const std::string ClientProperties::PROP_IO_THREAD_COUNT_DEFAULT = "1";
+
+        const std::string ClientProperties::PROP_MAX_CONCURRENT_INVOCATIONS = "hazelcast_client_max_concurrent_invocations";
+        const std::string ClientProperties::PROP_MAX_CONCURRENT_INVOCATIONS_DEFAULT = "0";
+        const std::string ClientProperties::PROP_MAX_CONCURRENT_INVOCATIONS_PER_CONNECTION = "hazelcast_client_max_concurrent_invocations_per_connection";
+        const std::string ClientProperties::PROP_MAX_CONCURRENT_INVOCATIONS_PER_CONNECTION_DEFAULT = "0";
+        const std::string ClientProperties::PROP_MAX_WRITE_QUEUE_BYTES = "hazelcast_client_max_write_queue_bytes";
+        const std::string ClientProperties::PROP_MAX_WRITE_QUEUE_BYTES_DEFAULT = "0";
+        const std::string ClientProperties::PROP_BACKPRESSURE_POLICY = "hazelcast_client_backpressure_policy";
+        const std::string ClientProperties::PROP_BACKPRESSURE_POLICY_DEFAULT = "BLOCK";
+        const std::string ClientProperties::PROP_BACKPRESSURE_TIMEOUT_MILLIS = "hazelcast_client_backpressure_timeout_millis";
+        const std::string ClientProperties::PROP_BACKPRESSURE_TIMEOUT_MILLIS_DEFAULT = "60000";
+        const std::string ClientProperties::PROP_ID_GENERATOR_BLOCK_SIZE = "hazelcast_client_id_generator_block_size";
+        const std::string ClientProperties::PROP_ID_GENERATOR_BLOCK_SIZE_DEFAULT = "1000";
+        const std::string ClientProperties::PROP_ID_GENERATOR_PREFETCH_BLOCKS = "hazelcast_client_id_generator_prefetch_blocks";
+        const std::string ClientProperties::PROP_ID_GENERATOR_PREFETCH_BLOCKS_DEFAULT = "1";
+        const std::string ClientProperties::PROP_HOT_KEY_SAMPLE_RATE = "hazelcast_client_hot_key_sample_rate";
+        const std::string ClientProperties::PROP_HOT_KEY_SAMPLE_RATE_DEFAULT = "0";
+        const std::string ClientProperties::PROP_HOT_KEY_TOP_K = "hazelcast_client_hot_key_top_k";
+        const std::string ClientProperties::PROP_HOT_KEY_TOP_K_DEFAULT = "20";
+        const std::string ClientProperties::PROP_HOT_KEY_DUMP_INTERVAL_SECONDS = "hazelcast_client_hot_key_dump_interval_seconds";
+        const std::string ClientProperties::PROP_HOT_KEY_DUMP_INTERVAL_SECONDS_DEFAULT = "0";
 
         ClientProperty::ClientProperty(ClientConfig& config, const std::string& name, const std::string& defaultValue)
         : name(name) {
@@ -82,7 +120,32 @@ namespace hazelcast {
         : heartbeatTimeout(clientConfig, PROP_HEARTBEAT_TIMEOUT, PROP_HEARTBEAT_TIMEOUT_DEFAULT)
         , heartbeatInterval(clientConfig, PROP_HEARTBEAT_INTERVAL, PROP_HEARTBEAT_INTERVAL_DEFAULT)
         , retryCount(clientConfig, PROP_REQUEST_RETRY_COUNT, PROP_REQUEST_RETRY_COUNT_DEFAULT)
-        , retryWaitTime(clientConfig, PROP_REQUEST_RETRY_WAIT_TIME, PROP_REQUEST_RETRY_WAIT_TIME_DEFAULT) {
+        , retryWaitTime(clientConfig, PROP_REQUEST_RETRY_WAIT_TIME, PROP_REQUEST_RETRY_WAIT_TIME_DEFAULT)
+        , smartListenerRegistration(clientConfig, PROP_SMART_LISTENER_REGISTRATION,
+                                    PROP_SMART_LISTENER_REGISTRATION_DEFAULT)
+        , messageFragmentSize(clientConfig, PROP_MESSAGE_FRAGMENT_SIZE, PROP_MESSAGE_FRAGMENT_SIZE_DEFAULT)
+        , reliableTopicExecutorPoolSize(clientConfig, PROP_RELIABLE_TOPIC_EXECUTOR_POOL_SIZE,
+                                        PROP_RELIABLE_TOPIC_EXECUTOR_POOL_SIZE_DEFAULT)
+        , deserializationPoolSize(clientConfig, PROP_DESERIALIZATION_POOL_SIZE, PROP_DESERIALIZATION_POOL_SIZE_DEFAULT)
+        , deserializationChunkSize(clientConfig, PROP_DESERIALIZATION_CHUNK_SIZE,
+                                   PROP_DESERIALIZATION_CHUNK_SIZE_DEFAULT)
+        , connectionsPerMember(clientConfig, PROP_CONNECTIONS_PER_MEMBER, PROP_CONNECTIONS_PER_MEMBER_DEFAULT)
+        , ioThreadCount(clientConfig, PROP_IO_THREAD_COUNT, PROP_IO_THREAD_COUNT_DEFAULT)
+        , maxConcurrentInvocations(clientConfig, PROP_MAX_CONCURRENT_INVOCATIONS,
+                                   PROP_MAX_CONCURRENT_INVOCATIONS_DEFAULT)
+        , maxConcurrentInvocationsPerConnection(clientConfig, PROP_MAX_CONCURRENT_INVOCATIONS_PER_CONNECTION,
+                                                PROP_MAX_CONCURRENT_INVOCATIONS_PER_CONNECTION_DEFAULT)
+        , maxWriteQueueBytes(clientConfig, PROP_MAX_WRITE_QUEUE_BYTES, PROP_MAX_WRITE_QUEUE_BYTES_DEFAULT)
+        , backpressurePolicy(clientConfig, PROP_BACKPRESSURE_POLICY, PROP_BACKPRESSURE_POLICY_DEFAULT)
+        , backpressureTimeoutMillis(clientConfig, PROP_BACKPRESSURE_TIMEOUT_MILLIS,
+                                    PROP_BACKPRESSURE_TIMEOUT_MILLIS_DEFAULT)
+        , idGeneratorBlockSize(clientConfig, PROP_ID_GENERATOR_BLOCK_SIZE, PROP_ID_GENERATOR_BLOCK_SIZE_DEFAULT)
+        , idGeneratorPrefetchBlocks(clientConfig, PROP_ID_GENERATOR_PREFETCH_BLOCKS,
+                                    PROP_ID_GENERATOR_PREFETCH_BLOCKS_DEFAULT)
+        , hotKeySampleRate(clientConfig, PROP_HOT_KEY_SAMPLE_RATE, PROP_HOT_KEY_SAMPLE_RATE_DEFAULT)
+        , hotKeyTopK(clientConfig, PROP_HOT_KEY_TOP_K, PROP_HOT_KEY_TOP_K_DEFAULT)
+        , hotKeyDumpIntervalSeconds(clientConfig, PROP_HOT_KEY_DUMP_INTERVAL_SECONDS,
+                                    PROP_HOT_KEY_DUMP_INTERVAL_SECONDS_DEFAULT) {
 
         }
 
@@ -102,6 +165,74 @@ namespace hazelcast {
         const ClientProperty& ClientProperties::getRetryWaitTime() const {
             return retryWaitTime;
         }
+
+        const ClientProperty& ClientProperties::getSmartListenerRegistration() const {
+            return smartListenerRegistration;
+        }
+
+        const ClientProperty& ClientProperties::getMessageFragmentSize() const {
+            return messageFragmentSize;
+        }
+
+        const ClientProperty& ClientProperties::getReliableTopicExecutorPoolSize() const {
+            return reliableTopicExecutorPoolSize;
+        }
+
+        const ClientProperty& ClientProperties::getDeserializationPoolSize() const {
+            return deserializationPoolSize;
+        }
+
+        const ClientProperty& ClientProperties::getDeserializationChunkSize() const {
+            return deserializationChunkSize;
+        }
+
+        const ClientProperty& ClientProperties::getConnectionsPerMember() const {
+            return connectionsPerMember;
+        }
+
+        const ClientProperty& ClientProperties::getIOThreadCount() const {
+            return ioThreadCount;
+        }
+
+        const ClientProperty& ClientProperties::getMaxConcurrentInvocations() const {
+            return maxConcurrentInvocations;
+        }
+
+        const ClientProperty& ClientProperties::getMaxConcurrentInvocationsPerConnection() const {
+            return maxConcurrentInvocationsPerConnection;
+        }
+
+        const ClientProperty& ClientProperties::getMaxWriteQueueBytes() const {
+            return maxWriteQueueBytes;
+        }
+
+        const ClientProperty& ClientProperties::getBackpressurePolicy() const {
+            return backpressurePolicy;
+        }
+
+        const ClientProperty& ClientProperties::getBackpressureTimeoutMillis() const {
+            return backpressureTimeoutMillis;
+        }
+
+        const ClientProperty& ClientProperties::getIdGeneratorBlockSize() const {
+            return idGeneratorBlockSize;
+        }
+
+        const ClientProperty& ClientProperties::getIdGeneratorPrefetchBlocks() const {
+            return idGeneratorPrefetchBlocks;
+        }
+
+        const ClientProperty& ClientProperties::getHotKeySampleRate() const {
+            return hotKeySampleRate;
+        }
+
+        const ClientProperty& ClientProperties::getHotKeyTopK() const {
+            return hotKeyTopK;
+        }
+
+        const ClientProperty& ClientProperties::getHotKeyDumpIntervalSeconds() const {
+            return hotKeyDumpIntervalSeconds;
+        }
     }
 }
 
@@ -49,5 +49,13 @@ namespace hazelcast {
         std::vector<Member>  Cluster::getMembers() {
             return clusterService.getMemberList();
         }
+
+        boost::shared_ptr<connection::Connection> Cluster::getConnection(const Address &address) {
+            return clusterService.getConnection(address);
+        }
+
+        std::vector<boost::shared_ptr<connection::Connection> > Cluster::getConnections(const Address &address) {
+            return clusterService.getConnections(address);
+        }
     }
 }
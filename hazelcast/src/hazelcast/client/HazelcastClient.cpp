@@ -42,6 +42,12 @@ namespace hazelcast {
         , partitionService(clientContext)
         , invocationService(clientContext)
         , serverListenerService(clientContext)
+        , reliableTopicExecutor(clientProperties.getReliableTopicExecutorPoolSize().getInteger())
+        , deserializationExecutor(clientProperties.getDeserializationPoolSize().getInteger(),
+                                  clientProperties.getDeserializationChunkSize().getInteger())
+        , hotKeyProfiler(clientProperties.getHotKeySampleRate().getInteger(),
+                         clientProperties.getHotKeyTopK().getInteger(),
+                         clientProperties.getHotKeyDumpIntervalSeconds().getInteger(), partitionService)
         , cluster(clusterService)
         , TOPIC_RB_PREFIX("_hz_rb_") {
             std::stringstream prefix;
@@ -69,6 +75,14 @@ namespace hazelcast {
             return cluster;
         }
 
+        InvocationAdmissionStats HazelcastClient::getInvocationAdmissionStats() {
+            return invocationService.getAdmissionController().getStats();
+        }
+
+        HotKeyStats HazelcastClient::getHotKeyStats() {
+            return hotKeyProfiler.getStats();
+        }
+
         void HazelcastClient::addLifecycleListener(LifecycleListener *lifecycleListener) {
             lifecycleService.addLifecycleListener(lifecycleListener);
         }
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/HotKeyStats.h"
+
+namespace hazelcast {
+    namespace client {
+        HotKeyStats::HotKey::HotKey(const std::string &objectName, const std::vector<byte> &key, int partitionId,
+                                    int64_t estimatedCount)
+        : objectName(objectName)
+        , key(key)
+        , partitionId(partitionId)
+        , estimatedCount(estimatedCount) {
+        }
+
+        const std::string &HotKeyStats::HotKey::getObjectName() const {
+            return objectName;
+        }
+
+        const std::vector<byte> &HotKeyStats::HotKey::getKey() const {
+            return key;
+        }
+
+        int HotKeyStats::HotKey::getPartitionId() const {
+            return partitionId;
+        }
+
+        int64_t HotKeyStats::HotKey::getEstimatedCount() const {
+            return estimatedCount;
+        }
+
+        HotKeyStats::HotKeyStats(int sampleRate, int64_t sampledOperationCount, const std::vector<HotKey> &hotKeys,
+                                 const std::map<int, int64_t> &partitionOperationCounts,
+                                 const std::map<Address, int64_t, addressComparator> &memberOperationCounts)
+        : sampleRate(sampleRate)
+        , sampledOperationCount(sampledOperationCount)
+        , hotKeys(hotKeys)
+        , partitionOperationCounts(partitionOperationCounts)
+        , memberOperationCounts(memberOperationCounts) {
+        }
+
+        int HotKeyStats::getSampleRate() const {
+            return sampleRate;
+        }
+
+        int64_t HotKeyStats::getSampledOperationCount() const {
+            return sampledOperationCount;
+        }
+
+        const std::vector<HotKeyStats::HotKey> &HotKeyStats::getHotKeys() const {
+            return hotKeys;
+        }
+
+        const std::map<int, int64_t> &HotKeyStats::getPartitionOperationCounts() const {
+            return partitionOperationCounts;
+        }
+
+        const std::map<Address, int64_t, addressComparator> &HotKeyStats::getMemberOperationCounts() const {
+            return memberOperationCounts;
+        }
+    }
+}
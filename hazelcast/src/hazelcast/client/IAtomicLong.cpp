@@ -71,6 +71,14 @@ namespace hazelcast {
             return invokeAndGetResult<int64_t, protocol::codec::AtomicLongGetAndAddCodec::ResponseParameters>(request, partitionId);
         }
 
+        Future<int64_t> IAtomicLong::getAndAddAsync(int64_t delta) {
+            std::auto_ptr<protocol::ClientMessage> request =
+                    protocol::codec::AtomicLongGetAndAddCodec::RequestParameters::encode(getName(), delta);
+
+            return Future<int64_t>(invokeAndGetFuture(request, partitionId), context->getSerializationService(),
+                                   decodeGetAndAddResponse);
+        }
+
         int64_t IAtomicLong::getAndSet(int64_t newValue) {
             std::auto_ptr<protocol::ClientMessage> request =
                     protocol::codec::AtomicLongGetAndSetCodec::RequestParameters::encode(getName(), newValue);
@@ -98,5 +106,16 @@ namespace hazelcast {
 
             invoke(request, partitionId);
         }
+
+        std::auto_ptr<AtomicLongAccumulator> IAtomicLong::newAccumulator(
+                const config::AtomicLongAccumulatorConfig &config) {
+            return std::auto_ptr<AtomicLongAccumulator>(new AtomicLongAccumulator(*this, config));
+        }
+
+        std::auto_ptr<int64_t> IAtomicLong::decodeGetAndAddResponse(protocol::ClientMessage &response,
+                                                                    serialization::pimpl::SerializationService &) {
+            return std::auto_ptr<int64_t>(new int64_t(
+                    protocol::codec::AtomicLongGetAndAddCodec::ResponseParameters::decode(response).response));
+        }
     }
 }
@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 #include "hazelcast/client/IdGenerator.h"
+#include "hazelcast/client/impl/IdGeneratorSupport.h"
+#include "hazelcast/client/spi/ClientContext.h"
+#include "hazelcast/client/ClientProperties.h"
 
 namespace hazelcast {
     namespace client {
@@ -21,9 +24,9 @@ namespace hazelcast {
         IdGenerator::IdGenerator(const std::string& instanceName, spi::ClientContext *context)
         : proxy::ProxyImpl("idGeneratorService", instanceName, context)
         , atomicLong("hz:atomic:idGenerator:" + instanceName, context)
-        , local(new util::AtomicInt(-1))
-        , residue(new util::AtomicInt(BLOCK_SIZE))
-        , localLock(new util::Mutex) {
+        , support(new impl::IdGeneratorSupport(atomicLong, BLOCK_SIZE,
+                                               context->getClientProperties().getIdGeneratorBlockSize().getLong(),
+                                               context->getClientProperties().getIdGeneratorPrefetchBlocks().getInteger())) {
 
         }
 
@@ -34,28 +37,15 @@ namespace hazelcast {
             }
             long step = (id / BLOCK_SIZE);
 
-            util::LockGuard lg(*localLock);
             bool init = atomicLong.compareAndSet(0, step + 1);
             if (init) {
-                *local = step;
-                *residue = (id % BLOCK_SIZE) + 1;
+                support->reset(id + 1, (step + 1) * BLOCK_SIZE);
             }
             return init;
         }
 
         long IdGenerator::newId() {
-            int value = (*residue)++;
-            if (value >= BLOCK_SIZE) {
-                util::LockGuard lg(*localLock);
-                value = *residue;
-                if (value >= BLOCK_SIZE) {
-                    *local = atomicLong.getAndIncrement();
-                    *residue = 0;
-                }
-                return newId();
-
-            }
-            return int(*local) * BLOCK_SIZE + value;
+            return (long) support->newId();
         }
 
         void IdGenerator::onDestroy() {
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/InvocationAdmissionStats.h"
+
+namespace hazelcast {
+    namespace client {
+        InvocationAdmissionStats::InvocationAdmissionStats(int64_t outstandingInvocations,
+                                                           int64_t admittedInvocations, int64_t waitedInvocations,
+                                                           int64_t totalWaitMillis, int64_t maxWaitMillis,
+                                                           int64_t rejectedInvocations,
+                                                           int64_t callerRunsInvocations)
+        : outstandingInvocations(outstandingInvocations)
+        , admittedInvocations(admittedInvocations)
+        , waitedInvocations(waitedInvocations)
+        , totalWaitMillis(totalWaitMillis)
+        , maxWaitMillis(maxWaitMillis)
+        , rejectedInvocations(rejectedInvocations)
+        , callerRunsInvocations(callerRunsInvocations) {
+        }
+
+        int64_t InvocationAdmissionStats::getOutstandingInvocations() const {
+            return outstandingInvocations;
+        }
+
+        int64_t InvocationAdmissionStats::getAdmittedInvocations() const {
+            return admittedInvocations;
+        }
+
+        int64_t InvocationAdmissionStats::getWaitedInvocations() const {
+            return waitedInvocations;
+        }
+
+        int64_t InvocationAdmissionStats::getTotalWaitMillis() const {
+            return totalWaitMillis;
+        }
+
+        int64_t InvocationAdmissionStats::getMaxWaitMillis() const {
+            return maxWaitMillis;
+        }
+
+        int64_t InvocationAdmissionStats::getRejectedInvocations() const {
+            return rejectedInvocations;
+        }
+
+        int64_t InvocationAdmissionStats::getCallerRunsInvocations() const {
+            return callerRunsInvocations;
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/LogRecord.h"
+
+namespace hazelcast {
+    namespace client {
+        LogRecord::LogRecord()
+        : level(INFO)
+        , timeMillis(0)
+        , threadId(0) {
+        }
+
+        LogRecord::LogRecord(LogLevel level, const std::string &message)
+        : level(level)
+        , message(message)
+        , timeMillis(0)
+        , threadId(0) {
+        }
+
+        LogLevel LogRecord::getLevel() const {
+            return level;
+        }
+
+        const std::string &LogRecord::getMessage() const {
+            return message;
+        }
+
+        const LogRecord::Fields &LogRecord::getFields() const {
+            return fields;
+        }
+
+        int64_t LogRecord::getTimeMillis() const {
+            return timeMillis;
+        }
+
+        long LogRecord::getThreadId() const {
+            return threadId;
+        }
+
+        const std::string &LogRecord::getPrefix() const {
+            return prefix;
+        }
+
+        LogRecord &LogRecord::addField(const std::string &name, const std::string &value) {
+            fields.push_back(std::make_pair(name, value));
+            return *this;
+        }
+
+        void LogRecord::swap(LogRecord &other) {
+            std::swap(level, other.level);
+            message.swap(other.message);
+            fields.swap(other.fields);
+            std::swap(timeMillis, other.timeMillis);
+            std::swap(threadId, other.threadId);
+            prefix.swap(other.prefix);
+        }
+    }
+}
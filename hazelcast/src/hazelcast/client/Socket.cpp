@@ -119,13 +119,30 @@ namespace hazelcast {
             FD_SET(socketId, &mySet);
             FD_SET(socketId, &err);
             errno = 0;
-            if (select(socketId + 1, NULL, &mySet, &err, &tv) > 0) {
-                setBlocking(true);
-                return 0;
+            int selectResult = select(socketId + 1, NULL, &mySet, &err, &tv);
+            int error = 0;
+            if (selectResult > 0) {
+                // the connect completed, SO_ERROR tells whether it succeeded
+                #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+                int errorLen = sizeof(error);
+                #else
+                socklen_t errorLen = sizeof(error);
+                #endif
+                if (::getsockopt(socketId, SOL_SOCKET, SO_ERROR, (char *) &error, &errorLen)) {
+                    error = errno;
+                }
+            } else if (selectResult == 0) {
+                #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+                error = WSAETIMEDOUT;
+                #else
+                error = ETIMEDOUT;
+                #endif
+            } else {
+                error = errno;
             }
             setBlocking(true);
 
-            return 0;
+            return error;
         }
 
         void Socket::setBlocking(bool blocking) {
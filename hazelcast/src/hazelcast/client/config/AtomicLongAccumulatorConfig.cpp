@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/config/AtomicLongAccumulatorConfig.h"
+#include "hazelcast/client/exception/IllegalArgumentException.h"
+#include "hazelcast/client/protocol/ClientProtocolErrorCodes.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace config {
+            const int AtomicLongAccumulatorConfig::DEFAULT_FLUSH_INTERVAL_MILLIS = 1000;
+            const int64_t AtomicLongAccumulatorConfig::DEFAULT_FLUSH_THRESHOLD = 0;
+            const int AtomicLongAccumulatorConfig::DEFAULT_STRIPE_COUNT = 16;
+
+            AtomicLongAccumulatorConfig::AtomicLongAccumulatorConfig()
+            : flushIntervalMillis(DEFAULT_FLUSH_INTERVAL_MILLIS)
+            , flushThreshold(DEFAULT_FLUSH_THRESHOLD)
+            , stripeCount(DEFAULT_STRIPE_COUNT) {
+            }
+
+            int AtomicLongAccumulatorConfig::getFlushIntervalMillis() const {
+                return flushIntervalMillis;
+            }
+
+            AtomicLongAccumulatorConfig &AtomicLongAccumulatorConfig::setFlushIntervalMillis(int flushIntervalMillis) {
+                if (flushIntervalMillis <= 0) {
+                    throw exception::IllegalArgumentException("AtomicLongAccumulatorConfig::setFlushIntervalMillis",
+                                                              "flushIntervalMillis should be positive",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->flushIntervalMillis = flushIntervalMillis;
+
+                return *this;
+            }
+
+            int64_t AtomicLongAccumulatorConfig::getFlushThreshold() const {
+                return flushThreshold;
+            }
+
+            AtomicLongAccumulatorConfig &AtomicLongAccumulatorConfig::setFlushThreshold(int64_t flushThreshold) {
+                if (flushThreshold < 0) {
+                    throw exception::IllegalArgumentException("AtomicLongAccumulatorConfig::setFlushThreshold",
+                                                              "flushThreshold should not be negative",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->flushThreshold = flushThreshold;
+
+                return *this;
+            }
+
+            int AtomicLongAccumulatorConfig::getStripeCount() const {
+                return stripeCount;
+            }
+
+            AtomicLongAccumulatorConfig &AtomicLongAccumulatorConfig::setStripeCount(int stripeCount) {
+                if (stripeCount <= 0) {
+                    throw exception::IllegalArgumentException("AtomicLongAccumulatorConfig::setStripeCount",
+                                                              "stripeCount should be positive",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->stripeCount = stripeCount;
+
+                return *this;
+            }
+        }
+    }
+}
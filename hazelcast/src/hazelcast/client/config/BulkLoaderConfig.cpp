@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/config/BulkLoaderConfig.h"
+#include "hazelcast/client/exception/IllegalArgumentException.h"
+#include "hazelcast/client/protocol/ClientProtocolErrorCodes.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace config {
+            const int BulkLoaderConfig::DEFAULT_BATCH_SIZE = 1000;
+            const int BulkLoaderConfig::DEFAULT_LINGER_MILLIS = 100;
+            const int BulkLoaderConfig::DEFAULT_MAX_IN_FLIGHT_PER_MEMBER = 4;
+
+            BulkLoaderConfig::BulkLoaderConfig() : batchSize(DEFAULT_BATCH_SIZE),
+                                                   lingerMillis(DEFAULT_LINGER_MILLIS),
+                                                   maxInFlightPerMember(DEFAULT_MAX_IN_FLIGHT_PER_MEMBER),
+                                                   listener(NULL) {
+            }
+
+            int BulkLoaderConfig::getBatchSize() const {
+                return batchSize;
+            }
+
+            BulkLoaderConfig &BulkLoaderConfig::setBatchSize(int batchSize) {
+                if (batchSize <= 0) {
+                    throw exception::IllegalArgumentException("BulkLoaderConfig::setBatchSize",
+                                                              "batchSize should be positive",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->batchSize = batchSize;
+
+                return *this;
+            }
+
+            int BulkLoaderConfig::getLingerMillis() const {
+                return lingerMillis;
+            }
+
+            BulkLoaderConfig &BulkLoaderConfig::setLingerMillis(int lingerMillis) {
+                if (lingerMillis < 0) {
+                    throw exception::IllegalArgumentException("BulkLoaderConfig::setLingerMillis",
+                                                              "lingerMillis should not be negative",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->lingerMillis = lingerMillis;
+
+                return *this;
+            }
+
+            int BulkLoaderConfig::getMaxInFlightPerMember() const {
+                return maxInFlightPerMember;
+            }
+
+            BulkLoaderConfig &BulkLoaderConfig::setMaxInFlightPerMember(int maxInFlightPerMember) {
+                if (maxInFlightPerMember <= 0) {
+                    throw exception::IllegalArgumentException("BulkLoaderConfig::setMaxInFlightPerMember",
+                                                              "maxInFlightPerMember should be positive",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->maxInFlightPerMember = maxInFlightPerMember;
+
+                return *this;
+            }
+
+            map::BulkLoadListener *BulkLoaderConfig::getListener() const {
+                return listener;
+            }
+
+            BulkLoaderConfig &BulkLoaderConfig::setListener(map::BulkLoadListener *listener) {
+                this->listener = listener;
+
+                return *this;
+            }
+        }
+    }
+}
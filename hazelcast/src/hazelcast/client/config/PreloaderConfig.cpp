@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/config/PreloaderConfig.h"
+#include "hazelcast/client/exception/IllegalArgumentException.h"
+#include "hazelcast/client/protocol/ClientProtocolErrorCodes.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace config {
+            const std::string PreloaderConfig::DEFAULT_DIRECTORY = ".";
+            const int PreloaderConfig::DEFAULT_STORE_INTERVAL_SECONDS = 600;
+            const int PreloaderConfig::DEFAULT_MAX_KEYS = 100000;
+            const int PreloaderConfig::DEFAULT_BATCH_SIZE = 100;
+            const int PreloaderConfig::DEFAULT_MAX_IN_FLIGHT_BATCHES = 4;
+            const int64_t PreloaderConfig::DEFAULT_MAX_BYTES_PER_SECOND = 0;
+
+            PreloaderConfig::PreloaderConfig() : directory(DEFAULT_DIRECTORY),
+                                                 storeIntervalSeconds(DEFAULT_STORE_INTERVAL_SECONDS),
+                                                 maxKeys(DEFAULT_MAX_KEYS),
+                                                 batchSize(DEFAULT_BATCH_SIZE),
+                                                 maxInFlightBatches(DEFAULT_MAX_IN_FLIGHT_BATCHES),
+                                                 maxBytesPerSecond(DEFAULT_MAX_BYTES_PER_SECOND) {
+            }
+
+            const std::string &PreloaderConfig::getDirectory() const {
+                return directory;
+            }
+
+            PreloaderConfig &PreloaderConfig::setDirectory(const std::string &directory) {
+                if (directory.empty()) {
+                    throw exception::IllegalArgumentException("PreloaderConfig::setDirectory",
+                                                              "directory should not be empty",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->directory = directory;
+
+                return *this;
+            }
+
+            int PreloaderConfig::getStoreIntervalSeconds() const {
+                return storeIntervalSeconds;
+            }
+
+            PreloaderConfig &PreloaderConfig::setStoreIntervalSeconds(int storeIntervalSeconds) {
+                if (storeIntervalSeconds < 0) {
+                    throw exception::IllegalArgumentException("PreloaderConfig::setStoreIntervalSeconds",
+                                                              "storeIntervalSeconds should not be negative",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->storeIntervalSeconds = storeIntervalSeconds;
+
+                return *this;
+            }
+
+            int PreloaderConfig::getMaxKeys() const {
+                return maxKeys;
+            }
+
+            PreloaderConfig &PreloaderConfig::setMaxKeys(int maxKeys) {
+                if (maxKeys <= 0) {
+                    throw exception::IllegalArgumentException("PreloaderConfig::setMaxKeys",
+                                                              "maxKeys should be positive",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->maxKeys = maxKeys;
+
+                return *this;
+            }
+
+            int PreloaderConfig::getBatchSize() const {
+                return batchSize;
+            }
+
+            PreloaderConfig &PreloaderConfig::setBatchSize(int batchSize) {
+                if (batchSize <= 0) {
+                    throw exception::IllegalArgumentException("PreloaderConfig::setBatchSize",
+                                                              "batchSize should be positive",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->batchSize = batchSize;
+
+                return *this;
+            }
+
+            int PreloaderConfig::getMaxInFlightBatches() const {
+                return maxInFlightBatches;
+            }
+
+            PreloaderConfig &PreloaderConfig::setMaxInFlightBatches(int maxInFlightBatches) {
+                if (maxInFlightBatches <= 0) {
+                    throw exception::IllegalArgumentException("PreloaderConfig::setMaxInFlightBatches",
+                                                              "maxInFlightBatches should be positive",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->maxInFlightBatches = maxInFlightBatches;
+
+                return *this;
+            }
+
+            int64_t PreloaderConfig::getMaxBytesPerSecond() const {
+                return maxBytesPerSecond;
+            }
+
+            PreloaderConfig &PreloaderConfig::setMaxBytesPerSecond(int64_t maxBytesPerSecond) {
+                if (maxBytesPerSecond < 0) {
+                    throw exception::IllegalArgumentException("PreloaderConfig::setMaxBytesPerSecond",
+                                                              "maxBytesPerSecond should not be negative",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->maxBytesPerSecond = maxBytesPerSecond;
+
+                return *this;
+            }
+        }
+    }
+}
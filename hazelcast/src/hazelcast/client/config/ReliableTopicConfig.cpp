@@ -24,12 +24,21 @@ namespace hazelcast {
     namespace client {
         namespace config {
             const int ReliableTopicConfig::DEFAULT_READ_BATCH_SIZE = 10;
+            const topic::TopicOverloadPolicy ReliableTopicConfig::DEFAULT_TOPIC_OVERLOAD_POLICY = topic::DISCARD_OLDEST;
+            const int ReliableTopicConfig::DEFAULT_PUBLISH_BATCH_SIZE = 100;
+            const int ReliableTopicConfig::DEFAULT_PUBLISH_LINGER_MILLIS = 0;
 
-            ReliableTopicConfig::ReliableTopicConfig() {
+            ReliableTopicConfig::ReliableTopicConfig() : readBatchSize(DEFAULT_READ_BATCH_SIZE),
+                                                         topicOverloadPolicy(DEFAULT_TOPIC_OVERLOAD_POLICY),
+                                                         publishBatchSize(DEFAULT_PUBLISH_BATCH_SIZE),
+                                                         publishLingerMillis(DEFAULT_PUBLISH_LINGER_MILLIS) {
 
             }
 
             ReliableTopicConfig::ReliableTopicConfig(const char *topicName) : readBatchSize(DEFAULT_READ_BATCH_SIZE),
+                                                                              topicOverloadPolicy(DEFAULT_TOPIC_OVERLOAD_POLICY),
+                                                                              publishBatchSize(DEFAULT_PUBLISH_BATCH_SIZE),
+                                                                              publishLingerMillis(DEFAULT_PUBLISH_LINGER_MILLIS),
                                                                               name(topicName) {
             }
 
@@ -52,6 +61,49 @@ namespace hazelcast {
 
                 return *this;
             }
+
+            topic::TopicOverloadPolicy ReliableTopicConfig::getTopicOverloadPolicy() const {
+                return topicOverloadPolicy;
+            }
+
+            ReliableTopicConfig &ReliableTopicConfig::setTopicOverloadPolicy(topic::TopicOverloadPolicy policy) {
+                this->topicOverloadPolicy = policy;
+
+                return *this;
+            }
+
+            int ReliableTopicConfig::getPublishBatchSize() const {
+                return publishBatchSize;
+            }
+
+            ReliableTopicConfig &ReliableTopicConfig::setPublishBatchSize(int batchSize) {
+                // the batch is stored with a single ringbuffer add all call, see Ringbuffer::MAX_BATCH_SIZE
+                if (batchSize <= 0 || batchSize > 1000) {
+                    throw exception::IllegalArgumentException("ReliableTopicConfig::setPublishBatchSize",
+                                                              "publishBatchSize should be between 1 and 1000",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->publishBatchSize = batchSize;
+
+                return *this;
+            }
+
+            int ReliableTopicConfig::getPublishLingerMillis() const {
+                return publishLingerMillis;
+            }
+
+            ReliableTopicConfig &ReliableTopicConfig::setPublishLingerMillis(int lingerMillis) {
+                if (lingerMillis < 0) {
+                    throw exception::IllegalArgumentException("ReliableTopicConfig::setPublishLingerMillis",
+                                                              "publishLingerMillis should not be negative",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->publishLingerMillis = lingerMillis;
+
+                return *this;
+            }
         }
     }
 }
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/config/WriteBehindConfig.h"
+#include "hazelcast/client/exception/IllegalArgumentException.h"
+#include "hazelcast/client/protocol/ClientProtocolErrorCodes.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace config {
+            const int WriteBehindConfig::DEFAULT_COALESCING_WINDOW_MILLIS = 100;
+            const int WriteBehindConfig::DEFAULT_BATCH_SIZE = 1000;
+            const int WriteBehindConfig::DEFAULT_MAX_BUFFERED_ENTRIES = 100000;
+
+            WriteBehindConfig::WriteBehindConfig() : coalescingWindowMillis(DEFAULT_COALESCING_WINDOW_MILLIS),
+                                                     batchSize(DEFAULT_BATCH_SIZE),
+                                                     maxBufferedEntries(DEFAULT_MAX_BUFFERED_ENTRIES),
+                                                     overflowPolicy(BLOCK) {
+            }
+
+            int WriteBehindConfig::getCoalescingWindowMillis() const {
+                return coalescingWindowMillis;
+            }
+
+            WriteBehindConfig &WriteBehindConfig::setCoalescingWindowMillis(int coalescingWindowMillis) {
+                if (coalescingWindowMillis <= 0) {
+                    throw exception::IllegalArgumentException("WriteBehindConfig::setCoalescingWindowMillis",
+                                                              "coalescingWindowMillis should be positive",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->coalescingWindowMillis = coalescingWindowMillis;
+
+                return *this;
+            }
+
+            int WriteBehindConfig::getBatchSize() const {
+                return batchSize;
+            }
+
+            WriteBehindConfig &WriteBehindConfig::setBatchSize(int batchSize) {
+                if (batchSize <= 0) {
+                    throw exception::IllegalArgumentException("WriteBehindConfig::setBatchSize",
+                                                              "batchSize should be positive",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->batchSize = batchSize;
+
+                return *this;
+            }
+
+            int WriteBehindConfig::getMaxBufferedEntries() const {
+                return maxBufferedEntries;
+            }
+
+            WriteBehindConfig &WriteBehindConfig::setMaxBufferedEntries(int maxBufferedEntries) {
+                if (maxBufferedEntries <= 0) {
+                    throw exception::IllegalArgumentException("WriteBehindConfig::setMaxBufferedEntries",
+                                                              "maxBufferedEntries should be positive",
+                                                              protocol::ILLEGAL_ARGUMENT, -1);
+                }
+
+                this->maxBufferedEntries = maxBufferedEntries;
+
+                return *this;
+            }
+
+            WriteBehindConfig::OverflowPolicy WriteBehindConfig::getOverflowPolicy() const {
+                return overflowPolicy;
+            }
+
+            WriteBehindConfig &WriteBehindConfig::setOverflowPolicy(OverflowPolicy overflowPolicy) {
+                this->overflowPolicy = overflowPolicy;
+
+                return *this;
+            }
+        }
+    }
+}
@@ -91,6 +91,10 @@ namespace hazelcast {
             const Connection &CallFuture::getConnection() const {
                 return *connection;
             }
+
+            void CallFuture::setCompletionListener(boost::shared_ptr<CallCompletionListener> listener) {
+                promise->setCompletionListener(listener);
+            }
         }
     }
 }
@@ -20,25 +20,34 @@
 #include "hazelcast/client/impl/BaseEventHandler.h"
 #include "hazelcast/client/Address.h"
 #include "hazelcast/client/connection/CallPromise.h"
+#include "hazelcast/client/connection/CallCompletionListener.h"
+#include "hazelcast/client/spi/impl/AdmissionController.h"
+#include "hazelcast/util/LockGuard.h"
 #include "hazelcast/client/protocol/ClientMessage.h"
 
 namespace hazelcast {
     namespace client {
         namespace connection {
             CallPromise::CallPromise()
-            : resendCount(0) {
+            : resendCount(0)
+            , sendTime(0)
+            , completed(false)
+            , admissionController(NULL) {
             }
 
             void CallPromise::setResponse(std::auto_ptr<protocol::ClientMessage> message) {
                 this->future.set_value(message);
+                notifyCompletion();
             }
 
             void CallPromise::setException(std::auto_ptr<exception::IException> exception) {
                 future.set_exception(exception);
+                notifyCompletion();
             }
 
             void CallPromise::resetException(std::auto_ptr<exception::IException> exception) {
                 future.reset_exception(exception);
+                notifyCompletion();
             }
 
             void CallPromise::setRequest(std::auto_ptr<protocol::ClientMessage> request) {
@@ -65,9 +74,50 @@ namespace hazelcast {
                 return ++resendCount;
             }
 
+            void CallPromise::setSendTime(int64_t sendTimeMillis) {
+                sendTime = sendTimeMillis;
+            }
+
+            int64_t CallPromise::getSendTime() const {
+                return sendTime;
+            }
+
             void CallPromise::resetFuture() {
                 future.reset();
             }
+
+            void CallPromise::setCompletionListener(boost::shared_ptr<CallCompletionListener> listener) {
+                {
+                    util::LockGuard guard(completionLock);
+                    if (!completed) {
+                        completionListener = listener;
+                        return;
+                    }
+                }
+                listener->onComplete();
+            }
+
+            void CallPromise::setAdmissionController(spi::impl::AdmissionController *admissionController) {
+                this->admissionController = admissionController;
+            }
+
+            void CallPromise::notifyCompletion() {
+                boost::shared_ptr<CallCompletionListener> listener;
+                bool firstCompletion;
+                {
+                    util::LockGuard guard(completionLock);
+                    firstCompletion = !completed;
+                    completed = true;
+                    // the listener is notified only once even if the exception of the call is reset later
+                    listener.swap(completionListener);
+                }
+                if (firstCompletion && NULL != admissionController) {
+                    admissionController->release();
+                }
+                if (NULL != listener.get()) {
+                    listener->onComplete();
+                }
+            }
         }
     }
 }
@@ -196,6 +196,7 @@ namespace hazelcast {
                         util::ILogger::getLogger().warning(buf);
                 }
                 clientContext.getPartitionService().wakeup();
+                clientContext.getServerListenerService().wakeup();
             }
 
             void ClusterListenerThread::handleMemberList(const std::vector<Member> &initialMembers) {
@@ -26,7 +26,9 @@
 #include "hazelcast/client/connection/OutputSocketStream.h"
 #include "hazelcast/client/connection/InputSocketStream.h"
 #include "hazelcast/client/connection/CallFuture.h"
+#include "hazelcast/client/ClientProperties.h"
 #include "hazelcast/util/Util.h"
+#include "hazelcast/util/LockGuard.h"
 
 #include <stdint.h>
 #include <string.h>
@@ -46,12 +48,15 @@ namespace hazelcast {
             , invocationService(clientContext.getInvocationService())
             , socket(address)
             , readHandler(*this, iListener, 16 << 10, clientContext)
-            , writeHandler(*this, oListener, 16 << 10)
+            , writeHandler(*this, oListener, 16 << 10,
+                           clientContext.getClientProperties().getMessageFragmentSize().getInteger())
             , _isOwnerConnection(isOwner)
             , receiveBuffer(new byte[16 << 10])
             , receiveByteBuffer((char *)receiveBuffer, 16 << 10)
             , messageBuilder(*this, *this)
-            , connectionId(-1) {
+            , connectionId(-1)
+            , pendingCallCount(0)
+            , averageResponseTime(0) {
                 wrapperMessage.wrapForDecode(receiveBuffer, (int32_t)16 << 10, false);
                 assert(receiveByteBuffer.remaining() >= protocol::ClientMessage::HEADER_SIZE); // Note: Always make sure that the size >= ClientMessage header size.
             }
@@ -89,10 +94,14 @@ namespace hazelcast {
                 const Address &serverAddr = getRemoteEndpoint();
                 int socketId = socket.getSocketId();
                 
-                std::stringstream message;
-                message << "Closing connection (id:" << connectionId << ") to " << serverAddr << " with socket id " << socketId <<
-                        (_isOwnerConnection ? " as the owner connection." : ".");
-                util::ILogger::getLogger().warning(message.str());
+                util::ILogger &logger = util::ILogger::getLogger();
+                if (logger.isEnabled(WARNING)) {
+                    LogRecord record(WARNING, _isOwnerConnection ? "Closing the owner connection" : "Closing connection");
+                    record.addField("connectionId", connectionId);
+                    record.addField("address", serverAddr);
+                    record.addField("socketId", socketId);
+                    logger.log(record);
+                }
                 if (!_isOwnerConnection) {
                     readHandler.deRegisterSocket();
                 }
@@ -210,6 +219,38 @@ namespace hazelcast {
                 Connection::connectionId = connectionId;
             }
 
+            void Connection::callStarted() {
+                ++pendingCallCount;
+            }
+
+            void Connection::callEnded() {
+                --pendingCallCount;
+            }
+
+            void Connection::recordResponseTime(int64_t responseTimeMillis) {
+                // weight of the latest response time in the moving average
+                static const double ALPHA = 0.2;
+                util::LockGuard guard(responseTimeLock);
+                averageResponseTime += ALPHA * ((double) responseTimeMillis - averageResponseTime);
+            }
+
+            int Connection::getPendingCallCount() {
+                return pendingCallCount;
+            }
+
+            double Connection::getAverageResponseTime() {
+                util::LockGuard guard(responseTimeLock);
+                return averageResponseTime;
+            }
+
+            size_t Connection::getWriteQueueSize() {
+                return writeHandler.getQueueSize();
+            }
+
+            int64_t Connection::getWriteQueueBytes() {
+                return writeHandler.getQueuedBytes();
+            }
+
             bool Connection::isOwnerConnection() const {
                 return _isOwnerConnection;
             }
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/connection/ConnectionGroup.h"
+#include "hazelcast/client/connection/Connection.h"
+#include "hazelcast/util/LockGuard.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace connection {
+            ConnectionGroup::ConnectionGroup(int stripeCount)
+                    : stripes(stripeCount > 0 ? stripeCount : 1) {
+            }
+
+            int ConnectionGroup::getStripeCount() const {
+                return (int) stripes.size();
+            }
+
+            boost::shared_ptr<Connection> ConnectionGroup::get(int stripe) {
+                util::LockGuard guard(lock);
+                return stripes[stripe];
+            }
+
+            boost::shared_ptr<Connection> ConnectionGroup::getAny() {
+                util::LockGuard guard(lock);
+                for (std::vector<boost::shared_ptr<Connection> >::const_iterator it = stripes.begin();
+                     it != stripes.end(); ++it) {
+                    if (it->get() != NULL) {
+                        return *it;
+                    }
+                }
+                return boost::shared_ptr<Connection>();
+            }
+
+            void ConnectionGroup::set(int stripe, boost::shared_ptr<Connection> connection) {
+                util::LockGuard guard(lock);
+                stripes[stripe] = connection;
+            }
+
+            boost::shared_ptr<Connection> ConnectionGroup::remove(int socketId) {
+                util::LockGuard guard(lock);
+                for (std::vector<boost::shared_ptr<Connection> >::iterator it = stripes.begin();
+                     it != stripes.end(); ++it) {
+                    if (it->get() != NULL && (*it)->getSocket().getSocketId() == socketId) {
+                        boost::shared_ptr<Connection> removed = *it;
+                        it->reset();
+                        return removed;
+                    }
+                }
+                return boost::shared_ptr<Connection>();
+            }
+
+            std::vector<boost::shared_ptr<Connection> > ConnectionGroup::getConnections() {
+                util::LockGuard guard(lock);
+                std::vector<boost::shared_ptr<Connection> > connections;
+                for (std::vector<boost::shared_ptr<Connection> >::const_iterator it = stripes.begin();
+                     it != stripes.end(); ++it) {
+                    if (it->get() != NULL) {
+                        connections.push_back(*it);
+                    }
+                }
+                return connections;
+            }
+        }
+    }
+}
@@ -29,6 +29,7 @@
 #include "hazelcast/client/protocol/codec/ClientAuthenticationCustomCodec.h"
 #include "hazelcast/client/protocol/codec/ErrorCodec.h"
 #include "hazelcast/client/ClientConfig.h"
+#include "hazelcast/client/ClientProperties.h"
 #include "hazelcast/client/exception/InstanceNotActiveException.h"
 #include "hazelcast/client/spi/InvocationService.h"
 #include "hazelcast/util/Thread.h"
@@ -43,24 +44,45 @@ namespace hazelcast {
     namespace client {
         namespace connection {
             ConnectionManager::ConnectionManager(spi::ClientContext &clientContext, bool smartRouting)
-                    : clientContext(clientContext), inSelector(*this), outSelector(*this), inSelectorThread(NULL),
-                      outSelectorThread(NULL), live(true), heartBeater(clientContext),
+                    : clientContext(clientContext), connectionsPerMember(1), live(true), heartBeater(clientContext),
                       heartBeatThread(NULL), smartRouting(smartRouting), ownerConnectionFuture(clientContext),
-                      callIdGenerator(0), connectionIdCounter(0) {
+                      callIdGenerator(0), connectionIdCounter(0), stripeCounter(0), selectorCounter(0) {
                 const byte protocol_bytes[3] = {'C', 'B', '2'};
                 PROTOCOL.insert(PROTOCOL.begin(), &protocol_bytes[0], &protocol_bytes[3]);
             }
 
             bool ConnectionManager::start() {
                 socketInterceptor = clientContext.getClientConfig().getSocketInterceptor();
-                if (!inSelector.start()) {
-                    return false;
+                ClientProperties &properties = clientContext.getClientProperties();
+                connectionsPerMember = properties.getConnectionsPerMember().getInteger();
+                if (connectionsPerMember < 1) {
+                    connectionsPerMember = 1;
                 }
-                if (!outSelector.start()) {
-                    return false;
+                int ioThreadCount = properties.getIOThreadCount().getInteger();
+                if (ioThreadCount < 1) {
+                    ioThreadCount = 1;
+                }
+                for (int i = 0; i < ioThreadCount; ++i) {
+                    boost::shared_ptr<InSelector> inSelector(new InSelector(*this));
+                    if (!inSelector->start()) {
+                        return false;
+                    }
+                    boost::shared_ptr<OutSelector> outSelector(new OutSelector(*this));
+                    if (!outSelector->start()) {
+                        return false;
+                    }
+                    inSelectors.push_back(inSelector);
+                    outSelectors.push_back(outSelector);
+                }
+                for (int i = 0; i < ioThreadCount; ++i) {
+                    std::string suffix = i == 0 ? "" : util::IOUtil::to_string(i);
+                    selectorThreads.push_back(boost::shared_ptr<util::Thread>(
+                            new util::Thread("hz.inListener" + suffix, InSelector::staticListen,
+                                             inSelectors[i].get())));
+                    selectorThreads.push_back(boost::shared_ptr<util::Thread>(
+                            new util::Thread("hz.outListener" + suffix, OutSelector::staticListen,
+                                             outSelectors[i].get())));
                 }
-                inSelectorThread.reset(new util::Thread("hz.inListener", InSelector::staticListen, &inSelector));
-                outSelectorThread.reset(new util::Thread("hz.outListener", OutSelector::staticListen, &outSelector));
                 heartBeatThread.reset(new util::Thread("hz.heartbeater", HeartBeater::staticStart, &heartBeater));
                 return true;
             }
@@ -73,19 +95,17 @@ namespace hazelcast {
                     heartBeatThread->join();
                     heartBeatThread.reset();
                 }
-                inSelector.shutdown();
-                outSelector.shutdown();
-                if (inSelectorThread.get() != NULL) {
-                    inSelectorThread->cancel();
-                    inSelectorThread->join();
-                    inSelectorThread.reset();
+                for (size_t i = 0; i < inSelectors.size(); ++i) {
+                    inSelectors[i]->shutdown();
+                    outSelectors[i]->shutdown();
                 }
-                if (outSelectorThread.get() != NULL) {
-                    outSelectorThread->cancel();
-                    outSelectorThread->join();
-                    outSelectorThread.reset();
+                for (std::vector<boost::shared_ptr<util::Thread> >::iterator it = selectorThreads.begin();
+                     it != selectorThreads.end(); ++it) {
+                    (*it)->cancel();
+                    (*it)->join();
                 }
-                connections.clear();
+                selectorThreads.clear();
+                connectionGroups.clear();
                 socketConnections.clear();
             }
 
@@ -98,6 +118,12 @@ namespace hazelcast {
                 return ownerConnectionFuture.createNew(address);
             }
 
+            boost::shared_ptr<Connection> ConnectionManager::createOwnerConnection(
+                    std::auto_ptr<Connection> connection) {
+                authenticate(connection.get());
+                return ownerConnectionFuture.createNew(connection);
+            }
+
             boost::shared_ptr<connection::Connection> ConnectionManager::getRandomConnection(int tryCount) {
                 Address address = clientContext.getClientConfig().getLoadBalancer()->next().getAddress();
                 return getOrConnect(address, tryCount);
@@ -135,11 +161,17 @@ namespace hazelcast {
 
             boost::shared_ptr<connection::Connection> ConnectionManager::getOrConnect(const Address &target,
                                                                                       int tryCount) {
+                return getOrConnect(target, tryCount, -1);
+            }
+
+            boost::shared_ptr<connection::Connection> ConnectionManager::getOrConnect(const Address &target,
+                                                                                      int tryCount,
+                                                                                      int partitionId) {
                 checkLive();
 
                 try {
                     if (clientContext.getClusterService().isMemberExists(target)) {
-                        boost::shared_ptr<Connection> connection = getOrConnect(target);
+                        boost::shared_ptr<Connection> connection = getOrConnectStripe(target, getStripe(partitionId));
                         // Only return the live connections
                         if (connection->live) {
                             return connection;
@@ -170,7 +202,11 @@ namespace hazelcast {
             boost::shared_ptr<Connection> ConnectionManager::getConnectionIfAvailable(const Address &address) {
                 if (!live)
                     return boost::shared_ptr<Connection>();
-                return connections.get(address);
+                boost::shared_ptr<ConnectionGroup> group = connectionGroups.get(address);
+                if (group.get() == NULL) {
+                    return boost::shared_ptr<Connection>();
+                }
+                return group->getAny();
             }
 
             boost::shared_ptr<Connection> ConnectionManager::getConnectionIfAvailable(int socketDescriptor) {
@@ -179,10 +215,10 @@ namespace hazelcast {
                 return socketConnections.get(socketDescriptor);
             }
 
-            boost::shared_ptr<Connection> ConnectionManager::getOrConnect(const Address &address) {
+            boost::shared_ptr<Connection> ConnectionManager::getOrConnectStripe(const Address &address, int stripe) {
                 checkLive();
                 if (smartRouting) {
-                    return getOrConnectResolved(address);
+                    return getOrConnectResolved(address, stripe);
                 }
 
                 return getOwnerConnection();
@@ -190,30 +226,69 @@ namespace hazelcast {
 
             boost::shared_ptr<Connection> ConnectionManager::getOwnerConnection() {
                 boost::shared_ptr<Connection> ownerConnPtr = ownerConnectionFuture.getOrWaitForCreation();
-                return getOrConnectResolved(ownerConnPtr->getRemoteEndpoint());
+                return getOrConnectResolved(ownerConnPtr->getRemoteEndpoint(), 0);
             }
 
 
-            boost::shared_ptr<Connection> ConnectionManager::getOrConnectResolved(const Address &address) {
-                boost::shared_ptr<Connection> conn = connections.get(address);
+            boost::shared_ptr<Connection> ConnectionManager::getOrConnectResolved(const Address &address, int stripe) {
+                boost::shared_ptr<Connection> conn = getStripeConnection(address, stripe);
                 if (conn.get() == NULL) {
                     util::LockGuard l(lockMutex);
-                    conn = connections.get(address);
+                    conn = getStripeConnection(address, stripe);
                     if (conn.get() == NULL) {
+                        // the group is created after the connect succeeds, a failed connect leaves no empty group
                         boost::shared_ptr<Connection> newConnection(connectTo(address, false));
-                        newConnection->getReadHandler().registerSocket();
-                        connections.put(newConnection->getRemoteEndpoint(), newConnection);
                         socketConnections.put(newConnection->getSocket().getSocketId(), newConnection);
+                        newConnection->getReadHandler().registerSocket();
+                        {
+                            util::LockGuard guard(connectionGroupsLock);
+                            // a connection closed before this point is already passed by onConnectionClose
+                            if (newConnection->live) {
+                                getConnectionGroup(newConnection->getRemoteEndpoint())->set(stripe, newConnection);
+                            }
+                        }
                         return newConnection;
                     }
                 }
                 return conn;
             }
 
+            boost::shared_ptr<Connection> ConnectionManager::getStripeConnection(const Address &address, int stripe) {
+                boost::shared_ptr<ConnectionGroup> group = connectionGroups.get(address);
+                if (group.get() == NULL) {
+                    return boost::shared_ptr<Connection>();
+                }
+                return group->get(stripe);
+            }
+
             boost::shared_ptr<Connection> ConnectionManager::getRandomConnection() {
                 checkLive();
                 Address address = clientContext.getClientConfig().getLoadBalancer()->next().getAddress();
-                return getOrConnect(address);
+                return getOrConnectStripe(address, getStripe(-1));
+            }
+
+            boost::shared_ptr<ConnectionGroup> ConnectionManager::getConnectionGroup(const Address &address) {
+                boost::shared_ptr<ConnectionGroup> group = connectionGroups.get(address);
+                if (group.get() == NULL) {
+                    group.reset(new ConnectionGroup(connectionsPerMember));
+                    connectionGroups.put(address, group);
+                }
+                return group;
+            }
+
+            int ConnectionManager::getStripe(int partitionId) {
+                if (connectionsPerMember == 1) {
+                    return 0;
+                }
+                if (partitionId >= 0) {
+                    return partitionId % connectionsPerMember;
+                }
+                // the invocations which are not bound to a partition are spread over the stripes
+                return ((++stripeCounter) & 0x7FFFFFFF) % connectionsPerMember;
+            }
+
+            size_t ConnectionManager::nextSelectorIndex() {
+                return (size_t) ((++selectorCounter) & 0x7FFFFFFF) % inSelectors.size();
             }
 
             void ConnectionManager::authenticate(Connection *connection) {
@@ -326,7 +401,16 @@ namespace hazelcast {
 
             void ConnectionManager::onConnectionClose(const Address &address, int socketId) {
                 socketConnections.remove(socketId);
-                connections.remove(address);
+                {
+                    util::LockGuard guard(connectionGroupsLock);
+                    boost::shared_ptr<ConnectionGroup> group = connectionGroups.get(address);
+                    if (group.get() != NULL) {
+                        group->remove(socketId);
+                        if (group->getConnections().empty()) {
+                            connectionGroups.remove(address);
+                        }
+                    }
+                }
                 ownerConnectionFuture.closeIfAddressMatches(address);
             }
 
@@ -337,22 +421,45 @@ namespace hazelcast {
             }
 
             std::auto_ptr<Connection> ConnectionManager::connectTo(const Address &address, bool ownerConnection) {
-                std::auto_ptr<connection::Connection> conn(
-                        new Connection(address, clientContext, inSelector, outSelector, ownerConnection));
+                std::auto_ptr<connection::Connection> conn = openConnection(address, ownerConnection);
+
+                authenticate(conn.get());
+                return conn;
+            }
 
+            std::auto_ptr<Connection> ConnectionManager::openConnection(const Address &address, bool ownerConnection) {
                 checkLive();
+                size_t selectorIndex = nextSelectorIndex();
+                std::auto_ptr<connection::Connection> conn(
+                        new Connection(address, clientContext, *inSelectors[selectorIndex],
+                                       *outSelectors[selectorIndex], ownerConnection));
+
                 conn->connect(clientContext.getClientConfig().getConnectionTimeout());
                 if (socketInterceptor != NULL) {
                     socketInterceptor->onConnect(conn->getSocket());
                 }
 
-                authenticate(conn.get());
                 return conn;
             }
 
 
             std::vector<boost::shared_ptr<Connection> > ConnectionManager::getConnections() {
-                return connections.values();
+                std::vector<boost::shared_ptr<Connection> > result;
+                std::vector<boost::shared_ptr<ConnectionGroup> > groups = connectionGroups.values();
+                for (std::vector<boost::shared_ptr<ConnectionGroup> >::const_iterator it = groups.begin();
+                     it != groups.end(); ++it) {
+                    std::vector<boost::shared_ptr<Connection> > stripes = (*it)->getConnections();
+                    result.insert(result.end(), stripes.begin(), stripes.end());
+                }
+                return result;
+            }
+
+            std::vector<boost::shared_ptr<Connection> > ConnectionManager::getConnections(const Address &address) {
+                boost::shared_ptr<ConnectionGroup> group = connectionGroups.get(address);
+                if (group.get() == NULL) {
+                    return std::vector<boost::shared_ptr<Connection> >();
+                }
+                return group->getConnections();
             }
 
             void ConnectionManager::onDetectingUnresponsiveConnection(Connection &connection) {
@@ -366,9 +473,18 @@ namespace hazelcast {
             }
 
             void ConnectionManager::removeEndpoint(const Address &address) {
-                boost::shared_ptr<Connection> connection = getConnectionIfAvailable(address);
-                if (connection.get() != NULL) {
-                    connection->close();
+                boost::shared_ptr<ConnectionGroup> group;
+                {
+                    util::LockGuard guard(connectionGroupsLock);
+                    group = connectionGroups.remove(address);
+                }
+                if (group.get() == NULL) {
+                    return;
+                }
+                std::vector<boost::shared_ptr<Connection> > stripes = group->getConnections();
+                for (std::vector<boost::shared_ptr<Connection> >::const_iterator it = stripes.begin();
+                     it != stripes.end(); ++it) {
+                    (*it)->close();
                 }
             }
 
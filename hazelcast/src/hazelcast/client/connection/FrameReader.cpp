@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <string.h>
+
+#include "hazelcast/client/connection/FrameReader.h"
+#include "hazelcast/client/protocol/ClientMessageBuilder.h"
+#include "hazelcast/client/Socket.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace connection {
+            FrameReader::FrameReader(protocol::ClientMessageBuilder &builder, size_t bufferSize)
+            : builder(builder)
+            , buffer(new char[bufferSize])
+            , initialBufferSize(bufferSize)
+            , bufferSize(bufferSize)
+            , underusedReadCount(0)
+            , byteBuffer(buffer, bufferSize) {
+            }
+
+            FrameReader::~FrameReader() {
+                delete [] buffer;
+            }
+
+            void FrameReader::readFrom(Socket &socket) {
+                // The header of a large frame is already processed and the staging buffer is empty. Read the rest
+                // of the frame directly into the frame buffer instead of copying it through the staging buffer.
+                if (byteBuffer.position() == 0 && builder.getRemainingFrameLength() >= (int32_t) bufferSize) {
+                    builder.onData(socket);
+                    return;
+                }
+
+                size_t numBytesRead = byteBuffer.readFrom(socket);
+
+                if (byteBuffer.position() == 0)
+                    return;
+                bool isBufferFilled = !byteBuffer.hasRemaining();
+                byteBuffer.flip();
+
+                // it is important to check the onData return value since there may be left data less than a message
+                // header size, and this may cause an infinite loop.
+                while (byteBuffer.hasRemaining() && builder.onData(byteBuffer)) {
+                }
+
+                if (byteBuffer.hasRemaining()) {
+                    byteBuffer.compact();
+                } else {
+                    byteBuffer.clear();
+                }
+
+                adaptBufferSize(numBytesRead, isBufferFilled);
+            }
+
+            size_t FrameReader::getBufferSize() const {
+                return bufferSize;
+            }
+
+            void FrameReader::adaptBufferSize(size_t numBytesRead, bool isBufferFilled) {
+                if (isBufferFilled) {
+                    underusedReadCount = 0;
+                    if (bufferSize < MAX_BUFFER_SIZE) {
+                        resizeBuffer(bufferSize << 1);
+                    }
+                } else if (bufferSize > initialBufferSize && numBytesRead < (bufferSize >> 2)) {
+                    if (++underusedReadCount >= SHRINK_THRESHOLD && byteBuffer.position() < (bufferSize >> 1)) {
+                        underusedReadCount = 0;
+                        resizeBuffer(bufferSize >> 1);
+                    }
+                } else {
+                    underusedReadCount = 0;
+                }
+            }
+
+            void FrameReader::resizeBuffer(size_t newSize) {
+                // the buffer is in write mode here, the bytes before the position are not processed yet
+                size_t numPendingBytes = byteBuffer.position();
+                char *newBuffer = new char[newSize];
+                memcpy(newBuffer, buffer, numPendingBytes);
+                delete [] buffer;
+                buffer = newBuffer;
+                bufferSize = newSize;
+                byteBuffer = util::ByteBuffer(buffer, bufferSize);
+                byteBuffer.position(numPendingBytes);
+            }
+        }
+    }
+}
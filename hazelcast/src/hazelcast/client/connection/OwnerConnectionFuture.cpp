@@ -39,7 +39,11 @@ namespace hazelcast {
             }
 
             boost::shared_ptr<Connection> OwnerConnectionFuture::createNew(const Address& address) {
-                ownerConnectionPtr = clientContext.getConnectionManager().connectTo(address, true);
+                return createNew(clientContext.getConnectionManager().connectTo(address, true));
+            }
+
+            boost::shared_ptr<Connection> OwnerConnectionFuture::createNew(std::auto_ptr<Connection> connection) {
+                ownerConnectionPtr = connection;
                 ownerConnectionPtr->setAsOwnerConnection(true);
                 return ownerConnectionPtr;
             }
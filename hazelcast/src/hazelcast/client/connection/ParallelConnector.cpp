@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sstream>
+
+#include "hazelcast/client/connection/ParallelConnector.h"
+#include "hazelcast/client/connection/Connection.h"
+#include "hazelcast/client/connection/ConnectionManager.h"
+#include "hazelcast/client/exception/IException.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/IOUtil.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace connection {
+            ParallelConnector::ParallelConnector(ConnectionManager &connectionManager,
+                                                 const std::vector<Address> &addresses, bool ownerConnection)
+            : connectionManager(connectionManager)
+            , addresses(addresses)
+            , ownerConnection(ownerConnection)
+            , pendingAttempts(addresses.size())
+            , cancelled(false) {
+                for (size_t i = 0; i < this->addresses.size(); ++i) {
+                    threads.push_back(boost::shared_ptr<util::Thread>(
+                            new util::Thread("hz.parallelConnector", staticConnect, this, &this->addresses[i])));
+                }
+            }
+
+            ParallelConnector::~ParallelConnector() {
+                cancel();
+                for (std::vector<boost::shared_ptr<util::Thread> >::const_iterator it = threads.begin();
+                     it != threads.end(); ++it) {
+                    (*it)->join();
+                }
+            }
+
+            std::auto_ptr<Connection> ParallelConnector::next() {
+                util::LockGuard guard(lock);
+                while (established.empty() && pendingAttempts > 0 && !cancelled) {
+                    stateChanged.wait(lock);
+                }
+
+                if (established.empty() || cancelled) {
+                    return std::auto_ptr<Connection>();
+                }
+
+                std::auto_ptr<Connection> connection(established.front());
+                established.pop_front();
+                return connection;
+            }
+
+            void ParallelConnector::cancel() {
+                std::deque<Connection *> connections;
+                {
+                    util::LockGuard guard(lock);
+                    cancelled = true;
+                    connections.swap(established);
+                    stateChanged.notify_all();
+                }
+
+                for (std::deque<Connection *>::const_iterator it = connections.begin(); it != connections.end(); ++it) {
+                    util::IOUtil::closeResource(*it);
+                    delete *it;
+                }
+            }
+
+            std::string ParallelConnector::getLastError() {
+                util::LockGuard guard(lock);
+                return lastError;
+            }
+
+            void ParallelConnector::staticConnect(util::ThreadArgs &args) {
+                ParallelConnector *connector = (ParallelConnector *) args.arg0;
+                const Address *address = (const Address *) args.arg1;
+                connector->connect(*address);
+            }
+
+            void ParallelConnector::connect(const Address &address) {
+                std::auto_ptr<Connection> connection;
+                std::string error;
+                try {
+                    connection = connectionManager.openConnection(address, ownerConnection);
+                } catch (exception::IException &e) {
+                    std::ostringstream out;
+                    out << "Could not connect to " << address << " => " << e.what();
+                    error = out.str();
+                }
+
+                util::LockGuard guard(lock);
+                --pendingAttempts;
+                if (NULL == connection.get()) {
+                    lastError = error;
+                } else if (cancelled) {
+                    util::IOUtil::closeResource(connection.get());
+                } else {
+                    established.push_back(connection.release());
+                }
+                stateChanged.notify_all();
+            }
+        }
+    }
+}
@@ -34,14 +34,12 @@ namespace hazelcast {
         namespace connection {
             ReadHandler::ReadHandler(Connection &connection, InSelector &iListener, size_t bufferSize, spi::ClientContext& clientContext)
             : IOHandler(connection, iListener)
-            , buffer(new char[bufferSize])
-            , byteBuffer(buffer, bufferSize)
-            , builder(clientContext.getInvocationService(), connection) {
+            , builder(clientContext.getInvocationService(), connection)
+            , reader(builder, bufferSize) {
 		        connection.lastRead = time(NULL);
             }
 
             ReadHandler::~ReadHandler() {
-                delete [] buffer;
             }
 
             void ReadHandler::run() {
@@ -51,25 +49,9 @@ namespace hazelcast {
             void ReadHandler::handle() {
                 connection.lastRead = time(NULL);
                 try {
-                    byteBuffer.readFrom(connection.getSocket());
+                    reader.readFrom(connection.getSocket());
                 } catch (exception::IOException &e) {
                     handleSocketException(e.what());
-                    return;
-                }
-
-                if (byteBuffer.position() == 0)
-                    return;
-                byteBuffer.flip();
-
-                // it is important to check the onData return value since there may be left data less than a message
-                // header size, and this may cause an infinite loop.
-                while (byteBuffer.hasRemaining() && builder.onData(byteBuffer)) {
-                }
-
-                if (byteBuffer.hasRemaining()) {
-                    byteBuffer.compact();
-                } else {
-                    byteBuffer.clear();
                 }
             }
         }
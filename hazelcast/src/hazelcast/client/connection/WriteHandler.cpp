@@ -28,8 +28,11 @@
 namespace hazelcast {
     namespace client {
         namespace connection {
-            WriteHandler::WriteHandler(Connection &connection, OutSelector &oListener, size_t bufferSize)
-                    : IOHandler(connection, oListener), ready(false), informSelector(true), lastMessage(NULL) {
+            WriteHandler::WriteHandler(Connection &connection, OutSelector &oListener, size_t bufferSize,
+                                       int32_t maxFragmentSize)
+                    : IOHandler(connection, oListener), ready(false), informSelector(true), lastMessage(NULL),
+                      maxFragmentSize(maxFragmentSize), heldMessage(NULL), fragmentHeaderLen(0),
+                      fragmentDataStart(0), fragmentTurn(false), queuedBytes(0), lastMessageReleasedBytes(0) {
             }
 
 
@@ -49,8 +52,16 @@ namespace hazelcast {
                 }
             }
 
-            // TODO: Add a fragmentation layer here before putting the message into the write queue
+            size_t WriteHandler::getQueueSize() {
+                return writeQueue.size();
+            }
+
+            int64_t WriteHandler::getQueuedBytes() {
+                return queuedBytes;
+            }
+
             void WriteHandler::enqueueData(protocol::ClientMessage *message) {
+                queuedBytes += message->getFrameLength();
                 writeQueue.offer(message);
                 if (informSelector.compareAndSet(true, false)) {
                     ioSelector.addTask(this);
@@ -60,30 +71,20 @@ namespace hazelcast {
 
             void WriteHandler::handle() {
                 if (lastMessage == NULL) {
-                    lastMessage = writeQueue.poll();
-                    if (lastMessage == NULL) {
+                    if (!pollNextFrame()) {
                         ready = true;
                         return;
                     }
-
-                    if (NULL != lastMessage) {
-                        numBytesWrittenToSocketForMessage = 0;
-                        lastMessageFrameLen = lastMessage->getFrameLength();
-                    }
                 }
 
                 while (NULL != lastMessage) {
                     try {
-                        numBytesWrittenToSocketForMessage += lastMessage->writeTo(connection.getSocket(),
-                                                               numBytesWrittenToSocketForMessage, lastMessageFrameLen);
+                        numBytesWrittenToSocketForMessage += writeLastMessage();
 
                         if (numBytesWrittenToSocketForMessage >= lastMessageFrameLen) {
+                            queuedBytes -= lastMessageReleasedBytes;
                             // Not deleting message since its memory management is at the future object
-                            lastMessage = writeQueue.poll();
-                            if (NULL != lastMessage) {
-                                numBytesWrittenToSocketForMessage = 0;
-                                lastMessageFrameLen = lastMessage->getFrameLength();
-                            }
+                            pollNextFrame();
                         } else {
                             // Message could not be sent completely, just continue with another connection
                             break;
@@ -97,7 +98,131 @@ namespace hazelcast {
                 ready = false;
                 registerHandler();
             }
+
+            bool WriteHandler::pollNextFrame() {
+                lastMessage = NULL;
+
+                if (!fragmentTurn || fragmentedMessages.empty()) {
+                    if (pollNextWholeMessage()) {
+                        fragmentTurn = true;
+                        return true;
+                    }
+                }
+
+                fragmentTurn = false;
+                return pollNextFragment();
+            }
+
+            bool WriteHandler::pollNextWholeMessage() {
+                protocol::ClientMessage *message = heldMessage;
+                heldMessage = NULL;
+                if (NULL == message) {
+                    message = writeQueue.poll();
+                }
+
+                while (NULL != message) {
+                    if (!mayOvertakeFragmentedMessages(*message)) {
+                        heldMessage = message;
+                        return false;
+                    }
+
+                    if (!isFragmentationRequired(*message)) {
+                        setLastMessage(message, message->getFrameLength(), message->getFrameLength());
+                        return true;
+                    }
+
+                    fragmentedMessages.push_back(FragmentedMessage(message, message->getDataOffset()));
+                    message = writeQueue.poll();
+                }
+                return false;
+            }
+
+            bool WriteHandler::pollNextFragment() {
+                if (fragmentedMessages.empty()) {
+                    return false;
+                }
+
+                FragmentedMessage fragmentedMessage = fragmentedMessages.front();
+                fragmentedMessages.pop_front();
+
+                protocol::ClientMessage *message = fragmentedMessage.first;
+                int32_t dataStart = fragmentedMessage.second;
+                int32_t frameLen = message->getFrameLength();
+                int32_t length = frameLen - dataStart;
+                if (length > maxFragmentSize) {
+                    length = maxFragmentSize;
+                }
+
+                uint8_t flags = 0;
+                if (dataStart == message->getDataOffset()) {
+                    flags |= protocol::ClientMessage::BEGIN_FLAG;
+                }
+                if (dataStart + length == frameLen) {
+                    flags |= protocol::ClientMessage::END_FLAG;
+                } else {
+                    // round robin among the large messages
+                    fragmentedMessages.push_back(FragmentedMessage(message, dataStart + length));
+                }
+
+                // the header of a fragmented message is released with its last fragment
+                int32_t releasedBytes = length;
+                if (flags & protocol::ClientMessage::END_FLAG) {
+                    releasedBytes += message->getDataOffset();
+                }
+
+                if (fragmentHeader.size() < message->getDataOffset()) {
+                    fragmentHeader.resize(message->getDataOffset());
+                }
+                int32_t headerLen = message->writeFragmentHeader(&fragmentHeader[0], length, flags);
+                setLastMessage(message, headerLen + length, releasedBytes);
+                fragmentHeaderLen = headerLen;
+                fragmentDataStart = dataStart;
+                return true;
+            }
+
+            void WriteHandler::setLastMessage(protocol::ClientMessage *message, int32_t frameLen,
+                                              int32_t releasedBytes) {
+                lastMessage = message;
+                lastMessageReleasedBytes = releasedBytes;
+                numBytesWrittenToSocketForMessage = 0;
+                lastMessageFrameLen = frameLen;
+                fragmentHeaderLen = 0;
+                fragmentDataStart = 0;
+            }
+
+            int32_t WriteHandler::writeLastMessage() {
+                Socket &socket = connection.getSocket();
+                int32_t written = numBytesWrittenToSocketForMessage;
+                if (written < fragmentHeaderLen) {
+                    int32_t headerBytes = socket.send(&fragmentHeader[written], fragmentHeaderLen - written);
+                    if (written + headerBytes < fragmentHeaderLen) {
+                        return headerBytes;
+                    }
+                    written += headerBytes;
+                }
+
+                // a whole message has no fragment header and its payload starts at the frame start
+                int32_t frameStart = fragmentDataStart - fragmentHeaderLen;
+                return written - numBytesWrittenToSocketForMessage +
+                       lastMessage->writeTo(socket, frameStart + written, frameStart + lastMessageFrameLen);
+            }
+
+            bool WriteHandler::isFragmentationRequired(const protocol::ClientMessage &message) const {
+                return maxFragmentSize > 0 && message.getDataSize() > maxFragmentSize;
+            }
+
+            bool WriteHandler::mayOvertakeFragmentedMessages(const protocol::ClientMessage &message) const {
+                int32_t partitionId = message.getPartitionId();
+                for (std::deque<FragmentedMessage>::const_iterator it = fragmentedMessages.begin();
+                     it != fragmentedMessages.end(); ++it) {
+                    int32_t fragmentedPartitionId = it->first->getPartitionId();
+                    // the messages which are not partition specific are never reordered
+                    if (partitionId < 0 || fragmentedPartitionId < 0 || partitionId == fragmentedPartitionId) {
+                        return false;
+                    }
+                }
+                return true;
+            }
         }
     }
 }
-
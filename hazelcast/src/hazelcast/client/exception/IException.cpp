@@ -50,6 +50,10 @@ namespace hazelcast {
             void IException::raise() {
                 throw *this;
             }
+
+            std::auto_ptr<IException> IException::clone() const {
+                return std::auto_ptr<IException>(new IException(*this));
+            }
         }
     }
 }
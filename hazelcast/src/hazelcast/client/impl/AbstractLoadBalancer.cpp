@@ -33,8 +33,9 @@ namespace hazelcast {
             }
 
             void AbstractLoadBalancer::setMembersRef() {
+                boost::shared_ptr<const std::vector<Member> > members(new std::vector<Member>(cluster->getMembers()));
                 util::LockGuard lg(membersLock);
-                membersRef = cluster->getMembers();
+                membersRef = members;
             }
 
             void AbstractLoadBalancer::memberAdded(const MembershipEvent &membershipEvent) {
@@ -51,6 +52,14 @@ namespace hazelcast {
             }
 
             std::vector<Member>  AbstractLoadBalancer::getMembers() {
+                boost::shared_ptr<const std::vector<Member> > members = getMembersSnapshot();
+                if (NULL == members.get()) {
+                    return std::vector<Member>();
+                }
+                return *members;
+            }
+
+            boost::shared_ptr<const std::vector<Member> > AbstractLoadBalancer::getMembersSnapshot() {
                 util::LockGuard lg(membersLock);
                 return membersRef;
             }
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "hazelcast/client/impl/BatchEventFlusher.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/Util.h"
+#include "hazelcast/util/ILogger.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace impl {
+            BatchEventFlusher::BatchEventFlusher()
+            : flushing(NULL)
+            , live(true) {
+            }
+
+            BatchEventFlusher::~BatchEventFlusher() {
+                shutdown();
+            }
+
+            void BatchEventFlusher::schedule(Flushable &flushable, int64_t deadline) {
+                util::LockGuard guard(lock);
+                if (!live) {
+                    return;
+                }
+
+                std::map<Flushable *, int64_t>::iterator it = deadlines.find(&flushable);
+                if (it == deadlines.end()) {
+                    deadlines[&flushable] = deadline;
+                } else if (deadline < it->second) {
+                    it->second = deadline;
+                } else {
+                    return;
+                }
+
+                if (flushThread.get() == NULL) {
+                    flushThread.reset(new util::Thread("hz.batchEventFlusher", staticRunFlusher, this));
+                }
+                condition.notify_all();
+            }
+
+            void BatchEventFlusher::cancel(Flushable &flushable) {
+                util::LockGuard guard(lock);
+                deadlines.erase(&flushable);
+                while (flushing == &flushable) {
+                    condition.wait(lock);
+                }
+            }
+
+            void BatchEventFlusher::shutdown() {
+                {
+                    util::LockGuard guard(lock);
+                    if (!live) {
+                        return;
+                    }
+                    live = false;
+                    deadlines.clear();
+                    condition.notify_all();
+                }
+
+                if (flushThread.get() != NULL) {
+                    flushThread->join();
+                }
+            }
+
+            void BatchEventFlusher::staticRunFlusher(util::ThreadArgs &args) {
+                BatchEventFlusher *flusher = (BatchEventFlusher *) args.arg0;
+                flusher->runFlusher();
+            }
+
+            void BatchEventFlusher::runFlusher() {
+                util::LockGuard guard(lock);
+                while (live) {
+                    if (deadlines.empty()) {
+                        condition.wait(lock);
+                        continue;
+                    }
+
+                    std::map<Flushable *, int64_t>::iterator earliest = deadlines.begin();
+                    for (std::map<Flushable *, int64_t>::iterator it = deadlines.begin(); it != deadlines.end(); ++it) {
+                        if (it->second < earliest->second) {
+                            earliest = it;
+                        }
+                    }
+
+                    int64_t remaining = earliest->second - util::currentTimeMillis();
+                    if (remaining > 0) {
+                        condition.waitForMillis(lock, remaining);
+                        continue;
+                    }
+
+                    // the flush is done without the lock, so that a listener is never called with the lock held
+                    flushing = earliest->first;
+                    deadlines.erase(earliest);
+                    lock.unlock();
+                    try {
+                        flushing->flush();
+                    } catch (...) {
+                        util::ILogger::getLogger().warning("[BatchEventFlusher::runFlusher] The batch listener "
+                                                                   "threw an exception, the batch is dropped.");
+                    }
+                    lock.lock();
+                    flushing = NULL;
+                    condition.notify_all();
+                }
+            }
+        }
+    }
+}
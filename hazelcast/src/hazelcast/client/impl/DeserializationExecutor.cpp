@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <limits>
+#include <algorithm>
+
+#include "hazelcast/client/impl/DeserializationExecutor.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/IOUtil.h"
+#include "hazelcast/util/ILogger.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace impl {
+            DeserializationExecutor::Batch::Batch(const std::vector<boost::shared_ptr<Task> > &tasks)
+            : tasks(tasks)
+            , nextTask(0)
+            , remainingTasks(tasks.size()) {
+            }
+
+            void DeserializationExecutor::Batch::runTasks() {
+                while (true) {
+                    boost::shared_ptr<Task> task;
+                    {
+                        util::LockGuard guard(lock);
+                        if (nextTask >= tasks.size()) {
+                            return;
+                        }
+                        task = tasks[nextTask++];
+                    }
+
+                    try {
+                        task->run();
+                    } catch (...) {
+                        // the tasks report their errors themselves, the task must still be counted as completed
+                        util::ILogger::getLogger().warning("[DeserializationExecutor::Batch::runTasks] A task threw "
+                                                                   "an exception.");
+                    }
+
+                    util::LockGuard guard(lock);
+                    if (--remainingTasks == 0) {
+                        completed.notify_all();
+                    }
+                }
+            }
+
+            void DeserializationExecutor::Batch::awaitCompletion() {
+                util::LockGuard guard(lock);
+                while (remainingTasks > 0) {
+                    completed.wait(lock);
+                }
+            }
+
+            DeserializationExecutor::DeserializationExecutor(int32_t poolSize, int32_t chunkSize)
+            : poolSize(poolSize > 0 ? poolSize : 0)
+            , chunkSize((size_t) (chunkSize > 0 ? chunkSize : 1))
+            , q(std::numeric_limits<size_t>::max())
+            , live(true) {
+            }
+
+            DeserializationExecutor::~DeserializationExecutor() {
+                shutdown();
+            }
+
+            void DeserializationExecutor::shutdown() {
+                util::LockGuard guard(startLock);
+                if (!live.compareAndSet(true, false)) {
+                    return;
+                }
+
+                // an empty batch stops the thread which takes it
+                for (size_t i = 0; i < threads.size(); ++i) {
+                    q.push(boost::shared_ptr<Batch>());
+                }
+
+                for (std::vector<boost::shared_ptr<util::Thread> >::const_iterator it = threads.begin();
+                     it != threads.end(); ++it) {
+                    (*it)->join();
+                }
+                threads.clear();
+            }
+
+            void DeserializationExecutor::invokeAll(const std::vector<boost::shared_ptr<Task> > &tasks) {
+                boost::shared_ptr<Batch> batch(new Batch(tasks));
+                if (live) {
+                    start();
+                    // the calling thread runs its share of the tasks, hence one pool thread less is needed
+                    size_t helpers = std::min(tasks.size() - 1, (size_t) poolSize);
+                    for (size_t i = 0; i < helpers; ++i) {
+                        q.push(batch);
+                    }
+                }
+
+                batch->runTasks();
+                batch->awaitCompletion();
+            }
+
+            void DeserializationExecutor::executorRun(util::ThreadArgs &args) {
+                util::BlockingConcurrentQueue<boost::shared_ptr<Batch> > *q =
+                        (util::BlockingConcurrentQueue<boost::shared_ptr<Batch> > *) args.arg0;
+
+                while (true) {
+                    boost::shared_ptr<Batch> batch = q->pop();
+                    if (NULL == batch.get()) {
+                        return;
+                    }
+
+                    batch->runTasks();
+                }
+            }
+
+            bool DeserializationExecutor::isParallel(size_t itemCount) {
+                return poolSize > 0 && itemCount > chunkSize && live;
+            }
+
+            void DeserializationExecutor::start() {
+                util::LockGuard guard(startLock);
+                if (!live || !threads.empty()) {
+                    return;
+                }
+
+                for (int32_t i = 0; i < poolSize; ++i) {
+                    std::string threadName = "hz.deserializationExecutor-" + util::IOUtil::to_string<int32_t>(i);
+                    threads.push_back(boost::shared_ptr<util::Thread>(new util::Thread(threadName, executorRun, &q)));
+                }
+            }
+        }
+    }
+}
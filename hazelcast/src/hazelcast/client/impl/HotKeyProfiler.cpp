@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <sstream>
+
+#include "hazelcast/client/impl/HotKeyProfiler.h"
+#include "hazelcast/client/serialization/pimpl/Data.h"
+#include "hazelcast/client/spi/PartitionService.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/ILogger.h"
+#include "hazelcast/util/MurmurHash3.h"
+#include "hazelcast/util/Util.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace impl {
+            HotKeyProfiler::KeyId::KeyId(const std::string &objectName, const std::vector<byte> &key)
+            : objectName(objectName)
+            , key(key) {
+            }
+
+            bool HotKeyProfiler::KeyId::operator<(const KeyId &rhs) const {
+                if (objectName != rhs.objectName) {
+                    return objectName < rhs.objectName;
+                }
+                return key < rhs.key;
+            }
+
+            HotKeyProfiler::SampleCountdown::SampleCountdown() : remaining(0) {
+            }
+
+            HotKeyProfiler::HotKeyProfiler(int32_t sampleRate, int32_t topK, int32_t dumpIntervalSeconds,
+                                           spi::PartitionService &partitionService)
+            : sampleRate(std::max(sampleRate, 0))
+            , topK(std::max(topK, 0))
+            , dumpIntervalSeconds(dumpIntervalSeconds)
+            , partitionService(partitionService)
+            , countdowns(NULL)
+            , sampledOperations(0)
+            , live(true) {
+                if (isEnabled()) {
+                    sketch.resize(SKETCH_DEPTH * SKETCH_WIDTH, 0);
+                    countdowns = new SampleCountdown[SAMPLE_STRIPE_COUNT];
+                    for (int i = 0; i < SAMPLE_STRIPE_COUNT; ++i) {
+                        countdowns[i].remaining = this->sampleRate;
+                    }
+                    dumpThread.reset(new util::Thread("hz.hotKeyProfiler", staticRunDumper, this));
+                }
+            }
+
+            HotKeyProfiler::~HotKeyProfiler() {
+                shutdown();
+                delete[] countdowns;
+            }
+
+            void HotKeyProfiler::record(const std::string &objectName, const serialization::pimpl::Data &key,
+                                        int partitionId) {
+                if (!isEnabled() || !shouldSample()) {
+                    return;
+                }
+
+                // the owner lookup and the hashing are done before taking the lock
+                boost::shared_ptr<Address> owner = partitionService.getPartitionOwner(partitionId);
+                KeyId id(objectName, key.toByteArray());
+                uint32_t keyHash = 0;
+                uint32_t nameHash = (uint32_t) util::MurmurHash3_x86_32(objectName.c_str(), (int) objectName.size());
+                if (!id.key.empty()) {
+                    util::MurmurHash3_x86_32(&id.key[0], (int) id.key.size(), nameHash, &keyHash);
+                }
+
+                util::LockGuard guard(lock);
+                ++sampledOperations;
+                ++partitionCounts[partitionId];
+                if (owner.get() != NULL) {
+                    ++memberCounts[*owner];
+                }
+                updateCandidates(id, partitionId, addToSketch(keyHash));
+            }
+
+            HotKeyStats HotKeyProfiler::getStats() {
+                util::LockGuard guard(lock);
+                std::vector<HotKeyStats::HotKey> hotKeys;
+                for (CandidateOrder::reverse_iterator it = candidateOrder.rbegin(); it != candidateOrder.rend(); ++it) {
+                    const KeyId &id = *it->second;
+                    hotKeys.push_back(HotKeyStats::HotKey(id.objectName, id.key, candidates[id].partitionId,
+                                                          it->first * sampleRate));
+                }
+
+                std::map<int, int64_t> partitionOperationCounts;
+                for (std::map<int, int64_t>::const_iterator it = partitionCounts.begin();
+                     it != partitionCounts.end(); ++it) {
+                    partitionOperationCounts[it->first] = it->second * sampleRate;
+                }
+
+                std::map<Address, int64_t, addressComparator> memberOperationCounts;
+                for (std::map<Address, int64_t, addressComparator>::const_iterator it = memberCounts.begin();
+                     it != memberCounts.end(); ++it) {
+                    memberOperationCounts[it->first] = it->second * sampleRate;
+                }
+
+                return HotKeyStats(sampleRate, sampledOperations, hotKeys, partitionOperationCounts,
+                                   memberOperationCounts);
+            }
+
+            void HotKeyProfiler::shutdown() {
+                if (!live.compareAndSet(true, false)) {
+                    return;
+                }
+
+                if (dumpThread.get() != NULL) {
+                    dumpThread->join();
+                }
+            }
+
+            void HotKeyProfiler::staticRunDumper(util::ThreadArgs &args) {
+                HotKeyProfiler *profiler = (HotKeyProfiler *) args.arg0;
+                profiler->runDumper();
+            }
+
+            void HotKeyProfiler::runDumper() {
+                int64_t intervalMillis =
+                        (dumpIntervalSeconds > 0 ? dumpIntervalSeconds : DEFAULT_DECAY_INTERVAL_SECONDS) * 1000LL;
+                int64_t nextDumpTime = util::currentTimeMillis() + intervalMillis;
+                while (live) {
+                    // sleep in short slices, so that the shutdown does not wait for the whole interval
+                    util::sleepmillis(100);
+                    if (util::currentTimeMillis() < nextDumpTime) {
+                        continue;
+                    }
+                    nextDumpTime += intervalMillis;
+                    if (dumpIntervalSeconds > 0) {
+                        dump();
+                    }
+                    decay();
+                }
+            }
+
+            void HotKeyProfiler::dump() {
+                HotKeyStats stats = getStats();
+                if (0 == stats.getSampledOperationCount()) {
+                    return;
+                }
+
+                std::ostringstream out;
+                out << "Hot key statistics of " << stats.getSampledOperationCount()
+                    << " sampled operations, one of every " << stats.getSampleRate() << " operations is sampled.";
+
+                const std::vector<HotKeyStats::HotKey> &hotKeys = stats.getHotKeys();
+                out << " Hot keys:";
+                for (std::vector<HotKeyStats::HotKey>::const_iterator it = hotKeys.begin(); it != hotKeys.end(); ++it) {
+                    out << " [" << it->getObjectName() << ", partition " << it->getPartitionId() << ", "
+                        << it->getKey().size() << " bytes key: " << it->getEstimatedCount() << "]";
+                }
+
+                // the partitions are logged from the hottest one, at most as many as the hot keys
+                std::vector<std::pair<int64_t, int> > partitions;
+                const std::map<int, int64_t> &partitionCounts = stats.getPartitionOperationCounts();
+                for (std::map<int, int64_t>::const_iterator it = partitionCounts.begin();
+                     it != partitionCounts.end(); ++it) {
+                    partitions.push_back(std::make_pair(it->second, it->first));
+                }
+                std::sort(partitions.rbegin(), partitions.rend());
+                size_t partitionLimit = std::max((size_t) topK, (size_t) 1);
+                out << " Hot partitions:";
+                for (size_t i = 0; i < partitions.size() && i < partitionLimit; ++i) {
+                    out << " [" << partitions[i].second << ": " << partitions[i].first << "]";
+                }
+
+                const std::map<Address, int64_t, addressComparator> &memberCounts = stats.getMemberOperationCounts();
+                out << " Members:";
+                for (std::map<Address, int64_t, addressComparator>::const_iterator it = memberCounts.begin();
+                     it != memberCounts.end(); ++it) {
+                    out << " [" << it->first << ": " << it->second << "]";
+                }
+
+                util::ILogger::getLogger().info(out.str());
+            }
+
+            bool HotKeyProfiler::shouldSample() {
+                // the thread ids are usually aligned addresses, hence they are mixed before the modulo
+                uint64_t hash = (uint64_t) util::getThreadId() * 0x9E3779B97F4A7C15ULL;
+                SampleCountdown &countdown = countdowns[(hash >> 32) % (uint64_t) SAMPLE_STRIPE_COUNT];
+
+                util::LockGuard guard(countdown.lock);
+                if (--countdown.remaining > 0) {
+                    return false;
+                }
+                countdown.remaining = sampleRate;
+                return true;
+            }
+
+            void HotKeyProfiler::decay() {
+                util::LockGuard guard(lock);
+                sampledOperations /= 2;
+
+                for (std::vector<int64_t>::iterator it = sketch.begin(); it != sketch.end(); ++it) {
+                    *it /= 2;
+                }
+
+                // halving keeps the order of the candidates, but the order set is keyed by the counts, hence rebuilt
+                candidateOrder.clear();
+                for (CandidateMap::iterator it = candidates.begin(); it != candidates.end();) {
+                    it->second.count /= 2;
+                    if (0 == it->second.count) {
+                        candidates.erase(it++);
+                    } else {
+                        candidateOrder.insert(std::make_pair(it->second.count, &it->first));
+                        ++it;
+                    }
+                }
+
+                for (std::map<int, int64_t>::iterator it = partitionCounts.begin(); it != partitionCounts.end();) {
+                    it->second /= 2;
+                    if (0 == it->second) {
+                        partitionCounts.erase(it++);
+                    } else {
+                        ++it;
+                    }
+                }
+
+                for (std::map<Address, int64_t, addressComparator>::iterator it = memberCounts.begin();
+                     it != memberCounts.end();) {
+                    it->second /= 2;
+                    if (0 == it->second) {
+                        memberCounts.erase(it++);
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+
+            int64_t HotKeyProfiler::addToSketch(uint32_t keyHash) {
+                // the rows are indexed by double hashing, h1 + i * h2, with an odd h2
+                uint32_t h1 = keyHash;
+                uint32_t h2 = (((keyHash >> 16) | (keyHash << 16)) * 0x85EBCA6BU) | 1U;
+                int64_t estimate = -1;
+                for (int i = 0; i < SKETCH_DEPTH; ++i) {
+                    int64_t &counter = sketch[i * SKETCH_WIDTH + (h1 + i * h2) % SKETCH_WIDTH];
+                    ++counter;
+                    if (estimate < 0 || counter < estimate) {
+                        estimate = counter;
+                    }
+                }
+                return estimate;
+            }
+
+            void HotKeyProfiler::updateCandidates(const KeyId &id, int partitionId, int64_t count) {
+                if (0 == topK) {
+                    return;
+                }
+
+                CandidateMap::iterator it = candidates.find(id);
+                if (it != candidates.end()) {
+                    candidateOrder.erase(std::make_pair(it->second.count, &it->first));
+                    it->second.count = count;
+                    candidateOrder.insert(std::make_pair(count, &it->first));
+                    return;
+                }
+
+                if ((int32_t) candidates.size() >= topK) {
+                    CandidateOrder::iterator coldest = candidateOrder.begin();
+                    if (coldest->first >= count) {
+                        return;
+                    }
+                    const KeyId *coldestId = coldest->second;
+                    candidateOrder.erase(coldest);
+                    candidates.erase(*coldestId);
+                }
+
+                Candidate candidate;
+                candidate.partitionId = partitionId;
+                candidate.count = count;
+                it = candidates.insert(std::make_pair(id, candidate)).first;
+                candidateOrder.insert(std::make_pair(count, &it->first));
+            }
+        }
+    }
+}
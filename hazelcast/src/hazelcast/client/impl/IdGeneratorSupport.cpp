@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/impl/IdGeneratorSupport.h"
+#include "hazelcast/client/connection/CallCompletionListener.h"
+#include "hazelcast/client/exception/ProtocolExceptions.h"
+#include "hazelcast/util/LockGuard.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace impl {
+            class IdGeneratorSupport::FetchCompletion : public connection::CallCompletionListener {
+            public:
+                FetchCompletion(const boost::shared_ptr<State> &state, const Future<int64_t> &future,
+                                int64_t blockUnit, int64_t blockSize)
+                : state(state)
+                , future(future)
+                , blockUnit(blockUnit)
+                , blockSize(blockSize) {
+                }
+
+                virtual void onComplete() {
+                    onFetchCompleted(*state, future, blockUnit, blockSize);
+                }
+
+            private:
+                // keeps the state alive, the generator may be destroyed while the fetch is in flight
+                boost::shared_ptr<State> state;
+                Future<int64_t> future;
+                int64_t blockUnit;
+                int64_t blockSize;
+            };
+
+            IdGeneratorSupport::State::State() : next(0), end(0), fetching(false), failedFetches(0) {
+            }
+
+            IdGeneratorSupport::IdGeneratorSupport(const IAtomicLong &atomicLong, int64_t blockUnit,
+                                                   int64_t blockSize, int prefetchBlocks)
+            : atomicLong(atomicLong)
+            , blockUnit(blockUnit)
+            , blockSize(blockSize <= blockUnit ? blockUnit : (blockSize + blockUnit - 1) / blockUnit * blockUnit)
+            , prefetchBlocks(prefetchBlocks < 0 ? 0 : (size_t) prefetchBlocks)
+            , state(new State) {
+            }
+
+            void IdGeneratorSupport::reset(int64_t next, int64_t end) {
+                util::LockGuard guard(state->lock);
+                state->next = next;
+                state->end = end;
+            }
+
+            int64_t IdGeneratorSupport::newId() {
+                int64_t observedFailures = -1;
+                while (true) {
+                    bool found = false;
+                    bool startFetch = false;
+                    int64_t id = 0;
+                    {
+                        util::LockGuard guard(state->lock);
+                        if (state->next >= state->end && !state->reserve.empty()) {
+                            state->next = state->reserve.front();
+                            state->end = state->next + blockSize;
+                            state->reserve.pop_front();
+                        }
+
+                        if (state->next < state->end) {
+                            found = true;
+                            id = state->next++;
+                            // the low water mark is the half of the current block
+                            startFetch = !state->fetching && state->reserve.size() < prefetchBlocks &&
+                                         state->end - state->next < blockSize / 2;
+                        } else {
+                            if (observedFailures >= 0 && state->failedFetches != observedFailures) {
+                                throw exception::HazelcastException("IdGeneratorSupport::newId",
+                                                                    "Could not fetch a block of ids. " +
+                                                                    state->lastFailure);
+                            }
+                            observedFailures = state->failedFetches;
+                            if (state->fetching) {
+                                state->blockFetched.wait(state->lock);
+                                continue;
+                            }
+                            startFetch = true;
+                        }
+
+                        if (startFetch) {
+                            state->fetching = true;
+                        }
+                    }
+
+                    if (startFetch) {
+                        fetch();
+                    }
+                    if (found) {
+                        return id;
+                    }
+                }
+            }
+
+            void IdGeneratorSupport::fetch() {
+                try {
+                    Future<int64_t> future = atomicLong.getAndAddAsync(blockSize / blockUnit);
+                    future.setCompletionListener(boost::shared_ptr<connection::CallCompletionListener>(
+                            new FetchCompletion(state, future, blockUnit, blockSize)));
+                } catch (exception::IException &e) {
+                    util::LockGuard guard(state->lock);
+                    state->fetching = false;
+                    ++state->failedFetches;
+                    state->lastFailure = e.what();
+                    state->blockFetched.notify_all();
+                }
+            }
+
+            void IdGeneratorSupport::onFetchCompleted(State &state, Future<int64_t> &future, int64_t blockUnit,
+                                                      int64_t blockSize) {
+                std::auto_ptr<int64_t> block;
+                std::string failure;
+                try {
+                    block = future.get();
+                } catch (exception::IException &e) {
+                    failure = e.what();
+                }
+
+                util::LockGuard guard(state.lock);
+                state.fetching = false;
+                if (NULL != block.get()) {
+                    state.reserve.push_back(*block * blockUnit);
+                } else {
+                    ++state.failedFetches;
+                    state.lastFailure = failure;
+                }
+                state.blockFetched.notify_all();
+            }
+        }
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "hazelcast/client/impl/LoadAwareLB.h"
+#include "hazelcast/client/Cluster.h"
+#include "hazelcast/client/connection/Connection.h"
+#include "hazelcast/client/exception/IException.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/Util.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace impl {
+            LoadAwareLB::LoadAwareLB() : randomState((uint64_t) util::currentTimeMillis() | 1) {
+            }
+
+            const Member LoadAwareLB::next() {
+                boost::shared_ptr<const std::vector<Member> > members = getMembersSnapshot();
+                if (NULL == members.get() || members->size() == 0) {
+                    throw exception::IException("const Member& LoadAwareLB::next()", "No member in member list!!");
+                }
+
+                size_t size = members->size();
+                if (size == 1) {
+                    return (*members)[0];
+                }
+
+                size_t first = nextRandom(size);
+                size_t second = nextRandom(size - 1);
+                if (second >= first) {
+                    ++second;
+                }
+
+                const Member &firstMember = (*members)[first];
+                const Member &secondMember = (*members)[second];
+                double firstCost = getCost(firstMember);
+                double secondCost = getCost(secondMember);
+                // a member without a connection may be unreachable, the connected candidate is preferred
+                if (firstCost < 0) {
+                    return secondMember;
+                }
+                if (secondCost < 0) {
+                    return firstMember;
+                }
+                return firstCost <= secondCost ? firstMember : secondMember;
+            }
+
+            double LoadAwareLB::getCost(const Member &member) {
+                boost::shared_ptr<connection::Connection> connection = cluster->getConnection(member.getAddress());
+                if (NULL == connection.get()) {
+                    return -1;
+                }
+
+                double load = connection->getPendingCallCount() + (double) connection->getWriteQueueSize() + 1;
+                return load * (connection->getAverageResponseTime() + 1);
+            }
+
+            size_t LoadAwareLB::nextRandom(size_t bound) {
+                util::LockGuard guard(randomLock);
+                // xorshift64
+                randomState ^= randomState << 13;
+                randomState ^= randomState >> 7;
+                randomState ^= randomState << 17;
+                return (size_t) (randomState % bound);
+            }
+        }
+    }
+}
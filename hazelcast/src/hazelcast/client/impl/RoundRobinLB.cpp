@@ -34,11 +34,11 @@ namespace hazelcast {
             }
 
             const Member RoundRobinLB::next() {
-                std::vector<Member> members = getMembers();
-                if (members.size() == 0) {
+                boost::shared_ptr<const std::vector<Member> > members = getMembersSnapshot();
+                if (NULL == members.get() || members->size() == 0) {
                     throw exception::IException("const Member& RoundRobinLB::next()", "No member in member list!!");
                 }
-                return members[++index % members.size()];
+                return (*members)[++index % members->size()];
             }
 
 
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/map/BulkLoadStats.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            BulkLoadStats::BulkLoadStats(int64_t addedEntries, int64_t storedEntries, int64_t failedEntries,
+                                         int64_t storedBatches, int64_t failedBatches, int64_t elapsedMillis)
+            : addedEntries(addedEntries)
+            , storedEntries(storedEntries)
+            , failedEntries(failedEntries)
+            , storedBatches(storedBatches)
+            , failedBatches(failedBatches)
+            , elapsedMillis(elapsedMillis) {
+            }
+
+            int64_t BulkLoadStats::getAddedEntries() const {
+                return addedEntries;
+            }
+
+            int64_t BulkLoadStats::getStoredEntries() const {
+                return storedEntries;
+            }
+
+            int64_t BulkLoadStats::getFailedEntries() const {
+                return failedEntries;
+            }
+
+            int64_t BulkLoadStats::getStoredBatches() const {
+                return storedBatches;
+            }
+
+            int64_t BulkLoadStats::getFailedBatches() const {
+                return failedBatches;
+            }
+
+            int64_t BulkLoadStats::getElapsedMillis() const {
+                return elapsedMillis;
+            }
+
+            double BulkLoadStats::getThroughput() const {
+                if (elapsedMillis <= 0) {
+                    return 0.0;
+                }
+                return storedEntries * 1000.0 / elapsedMillis;
+            }
+        }
+    }
+}
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <sstream>
+
+#include "hazelcast/client/map/impl/BulkLoaderImpl.h"
+#include "hazelcast/client/map/BulkLoadListener.h"
+#include "hazelcast/client/spi/ClientContext.h"
+#include "hazelcast/client/spi/InvocationService.h"
+#include "hazelcast/client/spi/PartitionService.h"
+#include "hazelcast/client/connection/CallFuture.h"
+#include "hazelcast/client/connection/CallCompletionListener.h"
+#include "hazelcast/client/protocol/ClientMessage.h"
+#include "hazelcast/client/protocol/codec/MapPutAllCodec.h"
+#include "hazelcast/client/exception/IllegalStateException.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/ILogger.h"
+#include "hazelcast/util/Util.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            namespace impl {
+                class BulkLoaderImpl::BatchCompletion : public connection::CallCompletionListener {
+                public:
+                    BatchCompletion(BulkLoaderImpl &loader, const connection::CallFuture &future, int partitionId,
+                                    const Address &member, int32_t entryCount)
+                    : loader(loader)
+                    , future(future)
+                    , partitionId(partitionId)
+                    , member(member)
+                    , entryCount(entryCount)
+                    , sendTime(util::currentTimeMillis()) {
+                    }
+
+                    virtual void onComplete() {
+                        loader.onBatchCompleted(future, partitionId, member, entryCount, sendTime);
+                    }
+
+                private:
+                    BulkLoaderImpl &loader;
+                    connection::CallFuture future;
+                    int partitionId;
+                    Address member;
+                    int32_t entryCount;
+                    int64_t sendTime;
+                };
+
+                BulkLoaderImpl::Buffer::Buffer() : creationTime(util::currentTimeMillis()), inFlight(false) {
+                }
+
+                BulkLoaderImpl::BulkLoaderImpl(const std::string &mapName, spi::ClientContext &context,
+                                               const config::BulkLoaderConfig &config)
+                : mapName(mapName)
+                , context(context)
+                , batchSize(config.getBatchSize())
+                , lingerMillis(config.getLingerMillis())
+                , maxInFlightPerMember(config.getMaxInFlightPerMember())
+                , listener(config.getListener())
+                , startTime(util::currentTimeMillis())
+                , closeTime(-1)
+                , inFlight(0)
+                , addedEntries(0)
+                , storedEntries(0)
+                , failedEntries(0)
+                , storedBatches(0)
+                , failedBatches(0)
+                , live(true) {
+                    if (lingerMillis > 0) {
+                        flushThread.reset(new util::Thread("hz.bulkLoaderFlusher", staticRunFlusher, this));
+                    }
+                }
+
+                BulkLoaderImpl::~BulkLoaderImpl() {
+                    try {
+                        close();
+                    } catch (exception::IException &e) {
+                        util::ILogger::getLogger().warning(
+                                std::string("[BulkLoaderImpl::~BulkLoaderImpl] Failed to flush the entries of map ") +
+                                mapName + ". " + e.what());
+                    }
+                }
+
+                void BulkLoaderImpl::add(const serialization::pimpl::Data &key,
+                                         const serialization::pimpl::Data &value) {
+                    int partitionId = context.getPartitionService().getPartitionId(key);
+
+                    Entries batch;
+                    {
+                        util::LockGuard guard(lock);
+                        checkOpen();
+
+                        // a full buffer waits for the previous batch of the partition, see below
+                        while (buffers[partitionId].entries.size() >= (size_t) batchSize) {
+                            batchCompleted.wait(lock);
+                            checkOpen();
+                        }
+
+                        ++addedEntries;
+                        Buffer &buffer = buffers[partitionId];
+                        if (buffer.entries.empty()) {
+                            buffer.creationTime = util::currentTimeMillis();
+                            buffer.entries.reserve((size_t) batchSize);
+                        }
+                        buffer.entries.push_back(std::make_pair(key, value));
+                        if (buffer.entries.size() < (size_t) batchSize) {
+                            return;
+                        }
+
+                        // the producer which fills the buffer sends it once the previous batch is completed
+                        while (buffers[partitionId].inFlight) {
+                            batchCompleted.wait(lock);
+                        }
+                        Buffer &fullBuffer = buffers[partitionId];
+                        if (fullBuffer.entries.size() < (size_t) batchSize) {
+                            // the flusher has taken the buffer meanwhile
+                            return;
+                        }
+                        takeBatch(partitionId, fullBuffer, batch);
+                    }
+
+                    send(partitionId, batch);
+                }
+
+                void BulkLoaderImpl::flush() {
+                    for (;;) {
+                        std::map<int, Entries> batches;
+                        takeBuffers(-1, batches);
+                        for (std::map<int, Entries>::iterator it = batches.begin(); it != batches.end(); ++it) {
+                            send(it->first, it->second);
+                        }
+
+                        // the buffers of the partitions which had a batch in flight are sent after it completes
+                        util::LockGuard guard(lock);
+                        if (0 == inFlight && buffers.empty()) {
+                            return;
+                        }
+                        batchCompleted.wait(lock);
+                    }
+                }
+
+                void BulkLoaderImpl::close() {
+                    if (!live.compareAndSet(true, false)) {
+                        return;
+                    }
+
+                    if (NULL != flushThread.get()) {
+                        flushThread->join();
+                    }
+
+                    flush();
+
+                    util::LockGuard guard(lock);
+                    closeTime = util::currentTimeMillis();
+                }
+
+                BulkLoadStats BulkLoaderImpl::getStats() {
+                    util::LockGuard guard(lock);
+                    int64_t endTime = closeTime < 0 ? util::currentTimeMillis() : closeTime;
+                    return BulkLoadStats(addedEntries, storedEntries, failedEntries, storedBatches, failedBatches,
+                                         endTime - startTime);
+                }
+
+                void BulkLoaderImpl::staticRunFlusher(util::ThreadArgs &args) {
+                    BulkLoaderImpl *loader = (BulkLoaderImpl *) args.arg0;
+                    loader->runFlusher();
+                }
+
+                void BulkLoaderImpl::runFlusher() {
+                    while (live) {
+                        // sleep in short slices, so that close does not wait for the whole linger time
+                        util::sleepmillis((unsigned long) std::min(lingerMillis, 10));
+
+                        std::map<int, Entries> batches;
+                        takeBuffers(util::currentTimeMillis() - lingerMillis, batches);
+                        for (std::map<int, Entries>::iterator it = batches.begin(); it != batches.end(); ++it) {
+                            try {
+                                send(it->first, it->second);
+                            } catch (exception::IException &e) {
+                                util::ILogger::getLogger().warning(
+                                        std::string("[BulkLoaderImpl::runFlusher] Failed to send a batch of map ") +
+                                        mapName + ". " + e.what());
+                            }
+                        }
+                    }
+                }
+
+                void BulkLoaderImpl::checkOpen() {
+                    if (!live) {
+                        throw exception::IllegalStateException("BulkLoaderImpl::checkOpen",
+                                                               "The bulk loader of map " + mapName + " is closed");
+                    }
+                }
+
+                void BulkLoaderImpl::takeBuffers(int64_t olderThan, std::map<int, Entries> &batches) {
+                    util::LockGuard guard(lock);
+                    for (std::map<int, Buffer>::iterator it = buffers.begin(); it != buffers.end();) {
+                        Buffer &buffer = it->second;
+                        if (buffer.inFlight) {
+                            ++it;
+                        } else if (buffer.entries.empty()) {
+                            // left by an add which failed on a closed loader
+                            buffers.erase(it++);
+                        } else {
+                            if (olderThan < 0 || buffer.creationTime <= olderThan) {
+                                takeBatch(it->first, buffer, batches[it->first]);
+                            }
+                            ++it;
+                        }
+                    }
+                }
+
+                void BulkLoaderImpl::takeBatch(int partitionId, Buffer &buffer, Entries &batch) {
+                    batch.swap(buffer.entries);
+                    buffer.inFlight = true;
+                    ++inFlight;
+                    // wakes the producers waiting for the full buffer
+                    batchCompleted.notify_all();
+                }
+
+                void BulkLoaderImpl::send(int partitionId, Entries &entries) {
+                    boost::shared_ptr<Address> owner = context.getPartitionService().getPartitionOwner(partitionId);
+                    // the batches of the partitions without a known owner share a window
+                    Address member = NULL == owner.get() ? Address() : *owner;
+                    int32_t entryCount = (int32_t) entries.size();
+
+                    {
+                        util::LockGuard guard(lock);
+                        while (inFlightPerMember[member] >= maxInFlightPerMember) {
+                            batchCompleted.wait(lock);
+                        }
+                        ++inFlightPerMember[member];
+                    }
+
+                    connection::CallFuture future;
+                    try {
+                        std::auto_ptr<protocol::ClientMessage> request =
+                                protocol::codec::MapPutAllCodec::RequestParameters::encode(mapName, entries);
+                        future = context.getInvocationService().invokeOnPartitionOwner(request, partitionId);
+                    } catch (exception::IException &e) {
+                        if (NULL != listener) {
+                            listener->batchFailed(partitionId, entryCount, e);
+                        }
+
+                        util::LockGuard guard(lock);
+                        failedEntries += entryCount;
+                        ++failedBatches;
+                        --inFlightPerMember[member];
+                        releasePartition(partitionId);
+                        return;
+                    }
+
+                    future.setCompletionListener(boost::shared_ptr<connection::CallCompletionListener>(
+                            new BatchCompletion(*this, future, partitionId, member, entryCount)));
+                }
+
+                void BulkLoaderImpl::onBatchCompleted(connection::CallFuture &future, int partitionId,
+                                                      const Address &member, int32_t entryCount, int64_t sendTime) {
+                    bool stored = false;
+                    try {
+                        future.get();
+                        stored = true;
+                        if (NULL != listener) {
+                            listener->batchStored(partitionId, entryCount, util::currentTimeMillis() - sendTime);
+                        }
+                    } catch (exception::IException &e) {
+                        if (!stored && NULL != listener) {
+                            listener->batchFailed(partitionId, entryCount, e);
+                        }
+                    }
+
+                    // the loader may be destroyed as soon as the last in flight batch is released
+                    util::LockGuard guard(lock);
+                    if (stored) {
+                        storedEntries += entryCount;
+                        ++storedBatches;
+                    } else {
+                        failedEntries += entryCount;
+                        ++failedBatches;
+                    }
+                    --inFlightPerMember[member];
+                    releasePartition(partitionId);
+                }
+
+                void BulkLoaderImpl::releasePartition(int partitionId) {
+                    std::map<int, Buffer>::iterator it = buffers.find(partitionId);
+                    if (it != buffers.end()) {
+                        it->second.inFlight = false;
+                        if (it->second.entries.empty()) {
+                            buffers.erase(it);
+                        }
+                    }
+                    --inFlight;
+                    batchCompleted.notify_all();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
+#include "hazelcast/client/map/impl/KeySnapshot.h"
+#include "hazelcast/client/exception/IOException.h"
+#include "hazelcast/util/Bits.h"
+
+#if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#endif
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            namespace impl {
+                // "HZKS"
+                const int32_t KeySnapshot::MAGIC = 0x485A4B53;
+                const int32_t KeySnapshot::VERSION = 1;
+
+                namespace {
+                    void writeInt(std::ofstream &out, int32_t value) {
+                        char bytes[4];
+                        util::Bits::nativeToBigEndian4(&value, bytes);
+                        out.write(bytes, 4);
+                    }
+
+                    /**
+                     * Atomically replaces the target with the source, so that a reader sees either the previous or
+                     * the new snapshot, never no snapshot.
+                     */
+                    bool replaceFile(const std::string &source, const std::string &target) {
+                        #if  defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+                        return FALSE != MoveFileExA(source.c_str(), target.c_str(),
+                                                    MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+                        #else
+                        return 0 == std::rename(source.c_str(), target.c_str());
+                        #endif
+                    }
+
+                    bool readInt(std::ifstream &in, int32_t &value) {
+                        char bytes[4];
+                        if (!in.read(bytes, 4)) {
+                            return false;
+                        }
+                        util::Bits::bigEndianToNative4(bytes, &value);
+                        return true;
+                    }
+                }
+
+                std::string KeySnapshot::getPath(const std::string &directory, const std::string &mapName) {
+                    return directory + "/" + mapName + ".keys";
+                }
+
+                void KeySnapshot::store(const std::string &path, const std::string &mapName,
+                                        const std::vector<serialization::pimpl::Data> &keys, size_t maxKeys) {
+                    std::string tempPath = path + ".tmp";
+                    {
+                        std::ofstream out(tempPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+                        if (!out) {
+                            throw exception::IOException("KeySnapshot::store", "Could not open " + tempPath);
+                        }
+
+                        size_t keyCount = keys.size() < maxKeys ? keys.size() : maxKeys;
+                        writeInt(out, MAGIC);
+                        writeInt(out, VERSION);
+                        writeInt(out, (int32_t) mapName.size());
+                        out.write(mapName.c_str(), (std::streamsize) mapName.size());
+                        writeInt(out, (int32_t) keyCount);
+                        for (size_t i = 0; i < keyCount; ++i) {
+                            const std::vector<byte> &bytes = keys[i].toByteArray();
+                            writeInt(out, (int32_t) bytes.size());
+                            if (!bytes.empty()) {
+                                out.write((const char *) &bytes[0], (std::streamsize) bytes.size());
+                            }
+                        }
+
+                        out.flush();
+                        if (!out) {
+                            throw exception::IOException("KeySnapshot::store", "Could not write " + tempPath);
+                        }
+                    }
+
+                    if (!replaceFile(tempPath, path)) {
+                        throw exception::IOException("KeySnapshot::store", "Could not rename " + tempPath + " to " +
+                                                                           path);
+                    }
+                }
+
+                bool KeySnapshot::load(const std::string &path, const std::string &mapName, size_t maxKeys,
+                                       std::vector<serialization::pimpl::Data> &keys) {
+                    std::ifstream in(path.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+                    if (!in) {
+                        return false;
+                    }
+                    std::streamoff fileSize = in.tellg();
+                    in.seekg(0, std::ios::beg);
+
+                    int32_t magic, version, nameLength, keyCount;
+                    if (!readInt(in, magic) || MAGIC != magic || !readInt(in, version) || VERSION != version ||
+                        !readInt(in, nameLength) || nameLength != (int32_t) mapName.size()) {
+                        return false;
+                    }
+                    std::string name((size_t) nameLength, '\0');
+                    if (nameLength > 0 && !in.read(&name[0], nameLength)) {
+                        return false;
+                    }
+                    if (name != mapName || !readInt(in, keyCount) || keyCount < 0) {
+                        return false;
+                    }
+
+                    std::vector<serialization::pimpl::Data> result;
+                    for (int32_t i = 0; i < keyCount && result.size() < maxKeys; ++i) {
+                        int32_t length;
+                        // a corrupted length is rejected before anything is allocated for it
+                        if (!readInt(in, length) || length < (int32_t) serialization::pimpl::Data::DATA_OVERHEAD ||
+                            length > fileSize - in.tellg()) {
+                            return false;
+                        }
+                        std::auto_ptr<std::vector<byte> > bytes(new std::vector<byte>((size_t) length));
+                        if (!in.read((char *) &(*bytes)[0], length)) {
+                            return false;
+                        }
+                        result.push_back(serialization::pimpl::Data(bytes));
+                    }
+
+                    keys.swap(result);
+                    return true;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <set>
+#include <sstream>
+
+#include "hazelcast/client/map/impl/PreloaderImpl.h"
+#include "hazelcast/client/map/impl/KeySnapshot.h"
+#include "hazelcast/client/impl/HotKeyProfiler.h"
+#include "hazelcast/client/spi/ClientContext.h"
+#include "hazelcast/client/spi/InvocationService.h"
+#include "hazelcast/client/spi/PartitionService.h"
+#include "hazelcast/client/connection/CallFuture.h"
+#include "hazelcast/client/protocol/ClientMessage.h"
+#include "hazelcast/client/protocol/codec/MapGetAllCodec.h"
+#include "hazelcast/client/exception/IException.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/ILogger.h"
+#include "hazelcast/util/Util.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            namespace impl {
+                PreloaderImpl::Batch::Batch(int partitionId, const std::vector<serialization::pimpl::Data> &keys)
+                : partitionId(partitionId)
+                , keys(keys) {
+                }
+
+                PreloaderImpl::PreloaderImpl(const std::string &mapName, spi::ClientContext &context,
+                                             const config::PreloaderConfig &config, Listener &listener)
+                : mapName(mapName)
+                , path(KeySnapshot::getPath(config.getDirectory(), mapName))
+                , context(context)
+                , storeIntervalSeconds(config.getStoreIntervalSeconds())
+                , maxKeys((size_t) config.getMaxKeys())
+                , batchSize((size_t) config.getBatchSize())
+                , maxInFlightBatches((size_t) config.getMaxInFlightBatches())
+                , maxBytesPerSecond(config.getMaxBytesPerSecond())
+                , listener(listener)
+                , completed(false)
+                , preloadedEntries(0)
+                , failedBatches(0)
+                , live(true) {
+                    thread.reset(new util::Thread("hz.preloader", staticRun, this));
+                }
+
+                PreloaderImpl::~PreloaderImpl() {
+                    try {
+                        close();
+                    } catch (exception::IException &e) {
+                        util::ILogger::getLogger().warning(
+                                std::string("[PreloaderImpl::~PreloaderImpl] Failed to store the key snapshot of map ") +
+                                mapName + ". " + e.what());
+                    }
+                }
+
+                void PreloaderImpl::storeSnapshot(const std::vector<serialization::pimpl::Data> &keys) {
+                    util::LockGuard guard(storeLock);
+                    KeySnapshot::store(path, mapName, keys, maxKeys);
+
+                    std::vector<serialization::pimpl::Data> stored;
+                    for (size_t i = 0; i < keys.size() && i < maxKeys; ++i) {
+                        stored.push_back(copy(keys[i]));
+                    }
+                    trackedKeys.swap(stored);
+                }
+
+                bool PreloaderImpl::storeHotKeySnapshot() {
+                    client::impl::HotKeyProfiler &profiler = context.getHotKeyProfiler();
+                    if (!profiler.isEnabled()) {
+                        return false;
+                    }
+
+                    HotKeyStats stats = profiler.getStats();
+                    const std::vector<HotKeyStats::HotKey> &hotKeys = stats.getHotKeys();
+                    std::vector<serialization::pimpl::Data> keys;
+                    for (std::vector<HotKeyStats::HotKey>::const_iterator it = hotKeys.begin();
+                         it != hotKeys.end(); ++it) {
+                        if (it->getObjectName() == mapName) {
+                            keys.push_back(serialization::pimpl::Data(std::auto_ptr<std::vector<byte> >(
+                                    new std::vector<byte>(it->getKey()))));
+                        }
+                    }
+
+                    // an idle period does not replace the keys of the previous snapshot
+                    if (keys.empty()) {
+                        return false;
+                    }
+
+                    // the profiler reports at most its top K keys, hence the tracked keys fill the rest of the snapshot
+                    util::LockGuard guard(storeLock);
+                    std::set<std::vector<byte> > storedKeys;
+                    for (std::vector<serialization::pimpl::Data>::const_iterator it = keys.begin(); it != keys.end();
+                         ++it) {
+                        storedKeys.insert(it->toByteArray());
+                    }
+                    for (std::vector<serialization::pimpl::Data>::const_iterator it = trackedKeys.begin();
+                         it != trackedKeys.end() && keys.size() < maxKeys; ++it) {
+                        if (storedKeys.insert(it->toByteArray()).second) {
+                            keys.push_back(copy(*it));
+                        }
+                    }
+
+                    // the tracked keys are replaced only once the snapshot is written
+                    KeySnapshot::store(path, mapName, keys, maxKeys);
+                    if (keys.size() > maxKeys) {
+                        keys.erase(keys.begin() + maxKeys, keys.end());
+                    }
+                    trackedKeys.swap(keys);
+                    return true;
+                }
+
+                bool PreloaderImpl::awaitPreload(int64_t timeoutMillis) {
+                    int64_t deadline = util::currentTimeMillis() + timeoutMillis;
+                    util::LockGuard guard(lock);
+                    while (!completed) {
+                        int64_t remaining = deadline - util::currentTimeMillis();
+                        if (remaining <= 0) {
+                            return false;
+                        }
+                        preloadCompleted.waitForMillis(lock, remaining);
+                    }
+                    return true;
+                }
+
+                bool PreloaderImpl::isPreloadCompleted() {
+                    util::LockGuard guard(lock);
+                    return completed;
+                }
+
+                int64_t PreloaderImpl::getPreloadedEntryCount() {
+                    util::LockGuard guard(lock);
+                    return preloadedEntries;
+                }
+
+                int64_t PreloaderImpl::getFailedBatchCount() {
+                    util::LockGuard guard(lock);
+                    return failedBatches;
+                }
+
+                void PreloaderImpl::close() {
+                    if (!live.compareAndSet(true, false)) {
+                        return;
+                    }
+
+                    thread->join();
+
+                    if (storeIntervalSeconds > 0) {
+                        storeHotKeySnapshot();
+                    }
+                }
+
+                void PreloaderImpl::staticRun(util::ThreadArgs &args) {
+                    PreloaderImpl *preloader = (PreloaderImpl *) args.arg0;
+                    preloader->run();
+                }
+
+                void PreloaderImpl::run() {
+                    try {
+                        preload();
+                    } catch (exception::IException &e) {
+                        util::ILogger::getLogger().warning(
+                                std::string("[PreloaderImpl::run] Failed to preload map ") + mapName + ". " +
+                                e.what());
+                    }
+                    completePreload();
+
+                    if (0 == storeIntervalSeconds) {
+                        return;
+                    }
+
+                    int64_t nextStoreTime = util::currentTimeMillis() + storeIntervalSeconds * 1000LL;
+                    while (live) {
+                        // sleep in short slices, so that close does not wait for the whole interval
+                        util::sleepmillis(100);
+                        if (util::currentTimeMillis() < nextStoreTime) {
+                            continue;
+                        }
+                        nextStoreTime += storeIntervalSeconds * 1000LL;
+                        try {
+                            storeHotKeySnapshot();
+                        } catch (exception::IException &e) {
+                            util::ILogger::getLogger().warning(
+                                    std::string("[PreloaderImpl::run] Failed to store the key snapshot of map ") +
+                                    mapName + ". " + e.what());
+                        }
+                    }
+                }
+
+                void PreloaderImpl::preload() {
+                    std::vector<serialization::pimpl::Data> keys;
+                    if (!KeySnapshot::load(path, mapName, maxKeys, keys)) {
+                        if (util::ILogger::getLogger().isFinestEnabled()) {
+                            util::ILogger::getLogger().finest(
+                                    std::string("[PreloaderImpl::preload] No valid key snapshot at ") + path);
+                        }
+                        return;
+                    }
+
+                    size_t keyCount = keys.size();
+                    std::vector<Batch> batches;
+                    createBatches(keys, batches);
+
+                    spi::InvocationService &invocationService = context.getInvocationService();
+                    std::deque<connection::CallFuture> inFlight;
+                    int64_t startTime = util::currentTimeMillis();
+                    int64_t transferredBytes = 0;
+                    for (std::vector<Batch>::iterator it = batches.begin(); it != batches.end() && live; ++it) {
+                        throttle(startTime, transferredBytes);
+                        if (inFlight.size() >= maxInFlightBatches) {
+                            transferredBytes += complete(inFlight.front());
+                            inFlight.pop_front();
+                        }
+
+                        try {
+                            std::auto_ptr<protocol::ClientMessage> request =
+                                    protocol::codec::MapGetAllCodec::RequestParameters::encode(mapName, it->keys);
+                            transferredBytes += request->getFrameLength();
+                            inFlight.push_back(invocationService.invokeOnPartitionOwner(request, it->partitionId));
+                        } catch (exception::IException &e) {
+                            util::ILogger::getLogger().warning(
+                                    std::string("[PreloaderImpl::preload] Failed to send a batch of map ") + mapName +
+                                    ". " + e.what());
+                            util::LockGuard guard(lock);
+                            ++failedBatches;
+                        }
+                    }
+
+                    // the batches in flight are completed even if the preloader is closed meanwhile
+                    while (!inFlight.empty()) {
+                        complete(inFlight.front());
+                        inFlight.pop_front();
+                    }
+
+                    std::ostringstream out;
+                    out << "Preloaded " << getPreloadedEntryCount() << " entries of map " << mapName << " from "
+                        << keyCount << " snapshot keys in " << (util::currentTimeMillis() - startTime) << " ms.";
+                    util::ILogger::getLogger().info(out.str());
+                }
+
+                void PreloaderImpl::createBatches(std::vector<serialization::pimpl::Data> &keys,
+                                                  std::vector<Batch> &batches) {
+                    spi::PartitionService &partitionService = context.getPartitionService();
+                    std::map<int, std::vector<serialization::pimpl::Data> > partitionKeys;
+                    for (std::vector<serialization::pimpl::Data>::iterator it = keys.begin(); it != keys.end(); ++it) {
+                        partitionKeys[partitionService.getPartitionId(*it)].push_back(*it);
+                    }
+
+                    for (std::map<int, std::vector<serialization::pimpl::Data> >::iterator it = partitionKeys.begin();
+                         it != partitionKeys.end(); ++it) {
+                        std::vector<serialization::pimpl::Data> &partition = it->second;
+                        for (size_t begin = 0; begin < partition.size(); begin += batchSize) {
+                            size_t end = std::min(begin + batchSize, partition.size());
+                            batches.push_back(Batch(it->first, std::vector<serialization::pimpl::Data>(
+                                    partition.begin() + begin, partition.begin() + end)));
+                        }
+                    }
+                }
+
+                void PreloaderImpl::throttle(int64_t startTime, int64_t transferredBytes) {
+                    if (maxBytesPerSecond <= 0) {
+                        return;
+                    }
+
+                    int64_t allowedTime = startTime + transferredBytes * 1000 / maxBytesPerSecond;
+                    while (live) {
+                        int64_t now = util::currentTimeMillis();
+                        if (now >= allowedTime) {
+                            return;
+                        }
+                        util::sleepmillis((unsigned long) std::min(allowedTime - now, (int64_t) 10));
+                    }
+                }
+
+                int64_t PreloaderImpl::complete(connection::CallFuture &future) {
+                    std::auto_ptr<protocol::ClientMessage> response;
+                    try {
+                        response = future.get();
+                        Entries entries = protocol::codec::MapGetAllCodec::ResponseParameters::decode(
+                                *response).response;
+                        if (!entries.empty()) {
+                            trackKeys(entries);
+                            listener.entriesPreloaded(entries);
+                        }
+
+                        util::LockGuard guard(lock);
+                        preloadedEntries += (int64_t) entries.size();
+                    } catch (exception::IException &e) {
+                        util::ILogger::getLogger().warning(
+                                std::string("[PreloaderImpl::complete] Failed to preload a batch of map ") + mapName +
+                                ". " + e.what());
+                        util::LockGuard guard(lock);
+                        ++failedBatches;
+                    }
+
+                    return NULL == response.get() ? 0 : response->getFrameLength();
+                }
+
+                void PreloaderImpl::trackKeys(const Entries &entries) {
+                    util::LockGuard guard(storeLock);
+                    for (Entries::const_iterator it = entries.begin();
+                         it != entries.end() && trackedKeys.size() < maxKeys; ++it) {
+                        trackedKeys.push_back(copy(it->first));
+                    }
+                }
+
+                serialization::pimpl::Data PreloaderImpl::copy(const serialization::pimpl::Data &data) {
+                    return serialization::pimpl::Data(std::auto_ptr<std::vector<byte> >(
+                            new std::vector<byte>(data.toByteArray())));
+                }
+
+                void PreloaderImpl::completePreload() {
+                    util::LockGuard guard(lock);
+                    completed = true;
+                    preloadCompleted.notify_all();
+                }
+            }
+        }
+    }
+}
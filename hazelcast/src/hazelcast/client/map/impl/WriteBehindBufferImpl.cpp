@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "hazelcast/client/map/impl/WriteBehindBufferImpl.h"
+#include "hazelcast/client/spi/ClientContext.h"
+#include "hazelcast/client/spi/InvocationService.h"
+#include "hazelcast/client/spi/PartitionService.h"
+#include "hazelcast/client/connection/CallFuture.h"
+#include "hazelcast/client/connection/CallCompletionListener.h"
+#include "hazelcast/client/protocol/ClientMessage.h"
+#include "hazelcast/client/protocol/codec/MapPutAllCodec.h"
+#include "hazelcast/client/protocol/codec/MapGetCodec.h"
+#include "hazelcast/client/exception/IllegalStateException.h"
+#include "hazelcast/client/exception/ProtocolExceptions.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/ILogger.h"
+#include "hazelcast/util/Util.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace map {
+            namespace impl {
+                class WriteBehindBufferImpl::BatchCompletion : public connection::CallCompletionListener {
+                public:
+                    BatchCompletion(WriteBehindBufferImpl &buffer, const connection::CallFuture &future,
+                                    int partitionId, int32_t entryCount)
+                    : buffer(buffer)
+                    , future(future)
+                    , partitionId(partitionId)
+                    , entryCount(entryCount) {
+                    }
+
+                    virtual void onComplete() {
+                        buffer.onBatchCompleted(partitionId, entryCount, &future);
+                    }
+
+                private:
+                    WriteBehindBufferImpl &buffer;
+                    connection::CallFuture future;
+                    int partitionId;
+                    int32_t entryCount;
+                };
+
+                WriteBehindBufferImpl::PartitionBuffer::PartitionBuffer() : creationTime(util::currentTimeMillis()) {
+                }
+
+                WriteBehindBufferImpl::WriteBehindBufferImpl(const std::string &mapName, spi::ClientContext &context,
+                                                             const config::WriteBehindConfig &config)
+                : mapName(mapName)
+                , context(context)
+                , coalescingWindowMillis(config.getCoalescingWindowMillis())
+                , batchSize((size_t) config.getBatchSize())
+                , maxBufferedEntries((size_t) config.getMaxBufferedEntries())
+                , overflowPolicy(config.getOverflowPolicy())
+                , bufferedEntries(0)
+                , inFlightBatches(0)
+                , overflowed(false)
+                , coalescedUpdates(0)
+                , failedEntries(0)
+                , live(true) {
+                    flushThread.reset(new util::Thread("hz.writeBehindFlusher", staticRunFlusher, this));
+                }
+
+                WriteBehindBufferImpl::~WriteBehindBufferImpl() {
+                    try {
+                        close();
+                    } catch (exception::IException &e) {
+                        util::ILogger::getLogger().warning(
+                                std::string("[WriteBehindBufferImpl::~WriteBehindBufferImpl] Failed to flush the "
+                                                    "updates of map ") + mapName + ". " + e.what());
+                    }
+                }
+
+                void WriteBehindBufferImpl::set(const serialization::pimpl::Data &key,
+                                                const serialization::pimpl::Data &value) {
+                    int partitionId = context.getPartitionService().getPartitionId(key);
+                    const std::vector<byte> &keyBytes = key.toByteArray();
+                    boost::shared_ptr<serialization::pimpl::Data> valueCopy(
+                            new serialization::pimpl::Data(copy(value.toByteArray())));
+
+                    Entries batch;
+                    {
+                        util::LockGuard guard(lock);
+                        checkOpen();
+
+                        while (true) {
+                            std::map<int, PartitionBuffer>::iterator partition = partitions.find(partitionId);
+                            if (partition != partitions.end()) {
+                                Values::iterator buffered = partition->second.buffered.find(keyBytes);
+                                if (buffered != partition->second.buffered.end()) {
+                                    buffered->second = valueCopy;
+                                    ++coalescedUpdates;
+                                    return;
+                                }
+                            }
+
+                            if (bufferedEntries < maxBufferedEntries) {
+                                break;
+                            }
+                            if (config::WriteBehindConfig::FAIL == overflowPolicy) {
+                                throw exception::HazelcastOverloadException("WriteBehindBufferImpl::set",
+                                                                            "The write behind buffer of map " +
+                                                                            mapName + " is full");
+                            }
+                            // the flusher sends all the buffered entries on its next run
+                            overflowed = true;
+                            stateChanged.wait(lock);
+                            checkOpen();
+                        }
+
+                        PartitionBuffer &buffer = partitions[partitionId];
+                        if (buffer.buffered.empty()) {
+                            buffer.creationTime = util::currentTimeMillis();
+                        }
+                        buffer.buffered[keyBytes] = valueCopy;
+                        ++bufferedEntries;
+                        if (buffer.buffered.size() < batchSize || !buffer.inFlight.empty()) {
+                            return;
+                        }
+                        takeBatch(partitionId, buffer, batch);
+                    }
+
+                    send(partitionId, batch);
+                }
+
+                std::auto_ptr<serialization::pimpl::Data> WriteBehindBufferImpl::get(
+                        const serialization::pimpl::Data &key) {
+                    int partitionId = context.getPartitionService().getPartitionId(key);
+                    {
+                        util::LockGuard guard(lock);
+                        std::map<int, PartitionBuffer>::iterator partition = partitions.find(partitionId);
+                        if (partition != partitions.end()) {
+                            const std::vector<byte> &keyBytes = key.toByteArray();
+                            Values::iterator value = partition->second.buffered.find(keyBytes);
+                            if (value != partition->second.buffered.end()) {
+                                return std::auto_ptr<serialization::pimpl::Data>(
+                                        new serialization::pimpl::Data(copy(value->second->toByteArray())));
+                            }
+                            value = partition->second.inFlight.find(keyBytes);
+                            if (value != partition->second.inFlight.end()) {
+                                return std::auto_ptr<serialization::pimpl::Data>(
+                                        new serialization::pimpl::Data(copy(value->second->toByteArray())));
+                            }
+                        }
+                    }
+
+                    std::auto_ptr<protocol::ClientMessage> request =
+                            protocol::codec::MapGetCodec::RequestParameters::encode(mapName, key,
+                                                                                    util::getThreadId());
+                    std::auto_ptr<protocol::ClientMessage> response =
+                            context.getInvocationService().invokeOnPartitionOwner(request, partitionId).get();
+                    return protocol::codec::MapGetCodec::ResponseParameters::decode(*response).response;
+                }
+
+                void WriteBehindBufferImpl::flush() {
+                    while (true) {
+                        std::map<int, Entries> batches;
+                        takeBatches(-1, batches);
+                        for (std::map<int, Entries>::iterator it = batches.begin(); it != batches.end(); ++it) {
+                            send(it->first, it->second);
+                        }
+
+                        util::LockGuard guard(lock);
+                        if (0 == bufferedEntries && 0 == inFlightBatches) {
+                            return;
+                        }
+                        if (batches.empty()) {
+                            // the remaining entries belong to the partitions with a batch in flight
+                            stateChanged.wait(lock);
+                        }
+                    }
+                }
+
+                void WriteBehindBufferImpl::close() {
+                    if (!live.compareAndSet(true, false)) {
+                        return;
+                    }
+
+                    {
+                        util::LockGuard guard(lock);
+                        stateChanged.notify_all();
+                    }
+
+                    flushThread->join();
+
+                    flush();
+                }
+
+                int64_t WriteBehindBufferImpl::getBufferedEntryCount() {
+                    util::LockGuard guard(lock);
+                    return (int64_t) bufferedEntries;
+                }
+
+                int64_t WriteBehindBufferImpl::getCoalescedUpdateCount() {
+                    util::LockGuard guard(lock);
+                    return coalescedUpdates;
+                }
+
+                int64_t WriteBehindBufferImpl::getFailedEntryCount() {
+                    util::LockGuard guard(lock);
+                    return failedEntries;
+                }
+
+                void WriteBehindBufferImpl::staticRunFlusher(util::ThreadArgs &args) {
+                    WriteBehindBufferImpl *buffer = (WriteBehindBufferImpl *) args.arg0;
+                    buffer->runFlusher();
+                }
+
+                std::auto_ptr<std::vector<byte> > WriteBehindBufferImpl::copy(const std::vector<byte> &bytes) {
+                    return std::auto_ptr<std::vector<byte> >(new std::vector<byte>(bytes));
+                }
+
+                void WriteBehindBufferImpl::runFlusher() {
+                    while (live) {
+                        // sleep in short slices, so that close and the blocked producers do not wait for the window
+                        util::sleepmillis((unsigned long) std::min(coalescingWindowMillis, 10));
+
+                        bool sendAll;
+                        {
+                            util::LockGuard guard(lock);
+                            sendAll = overflowed;
+                            overflowed = false;
+                        }
+
+                        std::map<int, Entries> batches;
+                        takeBatches(sendAll ? -1 : util::currentTimeMillis() - coalescingWindowMillis, batches);
+                        for (std::map<int, Entries>::iterator it = batches.begin(); it != batches.end(); ++it) {
+                            send(it->first, it->second);
+                        }
+                    }
+                }
+
+                void WriteBehindBufferImpl::checkOpen() {
+                    if (!live) {
+                        throw exception::IllegalStateException("WriteBehindBufferImpl::checkOpen",
+                                                               "The write behind buffer of map " + mapName +
+                                                               " is closed");
+                    }
+                }
+
+                void WriteBehindBufferImpl::takeBatches(int64_t olderThan, std::map<int, Entries> &batches) {
+                    util::LockGuard guard(lock);
+                    for (std::map<int, PartitionBuffer>::iterator it = partitions.begin(); it != partitions.end(); ++it) {
+                        PartitionBuffer &buffer = it->second;
+                        if (buffer.buffered.empty() || !buffer.inFlight.empty()) {
+                            continue;
+                        }
+                        if (olderThan < 0 || buffer.creationTime <= olderThan) {
+                            takeBatch(it->first, buffer, batches[it->first]);
+                        }
+                    }
+                    if (!batches.empty()) {
+                        stateChanged.notify_all();
+                    }
+                }
+
+                void WriteBehindBufferImpl::takeBatch(int partitionId, PartitionBuffer &buffer, Entries &batch) {
+                    batch.reserve(buffer.buffered.size());
+                    for (Values::const_iterator it = buffer.buffered.begin(); it != buffer.buffered.end(); ++it) {
+                        serialization::pimpl::Data key(copy(it->first));
+                        serialization::pimpl::Data value(copy(it->second->toByteArray()));
+                        batch.push_back(std::make_pair(key, value));
+                    }
+                    bufferedEntries -= buffer.buffered.size();
+                    buffer.inFlight.swap(buffer.buffered);
+                    ++inFlightBatches;
+                }
+
+                void WriteBehindBufferImpl::send(int partitionId, Entries &entries) {
+                    int32_t entryCount = (int32_t) entries.size();
+                    connection::CallFuture future;
+                    try {
+                        std::auto_ptr<protocol::ClientMessage> request =
+                                protocol::codec::MapPutAllCodec::RequestParameters::encode(mapName, entries);
+                        future = context.getInvocationService().invokeOnPartitionOwner(request, partitionId);
+                    } catch (exception::IException &e) {
+                        util::ILogger::getLogger().warning(
+                                std::string("[WriteBehindBufferImpl::send] Failed to send the updates of map ") +
+                                mapName + ". " + e.what());
+                        onBatchCompleted(partitionId, entryCount, NULL);
+                        return;
+                    }
+
+                    future.setCompletionListener(boost::shared_ptr<connection::CallCompletionListener>(
+                            new BatchCompletion(*this, future, partitionId, entryCount)));
+                }
+
+                void WriteBehindBufferImpl::onBatchCompleted(int partitionId, int32_t entryCount,
+                                                             connection::CallFuture *future) {
+                    bool stored = false;
+                    if (NULL != future) {
+                        try {
+                            future->get();
+                            stored = true;
+                        } catch (exception::IException &e) {
+                            util::ILogger::getLogger().warning(
+                                    std::string("[WriteBehindBufferImpl::onBatchCompleted] Failed to store the "
+                                                        "updates of map ") + mapName + ". " + e.what());
+                        }
+                    }
+
+                    // the buffer may be destroyed as soon as the last in flight batch is released
+                    util::LockGuard guard(lock);
+                    if (!stored) {
+                        failedEntries += entryCount;
+                    }
+                    std::map<int, PartitionBuffer>::iterator partition = partitions.find(partitionId);
+                    if (partition != partitions.end()) {
+                        partition->second.inFlight.clear();
+                        if (partition->second.buffered.empty()) {
+                            partitions.erase(partition);
+                        }
+                    }
+                    --inFlightBatches;
+                    stateChanged.notify_all();
+                }
+            }
+        }
+    }
+}
@@ -414,10 +414,47 @@ namespace hazelcast {
                 int32_t existingFrameLen = getFrameLength();
                 int32_t newFrameLen = existingFrameLen + dataSize;
                 ensureBufferSize(newFrameLen);
-                memcpy(buffer + existingFrameLen, msg->buffer, (size_t) dataSize);
+                memcpy(buffer + existingFrameLen, msg->buffer + msg->getDataOffset(), (size_t) dataSize);
                 setFrameLength(newFrameLen);
             }
 
+            int32_t ClientMessage::writeFragmentHeader(byte *header, int32_t length, uint8_t fragmentFlags) const {
+                bool isFirst = (fragmentFlags & BEGIN_FLAG) != 0;
+                uint16_t headerLen = isFirst ? getDataOffset() : HEADER_SIZE;
+                int32_t frameLen = headerLen + length;
+
+                memcpy(header, buffer, headerLen);
+                util::Bits::nativeToLittleEndian4(&frameLen, header + FRAME_LENGTH_FIELD_OFFSET);
+                header[FLAGS_FIELD_OFFSET] = (uint8_t) ((buffer[FLAGS_FIELD_OFFSET] & ~BEGIN_AND_END_FLAGS) |
+                                                        fragmentFlags);
+                util::Bits::nativeToLittleEndian2(&headerLen, header + DATA_OFFSET_FIELD_OFFSET);
+                return headerLen;
+            }
+
+            std::auto_ptr<ClientMessage> ClientMessage::merge(const std::vector<ClientMessage *> &fragments) {
+                const ClientMessage *first = fragments[0];
+                int32_t firstFrameLen = first->getFrameLength();
+                int32_t frameLen = firstFrameLen;
+                for (std::vector<ClientMessage *>::const_iterator it = fragments.begin() + 1;
+                     it != fragments.end(); ++it) {
+                    frameLen += (*it)->getDataSize();
+                }
+
+                std::auto_ptr<ClientMessage> message(new ClientMessage(frameLen));
+                memcpy(message->buffer, first->buffer, (size_t) firstFrameLen);
+                int32_t position = firstFrameLen;
+                for (std::vector<ClientMessage *>::const_iterator it = fragments.begin() + 1;
+                     it != fragments.end(); ++it) {
+                    int32_t dataSize = (*it)->getDataSize();
+                    memcpy(message->buffer + position, (*it)->buffer + (*it)->getDataOffset(), (size_t) dataSize);
+                    position += dataSize;
+                }
+                message->setFrameLength(frameLen);
+                message->setFlags((uint8_t) (first->buffer[FLAGS_FIELD_OFFSET] | BEGIN_AND_END_FLAGS));
+                message->wrapForRead(message->buffer, frameLen, HEADER_SIZE);
+                return message;
+            }
+
             int32_t ClientMessage::getDataSize() const {
                 return this->getFrameLength() - getDataOffset();
             }
@@ -479,6 +516,21 @@ namespace hazelcast {
 
                 return numBytesSent;
             }
+
+            int32_t ClientMessage::readFrom(Socket &socket, int32_t offset, int32_t frameLen) {
+                int32_t numBytesReceived = 0;
+
+                int32_t numBytesLeft = frameLen - offset;
+                if (numBytesLeft > 0) {
+                    numBytesReceived = socket.receive(buffer + offset, numBytesLeft);
+                }
+
+                if (numBytesReceived == numBytesLeft) {
+                    wrapForRead(buffer, frameLen, ClientMessage::HEADER_SIZE);
+                }
+
+                return numBytesReceived;
+            }
         }
     }
 }
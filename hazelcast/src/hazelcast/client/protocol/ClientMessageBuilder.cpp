@@ -24,17 +24,33 @@
 #include "hazelcast/client/protocol/ClientMessageBuilder.h"
 #include "hazelcast/client/protocol/IMessageHandler.h"
 #include "hazelcast/util/ByteBuffer.h"
+#include "hazelcast/util/ILogger.h"
+
+#include <sstream>
 
 namespace hazelcast {
     namespace client {
         namespace protocol {
+            ClientMessageBuilder::HandlerConsumer::HandlerConsumer(IMessageHandler &messageHandler,
+                                                                   connection::Connection &connection)
+            : messageHandler(messageHandler), connection(connection) {
+            }
+
+            void ClientMessageBuilder::HandlerConsumer::onMessage(std::auto_ptr<ClientMessage> message) {
+                messageHandler.handleMessage(connection, message);
+            }
+
             ClientMessageBuilder::ClientMessageBuilder(IMessageHandler &service, connection::Connection &connection)
-            : messageHandler(service), connection(connection) {
+            : handlerConsumer(new HandlerConsumer(service, connection)), consumer(*handlerConsumer) {
+            }
+
+            ClientMessageBuilder::ClientMessageBuilder(MessageConsumer &consumer)
+            : consumer(consumer) {
             }
 
             ClientMessageBuilder::~ClientMessageBuilder() {
                 for (MessageMap::iterator it = partialMessages.begin(); it != partialMessages.end(); ++it) {
-                    delete it->second;
+                    deleteFragments(it->second);
                 }
             }
 
@@ -54,53 +70,89 @@ namespace hazelcast {
                     offset += message->fillMessageFrom(buffer, offset, frameLen);
 
                     if (offset == frameLen) {
-                        if (message->isFlagSet(ClientMessage::BEGIN_AND_END_FLAGS)) {
-                            //MESSAGE IS COMPLETE HERE
-                            messageHandler.handleMessage(connection, message);
-                            isCompleted = true;
-                        } else {
-                            if (message->isFlagSet(ClientMessage::BEGIN_FLAG)) {
-                                // put the message into the partial messages list
-                                addToPartialMessages(message);
-                            } else if (message->isFlagSet(ClientMessage::END_FLAG)) {
-                                // This is the intermediate frame. Append at the previous message buffer
-                                appendExistingPartialMessage(message);
-                                isCompleted = true;
-                            }
-                        }
+                        onFrameCompleted();
+                        // the frame is consumed, the caller can continue with the next frame in the buffer
+                        isCompleted = true;
                     }
                 }
 
                 return isCompleted;
             }
 
+            bool ClientMessageBuilder::onData(Socket &socket) {
+                if (NULL == message.get()) {
+                    return false;
+                }
+
+                offset += message->readFrom(socket, offset, frameLen);
+
+                if (offset == frameLen) {
+                    onFrameCompleted();
+                    return true;
+                }
+
+                return false;
+            }
+
+            int32_t ClientMessageBuilder::getRemainingFrameLength() const {
+                return NULL == message.get() ? 0 : frameLen - offset;
+            }
+
+            void ClientMessageBuilder::onFrameCompleted() {
+                if (message->isFlagSet(ClientMessage::BEGIN_AND_END_FLAGS)) {
+                    //MESSAGE IS COMPLETE HERE
+                    consumer.onMessage(message);
+                } else if (message->isFlagSet(ClientMessage::BEGIN_FLAG)) {
+                    // put the message into the partial messages list
+                    addToPartialMessages(message);
+                } else {
+                    // This is an intermediate or the last fragment. Append to the previous fragments
+                    appendExistingPartialMessage(message);
+                }
+            }
+
             void ClientMessageBuilder::addToPartialMessages(std::auto_ptr<ClientMessage> message) {
                 int64_t id = message->getCorrelationId();
-                partialMessages[id] = message.release();
+                std::vector<ClientMessage *> &fragments = partialMessages[id];
+                if (!fragments.empty()) {
+                    // a stale partial message with the same correlation id, e.g. a re-sent request
+                    deleteFragments(fragments);
+                    fragments.clear();
+                }
+                fragments.push_back(message.release());
             }
 
             bool ClientMessageBuilder::appendExistingPartialMessage(std::auto_ptr<ClientMessage> message) {
-                bool result = false;
-
                 MessageMap::iterator foundItemIter = partialMessages.find(message->getCorrelationId());
-                if (partialMessages.end() != foundItemIter) {
-                    foundItemIter->second->append(message.get());
-                    if (message->isFlagSet(ClientMessage::END_FLAG)) {
-                        // remove from message from map
-                        std::auto_ptr<ClientMessage> foundMessage(foundItemIter->second);
+                if (partialMessages.end() == foundItemIter) {
+                    std::ostringstream out;
+                    out << "[ClientMessageBuilder::appendExistingPartialMessage] Dropping the message fragment for "
+                            "correlation id " << message->getCorrelationId() << " since its first fragment is missing.";
+                    util::ILogger::getLogger().warning(out.str());
+                    return false;
+                }
 
-                        partialMessages.erase(foundItemIter, foundItemIter);
+                bool isLastFragment = message->isFlagSet(ClientMessage::END_FLAG);
+                // The fragments are kept as they are and copied only once into the final message when the last
+                // fragment arrives, so that the message buffer is not reallocated for each fragment.
+                foundItemIter->second.push_back(message.release());
+                if (!isLastFragment) {
+                    return false;
+                }
 
-                        messageHandler.handleMessage(connection, foundMessage);
+                std::auto_ptr<ClientMessage> completeMessage = ClientMessage::merge(foundItemIter->second);
+                deleteFragments(foundItemIter->second);
+                partialMessages.erase(foundItemIter);
 
-                        result = true;
-                    }
-                } else {
-                    // Should never be here
-                    assert(0);
-                }
+                consumer.onMessage(completeMessage);
 
-                return result;
+                return true;
+            }
+
+            void ClientMessageBuilder::deleteFragments(std::vector<ClientMessage *> &fragments) {
+                for (std::vector<ClientMessage *>::iterator it = fragments.begin(); it != fragments.end(); ++it) {
+                    delete *it;
+                }
             }
 
             void ClientMessageBuilder::reset() {
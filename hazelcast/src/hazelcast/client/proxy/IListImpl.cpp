@@ -63,7 +63,7 @@ namespace hazelcast {
             std::string IListImpl::addItemListener(impl::BaseEventHandler *entryEventHandler, bool includeValue) {
                 std::auto_ptr<protocol::codec::IAddListenerCodec> addCodec = std::auto_ptr<protocol::codec::IAddListenerCodec>(
                         new protocol::codec::ListAddListenerCodec(getName(), includeValue,
-                                                                  false));
+                                                                  isSmartListenerRegistration()));
 
                 return registerListener(addCodec, entryEventHandler);
             }
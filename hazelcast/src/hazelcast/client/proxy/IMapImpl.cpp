@@ -84,7 +84,7 @@ namespace hazelcast {
             }
 
             bool IMapImpl::containsKey(const serialization::pimpl::Data &key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapContainsKeyCodec::RequestParameters::encode(getName(), key,
@@ -102,7 +102,7 @@ namespace hazelcast {
             }
 
             std::auto_ptr<serialization::pimpl::Data> IMapImpl::getData(const serialization::pimpl::Data &key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapGetCodec::RequestParameters::encode(getName(), key, util::getThreadId());
@@ -111,8 +111,17 @@ namespace hazelcast {
                         request, partitionId);
             }
 
+            connection::CallFuture IMapImpl::getAsyncData(const serialization::pimpl::Data &key) {
+                int partitionId = getKeyPartitionId(key);
+
+                std::auto_ptr<protocol::ClientMessage> request =
+                        protocol::codec::MapGetCodec::RequestParameters::encode(getName(), key, util::getThreadId());
+
+                return invokeAndGetFuture(request, partitionId);
+            }
+
             std::auto_ptr<serialization::pimpl::Data> IMapImpl::removeData(const serialization::pimpl::Data &key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapRemoveCodec::RequestParameters::encode(getName(), key, util::getThreadId());
 
@@ -121,7 +130,7 @@ namespace hazelcast {
             }
 
             bool IMapImpl::remove(const serialization::pimpl::Data &key, const serialization::pimpl::Data &value) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapRemoveIfSameCodec::RequestParameters::encode(getName(), key, value,
@@ -132,7 +141,7 @@ namespace hazelcast {
             }
 
             void IMapImpl::deleteEntry(const serialization::pimpl::Data &key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapDeleteCodec::RequestParameters::encode(getName(), key, util::getThreadId());
@@ -148,7 +157,7 @@ namespace hazelcast {
             }
 
             bool IMapImpl::tryRemove(const serialization::pimpl::Data &key, long timeoutInMillis) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapTryRemoveCodec::RequestParameters::encode(getName(), key,
@@ -161,7 +170,7 @@ namespace hazelcast {
 
             bool IMapImpl::tryPut(const serialization::pimpl::Data &key, const serialization::pimpl::Data &value,
                                   long timeoutInMillis) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapTryPutCodec::RequestParameters::encode(getName(), key, value,
@@ -175,7 +184,7 @@ namespace hazelcast {
             std::auto_ptr<serialization::pimpl::Data> IMapImpl::putData(const serialization::pimpl::Data &key,
                                                                     const serialization::pimpl::Data &value,
                                                                     long ttlInMillis) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapPutCodec::RequestParameters::encode(getName(), key, value,
@@ -188,7 +197,7 @@ namespace hazelcast {
 
             void IMapImpl::putTransient(const serialization::pimpl::Data &key, const serialization::pimpl::Data &value,
                                         long ttlInMillis) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapPutTransientCodec::RequestParameters::encode(getName(), key, value,
@@ -201,7 +210,7 @@ namespace hazelcast {
             std::auto_ptr<serialization::pimpl::Data> IMapImpl::putIfAbsentData(const serialization::pimpl::Data &key,
                                                                             const serialization::pimpl::Data &value,
                                                                             long ttlInMillis) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapPutIfAbsentCodec::RequestParameters::encode(getName(), key, value,
@@ -214,7 +223,7 @@ namespace hazelcast {
 
             bool IMapImpl::replace(const serialization::pimpl::Data &key, const serialization::pimpl::Data &oldValue,
                                    const serialization::pimpl::Data &newValue) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapReplaceIfSameCodec::RequestParameters::encode(getName(), key, oldValue,
@@ -227,7 +236,7 @@ namespace hazelcast {
 
             std::auto_ptr<serialization::pimpl::Data> IMapImpl::replaceData(const serialization::pimpl::Data &key,
                                                                         const serialization::pimpl::Data &value) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapReplaceCodec::RequestParameters::encode(getName(), key, value,
@@ -239,7 +248,7 @@ namespace hazelcast {
 
             void IMapImpl::set(const serialization::pimpl::Data &key, const serialization::pimpl::Data &value,
                                long ttl) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapSetCodec::RequestParameters::encode(getName(), key, value,
@@ -249,7 +258,7 @@ namespace hazelcast {
             }
 
             void IMapImpl::lock(const serialization::pimpl::Data &key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapLockCodec::RequestParameters::encode(getName(), key, util::getThreadId(),
@@ -259,7 +268,7 @@ namespace hazelcast {
             }
 
             void IMapImpl::lock(const serialization::pimpl::Data &key, long leaseTime) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapLockCodec::RequestParameters::encode(getName(), key, util::getThreadId(),
@@ -269,7 +278,7 @@ namespace hazelcast {
             }
 
             bool IMapImpl::isLocked(const serialization::pimpl::Data &key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapIsLockedCodec::RequestParameters::encode(getName(), key);
@@ -279,7 +288,7 @@ namespace hazelcast {
             }
 
             bool IMapImpl::tryLock(const serialization::pimpl::Data &key, long timeInMillis) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapTryLockCodec::RequestParameters::encode(getName(), key, util::getThreadId(),
@@ -290,7 +299,7 @@ namespace hazelcast {
             }
 
             void IMapImpl::unlock(const serialization::pimpl::Data &key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapUnlockCodec::RequestParameters::encode(getName(), key, util::getThreadId());
@@ -299,7 +308,7 @@ namespace hazelcast {
             }
 
             void IMapImpl::forceUnlock(const serialization::pimpl::Data &key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapForceUnlockCodec::RequestParameters::encode(getName(), key);
@@ -311,7 +320,7 @@ namespace hazelcast {
                 // TODO: Use appropriate flags for the event type as implemented in Java instead of EntryEventType::ALL
                 std::auto_ptr<protocol::codec::IAddListenerCodec> codec(
                         new protocol::codec::MapAddEntryListenerCodec(getName(), includeValue, EntryEventType::ALL,
-                                                                      false));
+                                                                      isSmartListenerRegistration()));
 
                 return registerListener(codec, entryEventHandler);
             }
@@ -321,7 +330,7 @@ namespace hazelcast {
                 serialization::pimpl::Data predicateData = toData<serialization::IdentifiedDataSerializable>(predicate);
                 std::auto_ptr<protocol::codec::IAddListenerCodec> codec(
                         new protocol::codec::MapAddEntryListenerWithPredicateCodec(getName(), predicateData, includeValue, EntryEventType::ALL,
-                                                                      false));
+                                                                      isSmartListenerRegistration()));
 
                 return registerListener(codec, entryEventHandler);
             }
@@ -335,7 +344,7 @@ namespace hazelcast {
             std::string IMapImpl::addEntryListener(impl::BaseEventHandler *handler,
                                                    const serialization::pimpl::Data &key, bool includeValue) {
 
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 // TODO: Use appropriate flags for the event type as implemented in Java instead of EntryEventType::ALL
                 std::auto_ptr<protocol::codec::IAddListenerCodec> codec(
@@ -346,7 +355,7 @@ namespace hazelcast {
             }
 
             std::auto_ptr<map::DataEntryView> IMapImpl::getEntryViewData(const serialization::pimpl::Data &key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapGetEntryViewCodec::RequestParameters::encode(getName(), key,
@@ -357,7 +366,7 @@ namespace hazelcast {
             }
 
             bool IMapImpl::evict(const serialization::pimpl::Data &key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MapEvictCodec::RequestParameters::encode(getName(), key, util::getThreadId());
@@ -380,7 +389,7 @@ namespace hazelcast {
                 // group the request per parition id
                 for (std::vector<serialization::pimpl::Data>::const_iterator it = keys.begin();
                      it != keys.end(); ++it) {
-                    int partitionId = getPartitionId(*it);
+                    int partitionId = getKeyPartitionId(*it);
 
                     partitionedKeys[partitionId].push_back(*it);
                 }
@@ -522,7 +531,7 @@ namespace hazelcast {
                 // group the request per parition id
                 for (EntryVector::const_iterator it = entries.begin();
                      it != entries.end(); ++it) {
-                    int partitionId = getPartitionId(it->first);
+                    int partitionId = getKeyPartitionId(it->first);
 
                     partitionedEntries[partitionId].push_back(*it);
                 }
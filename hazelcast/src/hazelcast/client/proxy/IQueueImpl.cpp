@@ -46,14 +46,15 @@ namespace hazelcast {
     namespace client {
         namespace proxy {
             IQueueImpl::IQueueImpl(const std::string &instanceName, spi::ClientContext *context)
-                    : ProxyImpl("hz:impl:queueService", instanceName, context) {
-                serialization::pimpl::Data data = context->getSerializationService().toData<std::string>(&instanceName);
-                partitionId = getPartitionId(data);
+                    : ProxyImpl("hz:impl:queueService", instanceName, context)
+                    , nameData(context->getSerializationService().toData<std::string>(&instanceName)) {
+                partitionId = getPartitionId(nameData);
             }
 
             std::string IQueueImpl::addItemListener(impl::BaseEventHandler *itemEventHandler, bool includeValue) {
                 std::auto_ptr<protocol::codec::IAddListenerCodec> addCodec = std::auto_ptr<protocol::codec::IAddListenerCodec>(
-                        new protocol::codec::QueueAddListenerCodec(getName(), includeValue, false));
+                        new protocol::codec::QueueAddListenerCodec(getName(), includeValue,
+                                                                   isSmartListenerRegistration()));
 
                 return registerListener(addCodec, itemEventHandler);
             }
@@ -70,14 +71,14 @@ namespace hazelcast {
                                                                                     timeoutInMillis);
 
                 return invokeAndGetResult<bool, protocol::codec::QueueOfferCodec::ResponseParameters>(request,
-                                                                                                      partitionId);
+                                                                                                      getQueuePartitionId());
             }
 
             void IQueueImpl::put(const serialization::pimpl::Data &element) {
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::QueuePutCodec::RequestParameters::encode(getName(), element);
 
-                invoke(request, partitionId);
+                invoke(request, getQueuePartitionId());
             }
 
             std::auto_ptr<serialization::pimpl::Data> IQueueImpl::pollData(long timeoutInMillis) {
@@ -85,7 +86,7 @@ namespace hazelcast {
                         protocol::codec::QueuePollCodec::RequestParameters::encode(getName(), timeoutInMillis);
 
                 return invokeAndGetResult<std::auto_ptr<serialization::pimpl::Data>, protocol::codec::QueuePollCodec::ResponseParameters>(
-                        request, partitionId);
+                        request, getQueuePartitionId());
             }
 
             int IQueueImpl::remainingCapacity() {
@@ -93,7 +94,7 @@ namespace hazelcast {
                         protocol::codec::QueueRemainingCapacityCodec::RequestParameters::encode(getName());
 
                 return invokeAndGetResult<int, protocol::codec::QueueRemainingCapacityCodec::ResponseParameters>(
-                        request, partitionId);
+                        request, getQueuePartitionId());
             }
 
             bool IQueueImpl::remove(const serialization::pimpl::Data &element) {
@@ -101,14 +102,14 @@ namespace hazelcast {
                         protocol::codec::QueueRemoveCodec::RequestParameters::encode(getName(), element);
 
                 return invokeAndGetResult<bool, protocol::codec::QueueRemoveCodec::ResponseParameters>(request,
-                                                                                                       partitionId);
+                                                                                                       getQueuePartitionId());
             }
 
             bool IQueueImpl::contains(const serialization::pimpl::Data &element) {
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::QueueContainsCodec::RequestParameters::encode(getName(), element);
 
-                return invokeAndGetResult<bool, protocol::codec::QueueContainsCodec::ResponseParameters>(request, partitionId);
+                return invokeAndGetResult<bool, protocol::codec::QueueContainsCodec::ResponseParameters>(request, getQueuePartitionId());
             }
 
             std::vector<serialization::pimpl::Data> IQueueImpl::drainToData(size_t maxElements) {
@@ -116,7 +117,7 @@ namespace hazelcast {
                         protocol::codec::QueueDrainToMaxSizeCodec::RequestParameters::encode(getName(), maxElements);
 
                 return invokeAndGetResult<std::vector<serialization::pimpl::Data>, protocol::codec::QueueDrainToMaxSizeCodec::ResponseParameters>(
-                        request, partitionId);
+                        request, getQueuePartitionId());
             }
 
 
@@ -125,7 +126,7 @@ namespace hazelcast {
                         protocol::codec::QueuePeekCodec::RequestParameters::encode(getName());
 
                 return invokeAndGetResult<std::auto_ptr<serialization::pimpl::Data>, protocol::codec::QueuePeekCodec::ResponseParameters>(
-                        request, partitionId);
+                        request, getQueuePartitionId());
             }
 
             int IQueueImpl::size() {
@@ -133,7 +134,7 @@ namespace hazelcast {
                         protocol::codec::QueueSizeCodec::RequestParameters::encode(getName());
 
                 return invokeAndGetResult<int, protocol::codec::QueueSizeCodec::ResponseParameters>(request,
-                                                                                                    partitionId);
+                                                                                                    getQueuePartitionId());
             }
 
             std::vector<serialization::pimpl::Data> IQueueImpl::toArrayData() {
@@ -141,7 +142,7 @@ namespace hazelcast {
                         protocol::codec::QueueIteratorCodec::RequestParameters::encode(getName());
 
                 return invokeAndGetResult<std::vector<serialization::pimpl::Data>, protocol::codec::QueueIteratorCodec::ResponseParameters>(
-                        request, partitionId);
+                        request, getQueuePartitionId());
             }
 
             bool IQueueImpl::containsAll(const std::vector<serialization::pimpl::Data> &elements) {
@@ -149,7 +150,7 @@ namespace hazelcast {
                         protocol::codec::QueueContainsAllCodec::RequestParameters::encode(getName(), elements);
 
                 return invokeAndGetResult<bool, protocol::codec::QueueContainsAllCodec::ResponseParameters>(request,
-                                                                                                            partitionId);
+                                                                                                            getQueuePartitionId());
             }
 
             bool IQueueImpl::addAll(const std::vector<serialization::pimpl::Data> &elements) {
@@ -157,7 +158,7 @@ namespace hazelcast {
                         protocol::codec::QueueAddAllCodec::RequestParameters::encode(getName(), elements);
 
                 return invokeAndGetResult<bool, protocol::codec::QueueAddAllCodec::ResponseParameters>(request,
-                                                                                                       partitionId);
+                                                                                                       getQueuePartitionId());
             }
 
             bool IQueueImpl::removeAll(const std::vector<serialization::pimpl::Data> &elements) {
@@ -165,7 +166,7 @@ namespace hazelcast {
                         protocol::codec::QueueCompareAndRemoveAllCodec::RequestParameters::encode(getName(), elements);
 
                 return invokeAndGetResult<bool, protocol::codec::QueueCompareAndRemoveAllCodec::ResponseParameters>(
-                        request, partitionId);
+                        request, getQueuePartitionId());
             }
 
             bool IQueueImpl::retainAll(const std::vector<serialization::pimpl::Data> &elements) {
@@ -173,16 +174,20 @@ namespace hazelcast {
                         protocol::codec::QueueCompareAndRetainAllCodec::RequestParameters::encode(getName(), elements);
 
                 return invokeAndGetResult<bool, protocol::codec::QueueCompareAndRetainAllCodec::ResponseParameters>(
-                        request, partitionId);
+                        request, getQueuePartitionId());
             }
 
             void IQueueImpl::clear() {
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::QueueClearCodec::RequestParameters::encode(getName());
 
-                invoke(request, partitionId);
+                invoke(request, getQueuePartitionId());
             }
 
+            int IQueueImpl::getQueuePartitionId() {
+                recordKeyAccess(nameData, partitionId);
+                return partitionId;
+            }
         }
     }
 }
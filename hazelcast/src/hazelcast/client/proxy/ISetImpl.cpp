@@ -48,7 +48,8 @@ namespace hazelcast {
 
             std::string ISetImpl::addItemListener(impl::BaseEventHandler *itemEventHandler, bool includeValue) {
                 std::auto_ptr<protocol::codec::IAddListenerCodec> addCodec = std::auto_ptr<protocol::codec::IAddListenerCodec>(
-                        new protocol::codec::SetAddListenerCodec(getName(), includeValue, false));
+                        new protocol::codec::SetAddListenerCodec(getName(), includeValue,
+                                                                 isSmartListenerRegistration()));
 
                 return registerListener(addCodec, itemEventHandler);
             }
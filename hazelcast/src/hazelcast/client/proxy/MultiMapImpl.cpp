@@ -55,7 +55,7 @@ namespace hazelcast {
             }
 
             bool MultiMapImpl::put(const serialization::pimpl::Data& key, const serialization::pimpl::Data& value) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapPutCodec::RequestParameters::encode(getName(), key, value, util::getThreadId());
 
@@ -63,7 +63,7 @@ namespace hazelcast {
             }
 
             std::vector<serialization::pimpl::Data> MultiMapImpl::getData(const serialization::pimpl::Data &key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapGetCodec::RequestParameters::encode(getName(), key, util::getThreadId());
@@ -72,7 +72,7 @@ namespace hazelcast {
             }
 
             bool MultiMapImpl::remove(const serialization::pimpl::Data& key, const serialization::pimpl::Data& value) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapRemoveEntryCodec::RequestParameters::encode(getName(), key, value, util::getThreadId());
@@ -81,7 +81,7 @@ namespace hazelcast {
             }
 
             std::vector<serialization::pimpl::Data> MultiMapImpl::removeData(const serialization::pimpl::Data& key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapRemoveCodec::RequestParameters::encode(getName(), key, util::getThreadId());
 
@@ -110,7 +110,7 @@ namespace hazelcast {
             }
 
             bool MultiMapImpl::containsKey(const serialization::pimpl::Data& key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapContainsKeyCodec::RequestParameters::encode(getName(), key, util::getThreadId());
@@ -126,7 +126,7 @@ namespace hazelcast {
             }
 
             bool MultiMapImpl::containsEntry(const serialization::pimpl::Data& key, const serialization::pimpl::Data& value) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapContainsEntryCodec::RequestParameters::encode(getName(), key, value, util::getThreadId());
@@ -148,7 +148,7 @@ namespace hazelcast {
             }
 
             int MultiMapImpl::valueCount(const serialization::pimpl::Data& key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapValueCountCodec::RequestParameters::encode(getName(), key, util::getThreadId());
@@ -158,14 +158,15 @@ namespace hazelcast {
 
             std::string MultiMapImpl::addEntryListener(impl::BaseEventHandler *entryEventHandler, bool includeValue) {
                 std::auto_ptr<protocol::codec::IAddListenerCodec> addCodec = std::auto_ptr<protocol::codec::IAddListenerCodec>(
-                        new protocol::codec::MultiMapAddEntryListenerCodec(getName(), includeValue, false));
+                        new protocol::codec::MultiMapAddEntryListenerCodec(getName(), includeValue,
+                                                                           isSmartListenerRegistration()));
 
                 return registerListener(addCodec, entryEventHandler);
             }
 
             std::string MultiMapImpl::addEntryListener(impl::BaseEventHandler *entryEventHandler,
                                                    const serialization::pimpl::Data& key, bool includeValue) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::codec::IAddListenerCodec> addCodec = std::auto_ptr<protocol::codec::IAddListenerCodec>(
                         new protocol::codec::MultiMapAddEntryListenerToKeyCodec(getName(), key, includeValue, false));
@@ -180,7 +181,7 @@ namespace hazelcast {
             }
 
             void MultiMapImpl::lock(const serialization::pimpl::Data& key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapLockCodec::RequestParameters::encode(getName(), key, util::getThreadId(), -1);
@@ -189,7 +190,7 @@ namespace hazelcast {
             }
 
             void MultiMapImpl::lock(const serialization::pimpl::Data& key, long leaseTime) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapLockCodec::RequestParameters::encode(getName(), key, util::getThreadId(), leaseTime);
@@ -199,7 +200,7 @@ namespace hazelcast {
 
 
             bool MultiMapImpl::isLocked(const serialization::pimpl::Data& key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapIsLockedCodec::RequestParameters::encode(getName(), key);
@@ -208,7 +209,7 @@ namespace hazelcast {
             }
 
             bool MultiMapImpl::tryLock(const serialization::pimpl::Data& key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapTryLockCodec::RequestParameters::encode(getName(), key, util::getThreadId(), LONG_MAX, 0);
@@ -217,7 +218,7 @@ namespace hazelcast {
             }
 
             bool MultiMapImpl::tryLock(const serialization::pimpl::Data& key, long timeInMillis) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapTryLockCodec::RequestParameters::encode(getName(), key, util::getThreadId(), LONG_MAX, timeInMillis);
@@ -226,7 +227,7 @@ namespace hazelcast {
             }
 
             void MultiMapImpl::unlock(const serialization::pimpl::Data& key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapUnlockCodec::RequestParameters::encode(getName(), key, util::getThreadId());
@@ -235,7 +236,7 @@ namespace hazelcast {
             }
 
             void MultiMapImpl::forceUnlock(const serialization::pimpl::Data& key) {
-                int partitionId = getPartitionId(key);
+                int partitionId = getKeyPartitionId(key);
 
                 std::auto_ptr<protocol::ClientMessage> request =
                         protocol::codec::MultiMapForceUnlockCodec::RequestParameters::encode(getName(), key);
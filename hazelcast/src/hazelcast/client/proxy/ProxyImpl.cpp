@@ -26,6 +26,7 @@
 #include "hazelcast/client/spi/ClusterService.h"
 #include "hazelcast/client/spi/PartitionService.h"
 #include "hazelcast/client/impl/BaseEventHandler.h"
+#include "hazelcast/client/impl/HotKeyProfiler.h"
 #include "hazelcast/client/spi/InvocationService.h"
 #include "hazelcast/client/connection/CallFuture.h"
 
@@ -54,10 +55,27 @@ namespace hazelcast {
                 return context->getServerListenerService().registerListener(addListenerCodec, handler);
             }
 
+            bool ProxyImpl::isSmartListenerRegistration() const {
+                return context->getServerListenerService().isSmartListenerRegistration();
+            }
+
             int ProxyImpl::getPartitionId(const serialization::pimpl::Data& key) {
                 return context->getPartitionService().getPartitionId(key);
             }
 
+            int ProxyImpl::getKeyPartitionId(const serialization::pimpl::Data& key) {
+                int partitionId = getPartitionId(key);
+                recordKeyAccess(key, partitionId);
+                return partitionId;
+            }
+
+            void ProxyImpl::recordKeyAccess(const serialization::pimpl::Data& key, int partitionId) {
+                client::impl::HotKeyProfiler &profiler = context->getHotKeyProfiler();
+                if (profiler.isEnabled()) {
+                    profiler.record(getName(), key, partitionId);
+                }
+            }
+
             std::auto_ptr<protocol::ClientMessage> ProxyImpl::invoke(std::auto_ptr<protocol::ClientMessage> request, int partitionId) {
                 spi::InvocationService& invocationService = context->getInvocationService();
                 connection::CallFuture future = invocationService.invokeOnPartitionOwner(request, partitionId);
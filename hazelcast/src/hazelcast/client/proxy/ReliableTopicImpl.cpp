@@ -23,6 +23,7 @@
 #include "hazelcast/client/spi/ServerListenerService.h"
 #include "hazelcast/client/HazelcastClient.h"
 #include "hazelcast/client/connection/Connection.h"
+#include "hazelcast/util/LockGuard.h"
 
 namespace hazelcast {
     namespace client {
@@ -33,9 +34,33 @@ namespace hazelcast {
                       logger(util::ILogger::getLogger()), config(context->getClientConfig().getReliableTopicConfig(instanceName)) {
             }
 
+            ReliableTopicImpl::~ReliableTopicImpl() {
+                if (NULL != topicPublisher.get()) {
+                    topicPublisher->shutdown();
+                }
+            }
+
             void ReliableTopicImpl::publish(const serialization::pimpl::Data &data) {
                 topic::impl::reliable::ReliableTopicMessage message(data, std::auto_ptr<Address>());
-                ringbuffer->add(message);
+                serialization::pimpl::Data messageData = toData<topic::impl::reliable::ReliableTopicMessage>(message);
+                // the batch of the message is stored right away since the caller waits for it
+                getPublisher().publish(messageData, true)->get();
+            }
+
+            topic::PublishFuture ReliableTopicImpl::publishAsync(const serialization::pimpl::Data &data) {
+                topic::impl::reliable::ReliableTopicMessage message(data, std::auto_ptr<Address>());
+                serialization::pimpl::Data messageData = toData<topic::impl::reliable::ReliableTopicMessage>(message);
+                return topic::PublishFuture(getPublisher().publish(messageData, false));
+            }
+
+            topic::impl::reliable::ReliableTopicPublisher &ReliableTopicImpl::getPublisher() {
+                util::LockGuard guard(publisherLock);
+                if (NULL == topicPublisher.get()) {
+                    int partitionId = getPartitionId(toData<std::string>(ringbuffer->getName()));
+                    topicPublisher = topic::impl::reliable::ReliableTopicPublisher::create(
+                            getName(), ringbuffer->getName(), partitionId, *context, *config);
+                }
+                return *topicPublisher;
             }
         }
     }
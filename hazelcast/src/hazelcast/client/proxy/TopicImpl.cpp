@@ -46,7 +46,7 @@ namespace hazelcast {
             std::string ITopicImpl::addMessageListener(impl::BaseEventHandler *topicEventHandler) {
                 std::auto_ptr<protocol::codec::IAddListenerCodec> addCodec =
                         std::auto_ptr<protocol::codec::IAddListenerCodec>(
-                                new protocol::codec::TopicAddMessageListenerCodec(getName(), false));
+                                new protocol::codec::TopicAddMessageListenerCodec(getName(), isSmartListenerRegistration()));
 
                 return registerListener(addCodec, topicEventHandler);
             }
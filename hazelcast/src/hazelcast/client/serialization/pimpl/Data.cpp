@@ -81,13 +81,14 @@ namespace hazelcast {
                     if (hasPartitionHash()) {
                         return Bits::readIntB(*data, Data::PARTITION_HASH_OFFSET);
                     }
+
+                    // the header is never written here, the buffer is shared by the copies and may be being sent
                     return hashCode();
                 }
 
                 bool Data::hasPartitionHash() const {
-                    size_t length = data->size();
-                    return data.get() != NULL && length >= Data::DATA_OVERHEAD &&
-                            *reinterpret_cast<int *>(&((*data)[PARTITION_HASH_OFFSET])) != 0;
+                    return data.get() != NULL && data->size() >= Data::DATA_OVERHEAD &&
+                            Bits::readIntB(*data, PARTITION_HASH_OFFSET) != 0;
                 }
 
                 std::vector<byte>  &Data::toByteArray() const {
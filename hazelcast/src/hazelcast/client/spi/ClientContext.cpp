@@ -66,6 +66,22 @@ namespace hazelcast {
             Cluster &ClientContext::getCluster() {
                 return hazelcastClient.cluster;
             }
+
+            topic::impl::reliable::ReliableTopicExecutor &ClientContext::getReliableTopicExecutor() {
+                return hazelcastClient.reliableTopicExecutor;
+            }
+
+            client::impl::DeserializationExecutor &ClientContext::getDeserializationExecutor() {
+                return hazelcastClient.deserializationExecutor;
+            }
+
+            client::impl::HotKeyProfiler &ClientContext::getHotKeyProfiler() {
+                return hazelcastClient.hotKeyProfiler;
+            }
+
+            client::impl::BatchEventFlusher &ClientContext::getBatchEventFlusher() {
+                return hazelcastClient.batchEventFlusher;
+            }
         }
 
     }
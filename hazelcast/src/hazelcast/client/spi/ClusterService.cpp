@@ -22,6 +22,7 @@
 #include "hazelcast/client/ClientConfig.h"
 #include "hazelcast/client/serialization/pimpl/SerializationService.h"
 #include "hazelcast/client/connection/ConnectionManager.h"
+#include "hazelcast/client/connection/Connection.h"
 #include "hazelcast/client/InitialMembershipListener.h"
 #include "hazelcast/client/InitialMembershipEvent.h"
 #include "hazelcast/client/Cluster.h"
@@ -71,6 +72,7 @@ namespace hazelcast {
             void ClusterService::shutdown() {
                 active = false;
                 clusterThread.stop();
+                ownerConnector.reset();
             }
 
             std::auto_ptr<Address> ClusterService::getMasterAddress() {
@@ -136,6 +138,15 @@ namespace hazelcast {
                 return result;
             }
 
+            boost::shared_ptr<connection::Connection> ClusterService::getConnection(const Address &address) {
+                return clientContext.getConnectionManager().getConnectionIfAvailable(address);
+            }
+
+            std::vector<boost::shared_ptr<connection::Connection> > ClusterService::getConnections(
+                    const Address &address) {
+                return clientContext.getConnectionManager().getConnections(address);
+            }
+
             std::vector<Member> ClusterService::getMemberList() {
                 typedef std::map<Address, Member, addressComparator> MemberMap;
                 std::vector<Member> v;
@@ -153,12 +164,9 @@ namespace hazelcast {
                 std::vector<Address> addresses;
                 for (std::set<Address, addressComparator>::const_iterator it = socketAddresses.begin();
                      it != socketAddresses.end(); it++) {
-                    if ((Address *) NULL != previousConnectionAddr) {
-                        if (*previousConnectionAddr != *it) {
-                            addresses.push_back(*it);
-                        }
+                    if ((Address *) NULL == previousConnectionAddr || *previousConnectionAddr != *it) {
+                        addresses.push_back(*it);
                     }
-                    addresses.push_back(*it);
                 }
                 if ((Address *) NULL != previousConnectionAddr) {
                     addresses.push_back(*previousConnectionAddr);
@@ -171,7 +179,7 @@ namespace hazelcast {
                 active = false;
                 const int connectionAttemptLimit = clientContext.getClientConfig().getConnectionAttemptLimit();
                 int attempt = 0;
-                exception::IException lastError;
+                std::string lastError;
                 while (true) {
                     if (util::ILogger::getLogger().isEnabled(FINEST)) {
                         std::stringstream message;
@@ -181,26 +189,39 @@ namespace hazelcast {
 
                     time_t tryStartTime = std::time(NULL);
                     std::vector<Address> addresses = findServerAddressesToConnect(previousConnectionAddr);
+
+                    // the members this client is already connected to are known to be reachable, try them first
+                    connection::ConnectionManager &connectionManager = clientContext.getConnectionManager();
+                    std::vector<Address> connectedAddresses;
+                    std::vector<Address> otherAddresses;
                     for (std::vector<Address>::const_iterator it = addresses.begin(); it != addresses.end(); ++it) {
-                        try {
-                            boost::shared_ptr<connection::Connection> pConnection =
-                                    clientContext.getConnectionManager().createOwnerConnection(*it);
-                            active = true;
-                            clientContext.getLifecycleService().fireLifecycleEvent(LifecycleEvent::CLIENT_CONNECTED);
-                            return pConnection;
-                        } catch (exception::IException &e) {
-                            lastError = e;
-                            std::ostringstream errorStream;
-                            errorStream << "IO error  during initial connection to " << (*it) << " for owner connection =>" << e.what();
-                            util::ILogger::getLogger().warning(errorStream.str());
+                        boost::shared_ptr<connection::Connection> connection =
+                                connectionManager.getConnectionIfAvailable(*it);
+                        if (connection.get() != NULL && connection->live) {
+                            connectedAddresses.push_back(*it);
+                        } else {
+                            otherAddresses.push_back(*it);
                         }
                     }
 
+                    boost::shared_ptr<connection::Connection> pConnection;
+                    if (!connectedAddresses.empty()) {
+                        pConnection = connectToAny(connectedAddresses, lastError);
+                    }
+                    if (pConnection.get() == NULL && !otherAddresses.empty()) {
+                        pConnection = connectToAny(otherAddresses, lastError);
+                    }
+                    if (pConnection.get() != NULL) {
+                        active = true;
+                        clientContext.getLifecycleService().fireLifecycleEvent(LifecycleEvent::CLIENT_CONNECTED);
+                        return pConnection;
+                    }
+
                     if (attempt++ >= connectionAttemptLimit) {
                         break;
                     }
                     const double remainingTime = clientContext.getClientConfig().getAttemptPeriod() -
-                                                 std::difftime(std::time(NULL), tryStartTime);
+                                                 std::difftime(std::time(NULL), tryStartTime) * 1000;
                     using namespace std;
                     std::ostringstream errorStream;
                     errorStream << "Unable to get alive cluster connection, try in " << max(0.0, remainingTime)
@@ -208,12 +229,48 @@ namespace hazelcast {
                     util::ILogger::getLogger().warning(errorStream.str());
 
                     if (remainingTime > 0) {
-                        util::sleep((unsigned) remainingTime / 1000);//MTODO
+                        util::sleepmillis((unsigned long) remainingTime);
                     }
                 }
                 throw exception::IllegalStateException("ClusterService",
                                                        "Unable to connect to any address in the config! =>" +
-                                                       std::string(lastError.what()));
+                                                       lastError);
+            }
+
+            boost::shared_ptr<connection::Connection> ClusterService::connectToAny(
+                    const std::vector<Address> &addresses, std::string &lastError) {
+                // Only the connects race, the connections are authenticated one by one in the order they are
+                // established, since authenticating as the owner of more than one member at once is not allowed.
+                ownerConnector.reset();
+                ownerConnector.reset(new connection::ParallelConnector(clientContext.getConnectionManager(),
+                                                                       addresses, true));
+                while (true) {
+                    std::auto_ptr<connection::Connection> connection = ownerConnector->next();
+                    if (connection.get() == NULL) {
+                        break;
+                    }
+
+                    Address address = connection->getRemoteEndpoint();
+                    try {
+                        boost::shared_ptr<connection::Connection> pConnection =
+                                clientContext.getConnectionManager().createOwnerConnection(connection);
+                        ownerConnector->cancel();
+                        return pConnection;
+                    } catch (exception::IException &e) {
+                        lastError = e.what();
+                        std::ostringstream errorStream;
+                        errorStream << "IO error  during initial connection to " << address <<
+                        " for owner connection =>" << e.what();
+                        util::ILogger::getLogger().warning(errorStream.str());
+                    }
+                }
+
+                std::string connectError = ownerConnector->getLastError();
+                if (!connectError.empty()) {
+                    lastError = connectError;
+                    util::ILogger::getLogger().warning(connectError);
+                }
+                return boost::shared_ptr<connection::Connection>();
             }
 
             void ClusterService::fireMembershipEvent(const MembershipEvent &event) {
@@ -42,7 +42,8 @@ namespace hazelcast {
     namespace client {
         namespace spi {
             InvocationService::InvocationService(spi::ClientContext &clientContext)
-                    : clientContext(clientContext), isOpen(false) {
+                    : clientContext(clientContext), admissionController(clientContext.getClientProperties()),
+                      isOpen(false) {
                 redoOperation = clientContext.getClientConfig().isRedoOperation();
                 ClientProperties &properties = clientContext.getClientProperties();
                 retryWaitTime = properties.getRetryWaitTime().getInteger();
@@ -111,7 +112,7 @@ namespace hazelcast {
                 boost::shared_ptr<Address> owner = clientContext.getPartitionService().getPartitionOwner(partitionId);
                 if (owner.get() != NULL) {
                     boost::shared_ptr<connection::Connection> connection = clientContext.getConnectionManager().getOrConnect(
-                            *owner, retryCount);
+                            *owner, retryCount, partitionId);
                     std::auto_ptr<client::impl::BaseEventHandler> managedEventHandler(handler);
                     return doSend(request, managedEventHandler, connection, partitionId);
                 }
@@ -136,6 +137,10 @@ namespace hazelcast {
                 return retryCount;
             }
 
+            impl::AdmissionController &InvocationService::getAdmissionController() {
+                return admissionController;
+            }
+
             void InvocationService::removeEventHandler(int64_t callId) {
                 std::vector<boost::shared_ptr<connection::Connection> > connections = clientContext.getConnectionManager().getConnections();
                 std::vector<boost::shared_ptr<connection::Connection> >::iterator it;
@@ -154,10 +159,22 @@ namespace hazelcast {
                                                               int partitionId) {
                 request->setPartitionId(partitionId);
                 boost::shared_ptr<connection::CallPromise> promise(new connection::CallPromise());
+                bool callerRuns = false;
+                // heartbeats are not limited, an overloaded connection shall not be assumed to be dead
+                if (admissionController.isEnabled() &&
+                    protocol::codec::ClientPingCodec::RequestParameters::TYPE != request->getMessageType()) {
+                    callerRuns = admissionController.acquire(*connection);
+                    promise->setAdmissionController(&admissionController);
+                }
                 promise->setRequest(request);
                 promise->setEventHandler(eventHandler);
 
                 boost::shared_ptr<connection::Connection> conn = registerAndEnqueue(connection, promise);
+                if (callerRuns) {
+                    int64_t start = util::currentTimeMillis();
+                    promise->getFuture().waitFor(admissionController.getTimeoutMillis());
+                    admissionController.recordWait(util::currentTimeMillis() - start);
+                }
                 return connection::CallFuture(promise, conn, heartbeatTimeout, this);
             }
 
@@ -178,8 +195,8 @@ namespace hazelcast {
                     if (protocol::codec::ClientPingCodec::RequestParameters::TYPE == request.getMessageType()) {
                         return true;
                     }
-                    std::stringstream message;
                     if (logger.isEnabled(FINEST)) {
+                        std::stringstream message;
                         message << " Connection(" << connection.getRemoteEndpoint();
                         message << ") is not heart-beating, won't write packet with callId : " <<
                         request.getCorrelationId();
@@ -220,7 +237,7 @@ namespace hazelcast {
 
                 boost::shared_ptr<connection::Connection> actualConn = registerAndEnqueue(connection, promise);
 
-                if (NULL != actualConn.get()) {
+                if (NULL != actualConn.get() && util::ILogger::getLogger().isEnabled(INFO)) {
                     char msg[300];
                     const Address &serverAddr = connection->getRemoteEndpoint();
                     hazelcast::util::snprintf(msg, 300, "[InvocationService::resend] Re-sending the request with id %lld "
@@ -254,7 +271,9 @@ namespace hazelcast {
                 protocol::ClientMessage *request = promise->getRequest();
 
                 if (!isAllowedToSentRequest(*connection, *request)) {
-                    deRegisterCall(connection->getConnectionId(), request->getCorrelationId());
+                    if (NULL != deRegisterCall(connection->getConnectionId(), request->getCorrelationId()).get()) {
+                        connection->callEnded();
+                    }
                     std::string address = util::IOUtil::to_string(connection->getRemoteEndpoint());
 
                     // slow down the resend to avoid infinite loop until the connection is closed
@@ -273,6 +292,8 @@ namespace hazelcast {
                                                  boost::shared_ptr<connection::CallPromise> promise) {
                 int64_t callId = clientContext.getConnectionManager().getNextCallId();
                 promise->getRequest()->setCorrelationId(callId);
+                promise->setSendTime(util::currentTimeMillis());
+                connection.callStarted();
                 if (getCallPromiseMap(connection.getConnectionId())->put(callId, promise).get()) {
                     std::ostringstream out;
                     out << "[InvocationService::registerCall] The call id map already contains the promise for call "
@@ -311,7 +332,7 @@ namespace hazelcast {
                 const Address &serverAddr = connection.getRemoteEndpoint();
                 boost::shared_ptr<connection::CallPromise> promise = deRegisterCall(connId, correlationId);
                 if (NULL == promise.get()) {
-                    if (connection.live) {
+                    if (connection.live && util::ILogger::getLogger().isFinestEnabled()) {
                         std::ostringstream out;
                         out << "[InvocationService::handleMessage] Could not find the promise for correlation id:" <<
                                 correlationId << ". It may have been re-sent.";
@@ -324,6 +345,9 @@ namespace hazelcast {
                     return;
                 }
 
+                connection.callEnded();
+                connection.recordResponseTime(util::currentTimeMillis() - promise->getSendTime());
+
                 if (protocol::codec::ErrorCodec::TYPE == message->getMessageType()) {
                     std::auto_ptr<exception::IException> exception = exceptionFactory.createException(*message);
 
@@ -385,10 +409,14 @@ namespace hazelcast {
 
                 std::string address = util::IOUtil::to_string(connection.getRemoteEndpoint());
 
-                char msg[200];
-                util::snprintf(msg, 200, "[cleanResources] There are %u waiting promises on connection with id:%d (%s) ",
-                               promises.size(), connection.getConnectionId(), address.c_str());
-                util::ILogger::getLogger().info(msg);
+                util::ILogger &logger = util::ILogger::getLogger();
+                if (logger.isEnabled(INFO)) {
+                    LogRecord record(INFO, "[InvocationService::cleanResources] Cleaning the waiting promises");
+                    record.addField("promises", promises.size());
+                    record.addField("connectionId", connection.getConnectionId());
+                    record.addField("address", address);
+                    logger.log(record);
+                }
 
                 for (std::vector<std::pair<int64_t, boost::shared_ptr<connection::CallPromise> > >::iterator it = promises.begin();
                      it != promises.end(); ++it) {
@@ -412,10 +440,12 @@ namespace hazelcast {
 
                 util::ILogger &logger = util::ILogger::getLogger();
 
-                char msg[200];
-                util::snprintf(msg, 200, "[InvocationService::cleanEventHandlers] There are %ld event handler promises on connection with id:%d to be retried",
-                               promises.size(), connection.getConnectionId());
-                logger.info(msg);
+                if (logger.isEnabled(INFO)) {
+                    LogRecord record(INFO, "[InvocationService::cleanEventHandlers] Retrying the event handler promises");
+                    record.addField("promises", promises.size());
+                    record.addField("connectionId", connection.getConnectionId());
+                    logger.log(record);
+                }
 
                 if (isOpen) {
                     for (std::vector<std::pair<int64_t, boost::shared_ptr<connection::CallPromise> > >::const_iterator it = promises.begin();
@@ -22,9 +22,14 @@
 #include "hazelcast/client/spi/ClientContext.h"
 #include "hazelcast/client/spi/InvocationService.h"
 #include "hazelcast/client/spi/ClusterService.h"
+#include "hazelcast/client/spi/ServerListenerService.h"
 #include "hazelcast/client/ClientConfig.h"
 #include "hazelcast/client/connection/ConnectionManager.h"
 #include "hazelcast/client/LifecycleListener.h"
+#include "hazelcast/client/topic/impl/reliable/ReliableTopicExecutor.h"
+#include "hazelcast/client/impl/DeserializationExecutor.h"
+#include "hazelcast/client/impl/HotKeyProfiler.h"
+#include "hazelcast/client/impl/BatchEventFlusher.h"
 
 namespace hazelcast {
     namespace client {
@@ -58,6 +63,8 @@ namespace hazelcast {
                     return false;
                 }
 
+                clientContext.getServerListenerService().start();
+
                 fireLifecycleEvent(LifecycleEvent::STARTED);
                 return true;
             }
@@ -66,11 +73,18 @@ namespace hazelcast {
                 if (!active.compareAndSet(true, false))
                     return;
                 fireLifecycleEvent(LifecycleEvent::SHUTTING_DOWN);
+                clientContext.getReliableTopicExecutor().shutdown();
+                clientContext.getDeserializationExecutor().shutdown();
+                clientContext.getHotKeyProfiler().shutdown();
+                clientContext.getBatchEventFlusher().shutdown();
                 clientContext.getInvocationService().shutdown();
                 clientContext.getPartitionService().shutdown();
+                clientContext.getServerListenerService().shutdown();
                 clientContext.getClusterService().shutdown();
                 clientContext.getConnectionManager().shutdown();
                 fireLifecycleEvent(LifecycleEvent::SHUTDOWN);
+                // the sink of the config may be destroyed right after the client
+                util::ILogger::getLogger().flush();
             }
 
             void LifecycleService::addLifecycleListener(LifecycleListener *lifecycleListener) {
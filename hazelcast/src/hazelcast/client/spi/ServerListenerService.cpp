@@ -27,12 +27,49 @@
 #include "hazelcast/client/protocol/codec/IAddListenerCodec.h"
 #include "hazelcast/client/protocol/codec/IRemoveListenerCodec.h"
 #include "hazelcast/client/spi/impl/listener/EventRegistration.h"
+#include "hazelcast/client/spi/impl/listener/SmartListenerRegistration.h"
+#include "hazelcast/client/spi/impl/listener/DelegatingEventHandler.h"
+#include "hazelcast/client/spi/ClusterService.h"
+#include "hazelcast/client/spi/LifecycleService.h"
+#include "hazelcast/client/exception/IllegalStateException.h"
+#include "hazelcast/client/ClientConfig.h"
+#include "hazelcast/client/ClientProperties.h"
+#include "hazelcast/client/Member.h"
+#include "hazelcast/util/Thread.h"
 
 namespace hazelcast {
     namespace client {
         namespace spi {
             ServerListenerService::ServerListenerService(spi::ClientContext &clientContext)
                     : clientContext(clientContext) {
+                smartListenerRegistration = clientContext.getClientConfig().isSmart() &&
+                        clientContext.getClientProperties().getSmartListenerRegistration().getBoolean();
+            }
+
+            void ServerListenerService::start() {
+                if (!smartListenerRegistration) {
+                    return;
+                }
+
+                smartListenerThread.reset(new util::Thread("hz.smartListenerSync",
+                                                           ServerListenerService::staticRunSmartListenerSync, this));
+            }
+
+            void ServerListenerService::shutdown() {
+                if (NULL != smartListenerThread.get()) {
+                    smartListenerThread->wakeup();
+                    smartListenerThread->join();
+                }
+            }
+
+            bool ServerListenerService::isSmartListenerRegistration() const {
+                return smartListenerRegistration;
+            }
+
+            void ServerListenerService::wakeup() {
+                if (NULL != smartListenerThread.get()) {
+                    smartListenerThread->wakeup();
+                }
             }
 
             std::string ServerListenerService::registerListener(
@@ -50,6 +87,10 @@ namespace hazelcast {
             std::string ServerListenerService::registerListener(
                     std::auto_ptr<protocol::codec::IAddListenerCodec> addListenerCodec,
                     client::impl::BaseEventHandler *handler) {
+                if (smartListenerRegistration) {
+                    return registerSmartListener(addListenerCodec, handler);
+                }
+
                 connection::CallFuture future = clientContext.getInvocationService().invokeOnRandomTarget(
                         addListenerCodec->encodeRequest(), handler);
 
@@ -59,18 +100,22 @@ namespace hazelcast {
             void ServerListenerService::reRegisterListener(std::string registrationId,
                                                            protocol::ClientMessage *response) {
 
-                boost::shared_ptr<impl::listener::EventRegistration> registration = registrationIdMap.get(
-                        registrationId);
-                if ((impl::listener::EventRegistration *)NULL != registration.get()) {
+                boost::shared_ptr<const std::string> oldAlias = registrationAliasMap.get(registrationId);
+                if (oldAlias.get() == (const std::string *)NULL) {
+                    // the listener is already de-registered
+                    return;
+                }
+
+                boost::shared_ptr<impl::listener::EventRegistration> registration = registrationIdMap.get(*oldAlias);
+                if ((impl::listener::EventRegistration *)NULL != registration.get() &&
+                    (impl::listener::SmartListenerRegistration *)NULL == registration->getSmartRegistration().get()) {
+                    registrationIdMap.remove(*oldAlias);
                     // registration exists, just change the alias
                     boost::shared_ptr<std::string> alias(
                             new std::string(registration->getAddCodec()->decodeResponse(*response)));
-                    boost::shared_ptr<const std::string> oldAlias = registrationAliasMap.put(registrationId, alias);
-                    if (oldAlias.get() != (const std::string *)NULL) {
-                        registrationIdMap.remove(*oldAlias);
-                        registration->setCorrelationId(response->getCorrelationId());
-                        registrationIdMap.put(*alias, registration);
-                    }
+                    registration->setCorrelationId(response->getCorrelationId());
+                    registrationIdMap.put(*alias, registration);
+                    registrationAliasMap.put(registrationId, alias);
                 }
             }
 
@@ -80,6 +125,12 @@ namespace hazelcast {
                     boost::shared_ptr<impl::listener::EventRegistration> registration = registrationIdMap.remove(*uuid);
 
                     if ((impl::listener::EventRegistration *)NULL != registration.get()) {
+                        const boost::shared_ptr<impl::listener::SmartListenerRegistration> &smartRegistration =
+                                registration->getSmartRegistration();
+                        if ((impl::listener::SmartListenerRegistration *)NULL != smartRegistration.get()) {
+                            return deRegisterSmartListener(*smartRegistration, removeListenerCodec);
+                        }
+
                         clientContext.getInvocationService().removeEventHandler(registration->getCorrelationId());
 
                         // send a remove listener request
@@ -108,6 +159,14 @@ namespace hazelcast {
 
             void ServerListenerService::retryFailedListener(
                     boost::shared_ptr<connection::CallPromise> listenerPromise) {
+                if (smartListenerRegistration && listenerPromise->getRequest()->isBindToSingleConnection()) {
+                    // member local registrations can not be moved to another member, the sync thread shall
+                    // register again when the member is reachable
+                    removeSmartMemberRegistration(listenerPromise->getRequest()->getCorrelationId());
+                    wakeup();
+                    return;
+                }
+
                 try {
                     InvocationService &invocationService = clientContext.getInvocationService();
                     boost::shared_ptr<connection::Connection> result =
@@ -142,6 +201,8 @@ namespace hazelcast {
                     }
                 }
                 failedListeners = newFailedListeners;
+
+                wakeup();
             }
 
             std::string ServerListenerService::registerInternal(
@@ -164,6 +225,178 @@ namespace hazelcast {
 
                 return registrationId;
             }
+
+            std::string ServerListenerService::registerSmartListener(
+                    std::auto_ptr<protocol::codec::IAddListenerCodec> &addListenerCodec,
+                    client::impl::BaseEventHandler *handler) {
+                boost::shared_ptr<impl::listener::SmartListenerRegistration> registration(
+                        new impl::listener::SmartListenerRegistration(addListenerCodec,
+                                                                      boost::shared_ptr<client::impl::BaseEventHandler>(
+                                                                              handler)));
+
+                std::vector<Member> members = clientContext.getClusterService().getMemberList();
+                std::string registrationId;
+                std::string lastError;
+
+                for (std::vector<Member>::const_iterator it = members.begin(); it != members.end(); ++it) {
+                    try {
+                        std::string memberRegistrationId = registerOnMember(*registration, it->getAddress());
+                        // the registration id of the first member is used as the id of the whole registration
+                        if (registrationId.empty()) {
+                            registrationId = memberRegistrationId;
+                        }
+                    } catch (exception::IException &e) {
+                        lastError = e.what();
+                        std::ostringstream out;
+                        out << "[ServerListenerService::registerSmartListener] Could not register the listener on "
+                                "member " << it->getAddress() << ". It shall be retried later. " << e.what();
+                        util::ILogger::getLogger().warning(out.str());
+                    }
+                }
+
+                if (registrationId.empty()) {
+                    throw exception::IllegalStateException("ServerListenerService::registerSmartListener",
+                                                           "Could not register the listener on any member. " +
+                                                           lastError);
+                }
+
+                // the registration is not visible to the sync thread until now, hence the member registrations
+                // above can not race with it
+                registrationAliasMap.put(registrationId,
+                                         boost::shared_ptr<std::string>(new std::string(registrationId)));
+                registrationIdMap.put(registrationId, boost::shared_ptr<impl::listener::EventRegistration>(
+                        new impl::listener::EventRegistration(registration)));
+
+                return registrationId;
+            }
+
+            std::string ServerListenerService::registerOnMember(
+                    impl::listener::SmartListenerRegistration &registration, const Address &member) {
+                const protocol::codec::IAddListenerCodec &addCodec = registration.getAddCodec();
+                std::auto_ptr<protocol::ClientMessage> request = addCodec.encodeRequest();
+                // the registration is member local, hence it should never be re-sent to another member
+                request->setIsBoundToSingleConnection(true);
+
+                // the de-registration waits for the registrations in progress, so that no member registration is
+                // added after the listener is removed
+                if (!registration.beginMemberRegistration()) {
+                    return std::string();
+                }
+
+                try {
+                    connection::CallFuture future = clientContext.getInvocationService().invokeOnTarget(
+                            request, new impl::listener::DelegatingEventHandler(registration.getHandler()), member);
+
+                    std::auto_ptr<protocol::ClientMessage> response = future.get();
+
+                    std::string registrationId = addCodec.decodeResponse(*response);
+
+                    registration.addMemberRegistration(member, registrationId, future.getCallId());
+
+                    registration.endMemberRegistration();
+
+                    return registrationId;
+                } catch (...) {
+                    registration.endMemberRegistration();
+                    throw;
+                }
+            }
+
+            bool ServerListenerService::deRegisterSmartListener(
+                    impl::listener::SmartListenerRegistration &registration,
+                    protocol::codec::IRemoveListenerCodec &removeListenerCodec) {
+                InvocationService &invocationService = clientContext.getInvocationService();
+                impl::listener::SmartListenerRegistration::MemberRegistrations memberRegistrations =
+                        registration.close();
+                for (impl::listener::SmartListenerRegistration::MemberRegistrations::const_iterator it =
+                        memberRegistrations.begin(); it != memberRegistrations.end(); ++it) {
+                    invocationService.removeEventHandler(it->second.correlationId);
+
+                    removeListenerCodec.setRegistrationId(it->second.registrationId);
+                    try {
+                        invocationService.invokeOnTarget(removeListenerCodec.encodeRequest(), it->first).get();
+                    } catch (exception::IException &) {
+                        // the member is not reachable, the registration is removed with the member connection
+                    }
+                }
+                return true;
+            }
+
+            bool ServerListenerService::removeSmartMemberRegistration(int64_t correlationId) {
+                std::vector<boost::shared_ptr<impl::listener::EventRegistration> > registrations =
+                        registrationIdMap.values();
+                for (std::vector<boost::shared_ptr<impl::listener::EventRegistration> >::const_iterator it =
+                        registrations.begin(); it != registrations.end(); ++it) {
+                    const boost::shared_ptr<impl::listener::SmartListenerRegistration> &smartRegistration =
+                            (*it)->getSmartRegistration();
+                    if ((impl::listener::SmartListenerRegistration *)NULL != smartRegistration.get() &&
+                        smartRegistration->removeMemberRegistration(correlationId)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void ServerListenerService::syncSmartListenerRegistrations() {
+                std::vector<Member> members = clientContext.getClusterService().getMemberList();
+                InvocationService &invocationService = clientContext.getInvocationService();
+
+                std::vector<std::pair<std::string, boost::shared_ptr<impl::listener::EventRegistration> > >
+                        registrations = registrationIdMap.entrySet();
+                for (std::vector<std::pair<std::string, boost::shared_ptr<impl::listener::EventRegistration> > >::const_iterator it =
+                        registrations.begin(); it != registrations.end(); ++it) {
+                    const boost::shared_ptr<impl::listener::SmartListenerRegistration> &smartRegistration =
+                            it->second->getSmartRegistration();
+                    if ((impl::listener::SmartListenerRegistration *)NULL == smartRegistration.get()) {
+                        continue;
+                    }
+                    impl::listener::SmartListenerRegistration &registration = *smartRegistration;
+
+                    impl::listener::SmartListenerRegistration::MemberRegistrations removed =
+                            registration.removeMembersNotIn(members);
+                    for (impl::listener::SmartListenerRegistration::MemberRegistrations::const_iterator removedIt =
+                            removed.begin(); removedIt != removed.end(); ++removedIt) {
+                        invocationService.removeEventHandler(removedIt->second.correlationId);
+                    }
+
+                    for (std::vector<Member>::const_iterator member = members.begin();
+                         member != members.end(); ++member) {
+                        if (registration.isRegisteredOn(member->getAddress())) {
+                            continue;
+                        }
+
+                        try {
+                            registerOnMember(registration, member->getAddress());
+                        } catch (exception::IException &e) {
+                            std::ostringstream out;
+                            out << "[ServerListenerService::syncSmartListenerRegistrations] Could not register the "
+                                    "listener " << it->first << " on member " << member->getAddress() << ". " <<
+                                    e.what();
+                            util::ILogger::getLogger().warning(out.str());
+                        }
+                    }
+                }
+            }
+
+            void ServerListenerService::staticRunSmartListenerSync(util::ThreadArgs &args) {
+                ServerListenerService *listenerService = (ServerListenerService *) args.arg0;
+                listenerService->runSmartListenerSync(args.currentThread);
+            }
+
+            void ServerListenerService::runSmartListenerSync(util::Thread *currentThread) {
+                while (clientContext.getLifecycleService().isRunning()) {
+                    try {
+                        currentThread->interruptibleSleep(10);
+                        if (!clientContext.getLifecycleService().isRunning()) {
+                            break;
+                        }
+                        syncSmartListenerRegistrations();
+                    } catch (exception::IException &e) {
+                        util::ILogger::getLogger().warning(
+                                std::string("ServerListenerService::runSmartListenerSync") + e.what());
+                    }
+                }
+            }
         }
     }
 }
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/spi/impl/AdmissionController.h"
+#include "hazelcast/client/ClientProperties.h"
+#include "hazelcast/client/connection/Connection.h"
+#include "hazelcast/client/exception/ProtocolExceptions.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/ILogger.h"
+#include "hazelcast/util/Util.h"
+
+#include <algorithm>
+
+namespace hazelcast {
+    namespace client {
+        namespace spi {
+            namespace impl {
+                AdmissionController::AdmissionController(const ClientProperties &properties)
+                        : maxInvocations(properties.getMaxConcurrentInvocations().getInteger()),
+                          maxInvocationsPerConnection(properties.getMaxConcurrentInvocationsPerConnection().getInteger()),
+                          maxWriteQueueBytes(properties.getMaxWriteQueueBytes().getLong()),
+                          policy(toPolicy(properties.getBackpressurePolicy().getString())),
+                          timeoutMillis(properties.getBackpressureTimeoutMillis().getLong()), outstanding(0),
+                          waiters(0), admittedCount(0), waitedCount(0), totalWaitMillis(0), maxWaitMillis(0),
+                          rejectedCount(0), callerRunsCount(0) {
+                }
+
+                bool AdmissionController::isEnabled() const {
+                    return maxInvocations > 0 || maxInvocationsPerConnection > 0 || maxWriteQueueBytes > 0;
+                }
+
+                bool AdmissionController::acquire(connection::Connection &connection) {
+                    util::LockGuard guard(lock);
+                    if (!isOverloaded(connection)) {
+                        ++outstanding;
+                        ++admittedCount;
+                        return false;
+                    }
+
+                    if (CALLER_RUNS == policy) {
+                        ++outstanding;
+                        ++admittedCount;
+                        ++callerRunsCount;
+                        return true;
+                    }
+
+                    if (BLOCK == policy) {
+                        int64_t start = util::currentTimeMillis();
+                        int64_t remaining = timeoutMillis;
+                        ++waiters;
+                        while (remaining > 0 && isOverloaded(connection)) {
+                            // the write queue is drained without a notification, hence it is checked periodically
+                            releasedCondition.waitForMillis(lock, std::min<int64_t>(remaining, 10));
+                            remaining = timeoutMillis - (util::currentTimeMillis() - start);
+                        }
+                        --waiters;
+                        recordWaitInternal(util::currentTimeMillis() - start);
+
+                        if (!isOverloaded(connection)) {
+                            ++outstanding;
+                            ++admittedCount;
+                            return false;
+                        }
+                    }
+
+                    ++rejectedCount;
+                    char msg[200];
+                    util::snprintf(msg, 200, "The invocation is rejected since the client is overloaded. Outstanding "
+                            "invocations:%d, pending invocations of the connection:%d, queued bytes of the "
+                            "connection:%lld", outstanding, connection.getPendingCallCount(),
+                                   (long long) connection.getWriteQueueBytes());
+                    throw exception::HazelcastOverloadException("AdmissionController::acquire", msg);
+                }
+
+                void AdmissionController::release() {
+                    util::LockGuard guard(lock);
+                    --outstanding;
+                    if (waiters > 0) {
+                        releasedCondition.notify_all();
+                    }
+                }
+
+                void AdmissionController::recordWait(int64_t waitMillis) {
+                    util::LockGuard guard(lock);
+                    recordWaitInternal(waitMillis);
+                }
+
+                int64_t AdmissionController::getTimeoutMillis() const {
+                    return timeoutMillis;
+                }
+
+                InvocationAdmissionStats AdmissionController::getStats() {
+                    util::LockGuard guard(lock);
+                    return InvocationAdmissionStats(outstanding, admittedCount, waitedCount, totalWaitMillis,
+                                                    maxWaitMillis, rejectedCount, callerRunsCount);
+                }
+
+                bool AdmissionController::isOverloaded(connection::Connection &connection) const {
+                    if (maxInvocations > 0 && outstanding >= maxInvocations) {
+                        return true;
+                    }
+                    if (maxInvocationsPerConnection > 0 &&
+                        connection.getPendingCallCount() >= maxInvocationsPerConnection) {
+                        return true;
+                    }
+                    return maxWriteQueueBytes > 0 && connection.getWriteQueueBytes() >= maxWriteQueueBytes;
+                }
+
+                void AdmissionController::recordWaitInternal(int64_t waitMillis) {
+                    ++waitedCount;
+                    totalWaitMillis += waitMillis;
+                    if (waitMillis > maxWaitMillis) {
+                        maxWaitMillis = waitMillis;
+                    }
+                }
+
+                AdmissionController::Policy AdmissionController::toPolicy(const std::string &name) {
+                    if ("FAIL_FAST" == name) {
+                        return FAIL_FAST;
+                    }
+                    if ("CALLER_RUNS" == name) {
+                        return CALLER_RUNS;
+                    }
+                    if ("BLOCK" != name) {
+                        util::ILogger::getLogger().warning(std::string("[AdmissionController] Unknown backpressure "
+                                                                               "policy ") + name + ", using BLOCK.");
+                    }
+                    return BLOCK;
+                }
+            }
+        }
+    }
+}
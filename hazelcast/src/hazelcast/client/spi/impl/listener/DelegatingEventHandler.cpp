@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/spi/impl/listener/DelegatingEventHandler.h"
+#include "hazelcast/client/protocol/ClientMessage.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace spi {
+            namespace impl {
+                namespace listener {
+                    DelegatingEventHandler::DelegatingEventHandler(
+                            boost::shared_ptr<client::impl::BaseEventHandler> delegate) : delegate(delegate) {
+                    }
+
+                    DelegatingEventHandler::~DelegatingEventHandler() {
+                    }
+
+                    void DelegatingEventHandler::handle(std::auto_ptr<protocol::ClientMessage> message) {
+                        delegate->handle(message);
+                    }
+                }
+            }
+        }
+    }
+}
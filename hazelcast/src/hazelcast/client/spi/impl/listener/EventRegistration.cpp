@@ -17,6 +17,7 @@
 // Created by ihsan demir on 12/11/15.
 
 #include "hazelcast/client/spi/impl/listener/EventRegistration.h"
+#include "hazelcast/client/spi/impl/listener/SmartListenerRegistration.h"
 #include "hazelcast/client/protocol/codec/IAddListenerCodec.h"
 
 namespace hazelcast {
@@ -29,6 +30,11 @@ namespace hazelcast {
                             : correlationId(callId), memberAddress(member), addCodec(addCodec) {
                     }
 
+                    EventRegistration::EventRegistration(
+                            boost::shared_ptr<SmartListenerRegistration> smartRegistration)
+                            : correlationId(-1), smartRegistration(smartRegistration) {
+                    }
+
                     int64_t EventRegistration::getCorrelationId() const {
                         return correlationId;
                     }
@@ -44,6 +50,10 @@ namespace hazelcast {
                     void EventRegistration::setCorrelationId(int64_t callId) {
                         correlationId = callId;
                     }
+
+                    const boost::shared_ptr<SmartListenerRegistration> &EventRegistration::getSmartRegistration() const {
+                        return smartRegistration;
+                    }
                 }
             }
         }
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hazelcast/client/spi/impl/listener/SmartListenerRegistration.h"
+#include "hazelcast/client/protocol/codec/IAddListenerCodec.h"
+#include "hazelcast/client/impl/BaseEventHandler.h"
+#include "hazelcast/util/LockGuard.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace spi {
+            namespace impl {
+                namespace listener {
+                    SmartListenerRegistration::SmartListenerRegistration(
+                            std::auto_ptr<protocol::codec::IAddListenerCodec> addCodec,
+                            boost::shared_ptr<client::impl::BaseEventHandler> handler)
+                            : addCodec(addCodec), handler(handler), closed(false), inFlightRegistrations(0) {
+                    }
+
+                    const protocol::codec::IAddListenerCodec &SmartListenerRegistration::getAddCodec() const {
+                        return *addCodec;
+                    }
+
+                    boost::shared_ptr<client::impl::BaseEventHandler> SmartListenerRegistration::getHandler() const {
+                        return handler;
+                    }
+
+                    bool SmartListenerRegistration::isRegisteredOn(const Address &member) const {
+                        util::LockGuard guard(lock);
+                        return memberRegistrations.count(member) > 0;
+                    }
+
+                    bool SmartListenerRegistration::beginMemberRegistration() {
+                        util::LockGuard guard(lock);
+                        if (closed) {
+                            return false;
+                        }
+                        ++inFlightRegistrations;
+                        return true;
+                    }
+
+                    void SmartListenerRegistration::endMemberRegistration() {
+                        util::LockGuard guard(lock);
+                        if (--inFlightRegistrations == 0) {
+                            registrationsDone.notify_all();
+                        }
+                    }
+
+                    void SmartListenerRegistration::addMemberRegistration(const Address &member,
+                                                                          const std::string &registrationId,
+                                                                          int64_t correlationId) {
+                        MemberRegistration registration;
+                        registration.registrationId = registrationId;
+                        registration.correlationId = correlationId;
+
+                        util::LockGuard guard(lock);
+                        memberRegistrations[member] = registration;
+                    }
+
+                    bool SmartListenerRegistration::removeMemberRegistration(int64_t correlationId) {
+                        util::LockGuard guard(lock);
+                        for (MemberRegistrationMap::iterator it = memberRegistrations.begin();
+                             it != memberRegistrations.end(); ++it) {
+                            if (it->second.correlationId == correlationId) {
+                                memberRegistrations.erase(it);
+                                return true;
+                            }
+                        }
+                        return false;
+                    }
+
+                    SmartListenerRegistration::MemberRegistrations SmartListenerRegistration::removeMembersNotIn(
+                            const std::vector<Member> &members) {
+                        MemberRegistrations removed;
+                        util::LockGuard guard(lock);
+                        for (MemberRegistrationMap::iterator it = memberRegistrations.begin();
+                             it != memberRegistrations.end();) {
+                            bool isMember = false;
+                            for (std::vector<Member>::const_iterator member = members.begin();
+                                 member != members.end(); ++member) {
+                                if (member->getAddress() == it->first) {
+                                    isMember = true;
+                                    break;
+                                }
+                            }
+
+                            if (isMember) {
+                                ++it;
+                            } else {
+                                removed.push_back(*it);
+                                memberRegistrations.erase(it++);
+                            }
+                        }
+                        return removed;
+                    }
+
+                    SmartListenerRegistration::MemberRegistrations SmartListenerRegistration::close() {
+                        util::LockGuard guard(lock);
+                        closed = true;
+                        while (inFlightRegistrations > 0) {
+                            registrationsDone.wait(lock);
+                        }
+                        MemberRegistrations removed(memberRegistrations.begin(), memberRegistrations.end());
+                        memberRegistrations.clear();
+                        return removed;
+                    }
+                }
+            }
+        }
+    }
+}
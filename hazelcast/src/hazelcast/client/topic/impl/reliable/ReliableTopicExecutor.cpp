@@ -14,82 +14,105 @@
  * limitations under the License.
  */
 
-#include "hazelcast/client/proxy/RingbufferImpl.h"
-#include "hazelcast/client/exception/FutureWaitTimeout.h"
+#include <limits>
+
 #include "hazelcast/client/topic/impl/reliable/ReliableTopicExecutor.h"
+#include "hazelcast/client/exception/IException.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/ILogger.h"
+#include "hazelcast/util/IOUtil.h"
+#include "hazelcast/util/Util.h"
 
 namespace hazelcast {
     namespace client {
         namespace topic {
             namespace impl {
                 namespace reliable {
-                    ReliableTopicExecutor::ReliableTopicExecutor(Ringbuffer<topic::impl::reliable::ReliableTopicMessage> *rb)
-                    : ringbuffer(rb), q(10), shutdown(false) {
+                    ReliableTopicExecutor::ReliableTopicExecutor(int32_t poolSize)
+                    : poolSize(poolSize > 0 ? poolSize : 1)
+                    , q(std::numeric_limits<size_t>::max())
+                    , live(true) {
                     }
 
                     ReliableTopicExecutor::~ReliableTopicExecutor() {
-                        stop();
+                        shutdown();
+
+                        // the threads which are not joined by a shutdown called from a pool thread
+                        util::LockGuard guard(startLock);
+                        joinThreads();
                     }
 
                     void ReliableTopicExecutor::start() {
-                        if (NULL == runnerThread.get()) {
-                            runnerThread = std::auto_ptr<util::Thread>(new util::Thread(executerRun, &shutdown, &q, ringbuffer));
+                        util::LockGuard guard(startLock);
+                        if (!live || !threads.empty()) {
+                            return;
+                        }
+
+                        for (int32_t i = 0; i < poolSize; ++i) {
+                            std::string threadName = "hz.reliableTopicExecutor-" + util::IOUtil::to_string<int32_t>(i);
+                            threads.push_back(boost::shared_ptr<util::Thread>(
+                                    new util::Thread(threadName, executorRun, this)));
                         }
                     }
 
-                    void ReliableTopicExecutor::stop() {
-                        if (!shutdown.compareAndSet(false, true)) {
+                    void ReliableTopicExecutor::shutdown() {
+                        util::LockGuard guard(startLock);
+                        if (!live.compareAndSet(true, false)) {
                             return;
                         }
 
-                        topic::impl::reliable::ReliableTopicExecutor::Message m;
-                        m.type = topic::impl::reliable::ReliableTopicExecutor::CANCEL;
-                        m.callback = NULL;
-                        m.sequence = -1;
-                        execute(m);
+                        // an empty task stops the thread which takes it
+                        for (size_t i = 0; i < threads.size(); ++i) {
+                            q.push(boost::shared_ptr<Task>());
+                        }
+
+                        joinThreads();
+                    }
+
+                    bool ReliableTopicExecutor::isPoolThread() const {
+                        util::LockGuard guard(poolThreadIdsLock);
+                        return poolThreadIds.count(util::getThreadId()) > 0;
+                    }
 
-                        runnerThread->cancel();
-                        runnerThread->join();
-                        runnerThread.reset();
+                    void ReliableTopicExecutor::joinThreads() {
+                        // a pool thread can not join itself, the threads are joined later by the destructor
+                        if (isPoolThread()) {
+                            return;
+                        }
+
+                        for (std::vector<boost::shared_ptr<util::Thread> >::const_iterator it = threads.begin();
+                             it != threads.end(); ++it) {
+                            (*it)->join();
+                        }
+                        threads.clear();
                     }
 
-                    void ReliableTopicExecutor::execute(const Message &m) {
-                        q.push(m);
+                    bool ReliableTopicExecutor::execute(boost::shared_ptr<Task> task) {
+                        if (!live) {
+                            return false;
+                        }
+                        q.push(task);
+                        return true;
                     }
 
-                    void ReliableTopicExecutor::executerRun(util::ThreadArgs &args) {
-                        util::AtomicBoolean *shutdownFlag = (util::AtomicBoolean *)args.arg0;
-                        util::BlockingConcurrentQueue<Message> *q = (util::BlockingConcurrentQueue<Message> *)args.arg1;
-                        Ringbuffer<topic::impl::reliable::ReliableTopicMessage> * rb = (Ringbuffer<topic::impl::reliable::ReliableTopicMessage> *)args.arg2;
+                    void ReliableTopicExecutor::executorRun(util::ThreadArgs &args) {
+                        ReliableTopicExecutor *executor = (ReliableTopicExecutor *) args.arg0;
+                        {
+                            util::LockGuard guard(executor->poolThreadIdsLock);
+                            executor->poolThreadIds.insert(util::getThreadId());
+                        }
 
-                        while (!(*shutdownFlag)) {
-                            Message m = q->pop();
-                            if (CANCEL == m.type) {
-                                // exit the thread
+                        while (true) {
+                            boost::shared_ptr<Task> task = executor->q.pop();
+                            if (NULL == task.get()) {
                                 return;
                             }
+
                             try {
-                                proxy::RingbufferImpl<topic::impl::reliable::ReliableTopicMessage> *ringbuffer =
-                                        (proxy::RingbufferImpl<topic::impl::reliable::ReliableTopicMessage> *)rb;
-
-                                connection::CallFuture future = ringbuffer->readManyAsync(m.sequence, 1, m.maxCount);
-                                std::auto_ptr<protocol::ClientMessage> responseMsg;
-                                do {
-                                    try {
-                                        responseMsg = future.get(1); // every one second
-                                    } catch (exception::TimeoutException &e) { // suppress timeout exception
-                                        // do nothing
-                                    }
-                                } while (!(*shutdownFlag) && (protocol::ClientMessage *)NULL == responseMsg.get());
-
-                                if (!(*shutdownFlag)) {
-                                    std::auto_ptr<DataArray<ReliableTopicMessage> > allMessages = ringbuffer->getReadManyAsyncResponseObject(
-                                            responseMsg);
-
-                                    m.callback->onResponse(allMessages.get());
-                                }
-                            } catch (exception::ProtocolException &e) {
-                                m.callback->onFailure(&e);
+                                task->run();
+                            } catch (exception::IException &e) {
+                                util::ILogger::getLogger().warning(
+                                        std::string("[ReliableTopicExecutor::executorRun] Task failed. ") + e.what());
                             }
                         }
                     }
@@ -98,4 +121,3 @@ namespace hazelcast {
         }
     }
 }
-
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "hazelcast/client/topic/impl/reliable/ReliableTopicPublisher.h"
+#include "hazelcast/client/topic/impl/reliable/ReliableTopicExecutor.h"
+#include "hazelcast/client/config/ReliableTopicConfig.h"
+#include "hazelcast/client/spi/ClientContext.h"
+#include "hazelcast/client/spi/InvocationService.h"
+#include "hazelcast/client/connection/CallFuture.h"
+#include "hazelcast/client/connection/CallCompletionListener.h"
+#include "hazelcast/client/protocol/ClientMessage.h"
+#include "hazelcast/client/protocol/codec/RingbufferAddAllCodec.h"
+#include "hazelcast/client/ringbuffer/OverflowPolicy.h"
+#include "hazelcast/client/exception/ProtocolExceptions.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/Util.h"
+#include "hazelcast/util/IOUtil.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace topic {
+            namespace impl {
+                namespace reliable {
+                    class ReliableTopicPublisher::StoreTask : public ReliableTopicExecutor::Task {
+                    public:
+                        StoreTask(const boost::shared_ptr<ReliableTopicPublisher> &publisher,
+                                  const connection::CallFuture &future)
+                        : publisher(publisher)
+                        , future(future) {
+                        }
+
+                        virtual void run() {
+                            publisher->onStored(future);
+                        }
+
+                    private:
+                        boost::shared_ptr<ReliableTopicPublisher> publisher;
+                        connection::CallFuture future;
+                    };
+
+                    class ReliableTopicPublisher::StoreCompletion : public connection::CallCompletionListener {
+                    public:
+                        StoreCompletion(const boost::shared_ptr<ReliableTopicPublisher> &publisher,
+                                        const connection::CallFuture &future)
+                        : publisher(publisher)
+                        , future(future) {
+                        }
+
+                        virtual void onComplete() {
+                            // the response is handled on the executor, since this is usually the io thread
+                            if (!publisher->executor.execute(boost::shared_ptr<ReliableTopicExecutor::Task>(
+                                    new StoreTask(publisher, future)))) {
+                                publisher->failAll();
+                            }
+                        }
+
+                    private:
+                        boost::shared_ptr<ReliableTopicPublisher> publisher;
+                        connection::CallFuture future;
+                    };
+
+                    const size_t ReliableTopicPublisher::MAX_PENDING_BATCHES = 16;
+                    const int64_t ReliableTopicPublisher::INITIAL_BACKOFF_MILLIS = 100;
+                    const int64_t ReliableTopicPublisher::MAX_BACKOFF_MILLIS = 2000;
+
+                    ReliableTopicPublisher::Batch::Batch()
+                    : creationTime(util::currentTimeMillis())
+                    , urgent(false)
+                    , backoffMillis(INITIAL_BACKOFF_MILLIS)
+                    , retryTime(0)
+                    , result(new util::Future<bool>()) {
+                    }
+
+                    boost::shared_ptr<ReliableTopicPublisher> ReliableTopicPublisher::create(
+                            const std::string &topicName, const std::string &ringbufferName, int partitionId,
+                            spi::ClientContext &context, const config::ReliableTopicConfig &config) {
+                        boost::shared_ptr<ReliableTopicPublisher> publisher(
+                                new ReliableTopicPublisher(topicName, ringbufferName, partitionId, context, config));
+                        publisher->self = publisher;
+                        return publisher;
+                    }
+
+                    ReliableTopicPublisher::ReliableTopicPublisher(const std::string &topicName,
+                                                                   const std::string &ringbufferName,
+                                                                   int partitionId, spi::ClientContext &context,
+                                                                   const config::ReliableTopicConfig &config)
+                    : topicName(topicName)
+                    , ringbufferName(ringbufferName)
+                    , partitionId(partitionId)
+                    , context(context)
+                    , executor(context.getReliableTopicExecutor())
+                    , flusher(context.getBatchEventFlusher())
+                    , overloadPolicy(config.getTopicOverloadPolicy())
+                    , overflowPolicy(DISCARD_OLDEST == overloadPolicy ? ringbuffer::OVERWRITE : ringbuffer::FAIL)
+                    , batchSize((size_t) config.getPublishBatchSize())
+                    , lingerMillis(config.getPublishLingerMillis())
+                    , retryScheduled(false)
+                    , live(true) {
+                        executor.start();
+                    }
+
+                    ReliableTopicPublisher::~ReliableTopicPublisher() {
+                    }
+
+                    boost::shared_ptr<util::Future<bool> > ReliableTopicPublisher::publish(
+                            const serialization::pimpl::Data &message, bool flushNow) {
+                        // a listener must not wait for the executor thread it is running on
+                        bool mayBlock = !executor.isPoolThread();
+                        boost::shared_ptr<util::Future<bool> > result;
+                        boost::shared_ptr<Batch> readyBatch;
+                        {
+                            util::LockGuard guard(lock);
+                            while (live && mayBlock && pendingBatches.size() >= MAX_PENDING_BATCHES &&
+                                   pendingBatches.back()->messages.size() >= batchSize) {
+                                notFull.wait(lock);
+                            }
+
+                            if (!live) {
+                                throw exception::IllegalStateException("ReliableTopicPublisher::publish",
+                                                                       "The publisher of topic " + topicName +
+                                                                       " is shut down");
+                            }
+
+                            if (pendingBatches.empty() || pendingBatches.back()->messages.size() >= batchSize) {
+                                boost::shared_ptr<Batch> batch(new Batch());
+                                batch->messages.reserve(batchSize);
+                                pendingBatches.push_back(batch);
+                            }
+
+                            Batch &batch = *pendingBatches.back();
+                            batch.messages.push_back(message);
+                            batch.urgent = batch.urgent || flushNow;
+                            result = batch.result;
+
+                            if (NULL == currentBatch.get()) {
+                                readyBatch = takeReadyBatch();
+                            }
+                        }
+
+                        if (NULL != readyBatch.get()) {
+                            send(readyBatch);
+                        }
+                        return result;
+                    }
+
+                    void ReliableTopicPublisher::shutdown() {
+                        failAll();
+                        flusher.cancel(*this);
+                    }
+
+                    void ReliableTopicPublisher::flush() {
+                        boost::shared_ptr<Batch> readyBatch;
+                        {
+                            util::LockGuard guard(lock);
+                            if (!live) {
+                                return;
+                            }
+
+                            if (retryScheduled) {
+                                // an earlier linger deadline may have fired before the backoff passed
+                                if (util::currentTimeMillis() < currentBatch->retryTime) {
+                                    flusher.schedule(*this, currentBatch->retryTime);
+                                    return;
+                                }
+                                retryScheduled = false;
+                                readyBatch = currentBatch;
+                            } else if (NULL == currentBatch.get()) {
+                                readyBatch = takeReadyBatch();
+                            }
+                        }
+
+                        if (NULL != readyBatch.get()) {
+                            send(readyBatch);
+                        }
+                    }
+
+                    boost::shared_ptr<ReliableTopicPublisher::Batch> ReliableTopicPublisher::takeReadyBatch() {
+                        if (pendingBatches.empty()) {
+                            return boost::shared_ptr<Batch>();
+                        }
+
+                        boost::shared_ptr<Batch> batch = pendingBatches.front();
+                        if (batch->urgent || pendingBatches.size() > 1 || batch->messages.size() >= batchSize ||
+                            util::currentTimeMillis() - batch->creationTime >= lingerMillis) {
+                            pendingBatches.pop_front();
+                            currentBatch = batch;
+                            notFull.notify_all();
+                            return batch;
+                        }
+
+                        flusher.schedule(*this, batch->creationTime + lingerMillis);
+                        return boost::shared_ptr<Batch>();
+                    }
+
+                    void ReliableTopicPublisher::send(boost::shared_ptr<Batch> batch) {
+                        boost::shared_ptr<ReliableTopicPublisher> publisher;
+                        {
+                            util::LockGuard guard(lock);
+                            publisher = self;
+                        }
+
+                        while (NULL != publisher.get() && NULL != batch.get()) {
+                            try {
+                                std::auto_ptr<protocol::ClientMessage> request =
+                                        protocol::codec::RingbufferAddAllCodec::RequestParameters::encode(
+                                                ringbufferName, batch->messages, overflowPolicy);
+                                connection::CallFuture future = context.getInvocationService().invokeOnPartitionOwner(
+                                        request, partitionId);
+                                future.setCompletionListener(boost::shared_ptr<connection::CallCompletionListener>(
+                                        new StoreCompletion(publisher, future)));
+                                return;
+                            } catch (exception::IException &e) {
+                                util::LockGuard guard(lock);
+                                if (currentBatch != batch) {
+                                    // failed by shutdown in the meantime
+                                    return;
+                                }
+                                batch = complete(batch, false, e.clone());
+                            }
+                        }
+                    }
+
+                    void ReliableTopicPublisher::onStored(connection::CallFuture &future) {
+                        bool stored = false;
+                        std::auto_ptr<exception::IException> error;
+                        try {
+                            std::auto_ptr<protocol::ClientMessage> response = future.get();
+                            stored = -1 != protocol::codec::RingbufferAddAllCodec::ResponseParameters::decode(
+                                    *response).response;
+                        } catch (exception::IException &e) {
+                            error = e.clone();
+                        }
+
+                        boost::shared_ptr<Batch> nextBatch;
+                        {
+                            util::LockGuard guard(lock);
+                            boost::shared_ptr<Batch> batch = currentBatch;
+                            if (NULL == batch.get()) {
+                                // failed by shutdown in the meantime
+                                return;
+                            }
+
+                            if (NULL == error.get() && !stored) {
+                                if (FAIL == overloadPolicy) {
+                                    error.reset(new exception::TopicOverloadException(
+                                            "ReliableTopicPublisher::onStored",
+                                            "Failed to publish " + util::IOUtil::to_string(batch->messages.size()) +
+                                            " messages on topic:" + topicName));
+                                } else if (BLOCK == overloadPolicy) {
+                                    batch->retryTime = util::currentTimeMillis() + batch->backoffMillis;
+                                    batch->backoffMillis = std::min<int64_t>(2 * batch->backoffMillis,
+                                                                             MAX_BACKOFF_MILLIS);
+                                    retryScheduled = true;
+                                    flusher.schedule(*this, batch->retryTime);
+                                    return;
+                                }
+                            }
+
+                            nextBatch = complete(batch, stored, error);
+                        }
+
+                        send(nextBatch);
+                    }
+
+                    boost::shared_ptr<ReliableTopicPublisher::Batch> ReliableTopicPublisher::complete(
+                            const boost::shared_ptr<Batch> &batch, bool stored,
+                            std::auto_ptr<exception::IException> error) {
+                        currentBatch.reset();
+                        if (NULL != error.get()) {
+                            batch->result->set_exception(error);
+                        } else {
+                            batch->result->set_value(stored);
+                        }
+
+                        if (!live) {
+                            return boost::shared_ptr<Batch>();
+                        }
+                        return takeReadyBatch();
+                    }
+
+                    void ReliableTopicPublisher::failAll() {
+                        std::deque<boost::shared_ptr<Batch> > batches;
+                        boost::shared_ptr<ReliableTopicPublisher> publisher;
+                        {
+                            util::LockGuard guard(lock);
+                            if (!live) {
+                                return;
+                            }
+                            live = false;
+                            // released when the method returns, after the last use of the members
+                            publisher.swap(self);
+                            batches.swap(pendingBatches);
+                            if (NULL != currentBatch.get()) {
+                                batches.push_front(currentBatch);
+                                currentBatch.reset();
+                            }
+                            retryScheduled = false;
+                            notFull.notify_all();
+                        }
+
+                        for (std::deque<boost::shared_ptr<Batch> >::const_iterator it = batches.begin();
+                             it != batches.end(); ++it) {
+                            (*it)->result->set_exception(std::auto_ptr<exception::IException>(
+                                    new exception::IllegalStateException("ReliableTopicPublisher::failAll",
+                                                                         "The publisher of topic " + topicName +
+                                                                         " is shut down")));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
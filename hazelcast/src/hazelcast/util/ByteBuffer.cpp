@@ -39,7 +39,7 @@ namespace hazelcast {
 
 
         ByteBuffer& ByteBuffer::compact() {
-            memcpy(buffer, ix(), (size_t)remaining());
+            memmove(buffer, ix(), (size_t)remaining());
             pos = remaining();
             lim = capacity;
             return *this;
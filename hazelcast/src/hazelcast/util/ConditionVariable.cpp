@@ -47,6 +47,14 @@ namespace hazelcast {
             return false;
         }
 
+        bool ConditionVariable::waitForMillis(Mutex &mutex, int64_t timeInMillis) {
+            BOOL interrupted = SleepConditionVariableCS(&condition,  &(mutex.mutex), (DWORD)timeInMillis);
+            if(interrupted){
+                return true;
+            }
+            return false;
+        }
+
         void ConditionVariable::notify() {
             WakeConditionVariable(&condition);
         }
@@ -105,6 +113,27 @@ namespace hazelcast {
             return true;
         }
 
+        bool ConditionVariable::waitForMillis(Mutex& mutex, int64_t timeInMillis) {
+            struct timeval tv;
+            ::gettimeofday(&tv, NULL);
+
+            int64_t nanos = (int64_t) tv.tv_usec * 1000 + (timeInMillis % 1000) * 1000000;
+            struct timespec ts;
+            ts.tv_sec = tv.tv_sec + (time_t) (timeInMillis / 1000) + (time_t) (nanos / 1000000000);
+            ts.tv_nsec = (long) (nanos % 1000000000);
+
+            int error = pthread_cond_timedwait(&condition, &(mutex.mutex), &ts);
+            (void)error;
+            assert(EPERM != error);
+            assert(EINVAL != error);
+
+            if (ETIMEDOUT == error) {
+                return false;
+            }
+
+            return true;
+        }
+
         void ConditionVariable::wait(Mutex& mutex) {
             int error = pthread_cond_wait(&condition, &(mutex.mutex));
             (void)error;
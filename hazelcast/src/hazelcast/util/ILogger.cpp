@@ -21,6 +21,9 @@
 #include "hazelcast/util/ILogger.h"
 #include "hazelcast/util/Util.h"
 #include "hazelcast/util/LockGuard.h"
+#include "hazelcast/util/Thread.h"
+#include "hazelcast/util/ThreadArgs.h"
+#include "hazelcast/client/LogSink.h"
 
 #include <stdio.h>
 #include <iostream>
@@ -37,10 +40,20 @@ namespace hazelcast {
             return singleton;
         }
 
-        ILogger::ILogger() : HazelcastLogLevel(client::INFO) {
+        ILogger::ILogger() : HazelcastLogLevel(client::INFO), sink(NULL), async(true), bufferHead(0), bufferCount(0),
+                             droppedCount(0), writing(false), live(true) {
         }
 
         ILogger::~ILogger() {
+            {
+                util::LockGuard guard(bufferMutex);
+                live = false;
+                bufferCondition.notify_all();
+            }
+            if (writer.get() != NULL) {
+                writer->join();
+                writer.reset();
+            }
         }
 
         void ILogger::setLogLevel(int logLevel) {
@@ -49,42 +62,60 @@ namespace hazelcast {
 
         void ILogger::severe(const std::string& message) {
             if (isEnabled(client::SEVERE)) {
-                char buffer [TIME_STRING_LENGTH];
-                util::LockGuard l(lockMutex);
-                // Due to the problem faced in Linux environment which is described
-                // in https://gcc.gnu.org/ml/gcc/2003-12/msg00743.html, we could not use
-                // std::cout here. outstream flush() function in stdlib 3.4.4 does not handle pthread_cancel call
-                // appropriately.
-                printf("%s SEVERE: %s [%ld] %s\n", getTime(buffer, TIME_STRING_LENGTH), prefix.c_str(), util::getThreadId(), message.c_str());
-                fflush(stdout);
+                client::LogRecord record(client::SEVERE, message);
+                log(record);
             }
         }
 
         void ILogger::warning(const std::string& message) {
             if (isEnabled(client::WARNING)) {
-                char buffer [TIME_STRING_LENGTH];
-                util::LockGuard l(lockMutex);
-                printf("%s WARNING: %s [%ld] %s\n", getTime(buffer, TIME_STRING_LENGTH), prefix.c_str(), util::getThreadId(), message.c_str());
-                fflush(stdout);
+                client::LogRecord record(client::WARNING, message);
+                log(record);
             }
         }
 
         void ILogger::info(const std::string& message) {
             if (isEnabled(client::INFO)) {
-                char buffer [TIME_STRING_LENGTH];
-                util::LockGuard l(lockMutex);
-                printf("%s INFO: %s [%ld] %s\n", getTime(buffer, TIME_STRING_LENGTH), prefix.c_str(), util::getThreadId(), message.c_str());
-                fflush(stdout);
+                client::LogRecord record(client::INFO, message);
+                log(record);
             }
         }
 
 
         void ILogger::finest(const std::string& message) {
             if (isEnabled(client::FINEST)) {
-                char buffer [TIME_STRING_LENGTH];
-                util::LockGuard l(lockMutex);
-                printf("%s FINEST: %s [%ld] %s\n", getTime(buffer, TIME_STRING_LENGTH), prefix.c_str(), util::getThreadId(), message.c_str());
-                fflush(stdout);
+                client::LogRecord record(client::FINEST, message);
+                log(record);
+            }
+        }
+
+        void ILogger::log(client::LogRecord &record) {
+            if (!isEnabled(record.level)) {
+                return;
+            }
+            record.timeMillis = util::currentTimeMillis();
+            record.threadId = util::getThreadId();
+
+            if (!async) {
+                util::LockGuard guard(sinkMutex);
+                writeToSink(record);
+                flushSink();
+                return;
+            }
+
+            util::LockGuard guard(bufferMutex);
+            if (!live) {
+                return;
+            }
+            ensureWriterStarted();
+            if (bufferCount == BUFFER_CAPACITY) {
+                // the logging thread shall never wait for the output
+                ++droppedCount;
+                return;
+            }
+            buffer[(bufferHead + bufferCount) % BUFFER_CAPACITY].swap(record);
+            if (++bufferCount == 1) {
+                bufferCondition.notify();
             }
         }
 
@@ -96,11 +127,143 @@ namespace hazelcast {
             return logLevel >= HazelcastLogLevel;
         }
 
-        const char *ILogger::getTime(char *buffer, size_t length) const {
-            time_t rawtime;
+        void ILogger::setSink(client::LogSink *sink) {
+            // the buffered records are written to the previous sink, which is never used after the swap
+            flush();
+            util::LockGuard guard(sinkMutex);
+            this->sink = sink;
+        }
+
+        void ILogger::setAsync(bool async) {
+            this->async = async;
+        }
+
+        void ILogger::flush() {
+            {
+                util::LockGuard guard(bufferMutex);
+                while (writer.get() != NULL && live && (bufferCount > 0 || writing)) {
+                    drainedCondition.waitForMillis(bufferMutex, 100);
+                }
+            }
+            util::LockGuard guard(sinkMutex);
+            flushSink();
+        }
+
+        void ILogger::staticWrite(util::ThreadArgs& args) {
+            ILogger *logger = (ILogger *) args.arg0;
+            logger->writeLoop();
+        }
+
+        void ILogger::ensureWriterStarted() {
+            if (writer.get() == NULL) {
+                buffer.resize(BUFFER_CAPACITY);
+                writer.reset(new util::Thread("hz.logWriter", staticWrite, this));
+            }
+        }
+
+        void ILogger::writeLoop() {
+            std::vector<client::LogRecord> batch;
+            while (true) {
+                int64_t dropped;
+                {
+                    util::LockGuard guard(bufferMutex);
+                    while (live && bufferCount == 0) {
+                        bufferCondition.waitForMillis(bufferMutex, 1000);
+                    }
+                    if (bufferCount == 0) {
+                        drainedCondition.notify_all();
+                        return;
+                    }
+                    batch.resize(bufferCount);
+                    for (size_t i = 0; i < bufferCount; ++i) {
+                        batch[i].swap(buffer[(bufferHead + i) % BUFFER_CAPACITY]);
+                    }
+                    bufferHead = (bufferHead + bufferCount) % BUFFER_CAPACITY;
+                    bufferCount = 0;
+                    dropped = droppedCount;
+                    droppedCount = 0;
+                    writing = true;
+                }
+
+                {
+                    util::LockGuard guard(sinkMutex);
+                    for (std::vector<client::LogRecord>::iterator it = batch.begin(); it != batch.end(); ++it) {
+                        writeToSink(*it);
+                    }
+                    if (dropped > 0) {
+                        client::LogRecord record(client::WARNING,
+                                                 "[ILogger] Log records are dropped since the log buffer is full");
+                        record.addField("dropped", dropped);
+                        record.timeMillis = util::currentTimeMillis();
+                        record.threadId = util::getThreadId();
+                        writeToSink(record);
+                    }
+                    // a single flush per batch instead of one per record
+                    flushSink();
+                }
+
+                util::LockGuard guard(bufferMutex);
+                writing = false;
+                if (bufferCount == 0) {
+                    drainedCondition.notify_all();
+                }
+            }
+        }
+
+        void ILogger::writeToSink(client::LogRecord &record) {
+            record.prefix = prefix;
+            if (NULL != sink) {
+                sink->write(record);
+            } else {
+                writeToStdout(record);
+            }
+        }
+
+        void ILogger::writeToStdout(const client::LogRecord &record) {
+            const char *levelName;
+            switch (record.getLevel()) {
+                case client::SEVERE:
+                    levelName = "SEVERE";
+                    break;
+                case client::WARNING:
+                    levelName = "WARNING";
+                    break;
+                case client::INFO:
+                    levelName = "INFO";
+                    break;
+                case client::FINEST:
+                    levelName = "FINEST";
+                    break;
+                default:
+                    levelName = "LOG";
+            }
+
+            char buffer [TIME_STRING_LENGTH];
+            // Due to the problem faced in Linux environment which is described
+            // in https://gcc.gnu.org/ml/gcc/2003-12/msg00743.html, we could not use
+            // std::cout here. outstream flush() function in stdlib 3.4.4 does not handle pthread_cancel call
+            // appropriately.
+            printf("%s %s: %s [%ld] %s", getTime(buffer, TIME_STRING_LENGTH, record.getTimeMillis()), levelName,
+                   record.getPrefix().c_str(), record.getThreadId(), record.getMessage().c_str());
+            const client::LogRecord::Fields &fields = record.getFields();
+            for (client::LogRecord::Fields::const_iterator it = fields.begin(); it != fields.end(); ++it) {
+                printf(" %s=%s", it->first.c_str(), it->second.c_str());
+            }
+            printf("\n");
+        }
+
+        void ILogger::flushSink() {
+            if (NULL != sink) {
+                sink->flush();
+            } else {
+                fflush(stdout);
+            }
+        }
+
+        const char *ILogger::getTime(char *buffer, size_t length, int64_t timeMillis) const {
+            time_t rawtime = (time_t) (timeMillis / 1000);
             struct tm timeinfo;
 
-            time (&rawtime);
             int timeResult = hazelcast::util::localtime (&rawtime, &timeinfo);
             assert(0 == timeResult);
 
@@ -110,7 +273,6 @@ namespace hazelcast {
                 }
             }
 
-            // TODO: Change to thread specific stored buffer
             return buffer;
         }
 
@@ -27,9 +27,11 @@ namespace hazelcast {
                 try {
                     closable->close();
                 } catch (client::exception::IException& e) {
-                    std::stringstream message;
-                    message << "closeResource failed" << e.what();
-                    ILogger::getLogger().finest(message.str());
+                    if (ILogger::getLogger().isFinestEnabled()) {
+                        std::stringstream message;
+                        message << "closeResource failed" << e.what();
+                        ILogger::getLogger().finest(message.str());
+                    }
                 }
 
             }
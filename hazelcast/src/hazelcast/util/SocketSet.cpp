@@ -65,7 +65,7 @@ namespace hazelcast {
                 }
             }
 
-            if (!found) {
+            if (!found && util::ILogger::getLogger().isFinestEnabled()) {
                 char msg[200];
                 util::snprintf(msg, 200,
                                "[SocketSet::removeSocket] Socket with id %d  was not found among the sockets.",
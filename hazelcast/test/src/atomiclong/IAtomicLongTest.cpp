@@ -24,6 +24,9 @@
 #include "IAtomicLongTest.h"
 #include "HazelcastServerFactory.h"
 #include "hazelcast/client/HazelcastClient.h"
+#include "hazelcast/client/exception/IllegalStateException.h"
+#include "hazelcast/util/Thread.h"
+#include "TestHelperFunctions.h"
 
 namespace hazelcast {
     namespace client {
@@ -55,6 +58,52 @@ namespace hazelcast {
                 ASSERT_EQ(10, atom->incrementAndGet());
             }
 
+            static void incrementAccumulator(util::ThreadArgs &args) {
+                AtomicLongAccumulator *accumulator = (AtomicLongAccumulator *) args.arg0;
+                for (int i = 0; i < 1000; ++i) {
+                    accumulator->increment();
+                }
+            }
+
+            TEST_F(IAtomicLongTest, testAccumulator) {
+                std::auto_ptr<AtomicLongAccumulator> accumulator = atom->newAccumulator(
+                        config::AtomicLongAccumulatorConfig().setFlushIntervalMillis(60000));
+
+                util::Thread thread1(incrementAccumulator, accumulator.get());
+                util::Thread thread2(incrementAccumulator, accumulator.get());
+                util::Thread thread3(incrementAccumulator, accumulator.get());
+                thread1.join();
+                thread2.join();
+                thread3.join();
+                accumulator->add(-1000);
+
+                // nothing is flushed before the interval passes
+                ASSERT_EQ(2000, accumulator->get());
+                ASSERT_EQ(2000, accumulator->getPendingDelta());
+                ASSERT_EQ(0, atom->get());
+
+                ASSERT_EQ(2000, accumulator->flush());
+                ASSERT_EQ(0, accumulator->getPendingDelta());
+                ASSERT_EQ(2000, atom->get());
+
+                accumulator->add(5);
+                accumulator->close();
+                ASSERT_EQ(2005, atom->get());
+                ASSERT_THROW(accumulator->increment(), exception::IllegalStateException);
+
+                std::auto_ptr<AtomicLongAccumulator> thresholdAccumulator = atom->newAccumulator(
+                        config::AtomicLongAccumulatorConfig().setFlushIntervalMillis(60000).setFlushThreshold(
+                                10).setStripeCount(1));
+                for (int i = 0; i < 10; ++i) {
+                    thresholdAccumulator->increment();
+                }
+                ASSERT_EQ_EVENTUALLY(2015, atom->get());
+                ASSERT_EQ(2015, thresholdAccumulator->get());
+
+                ASSERT_THROW(config::AtomicLongAccumulatorConfig().setStripeCount(0),
+                             exception::IllegalArgumentException);
+            }
+
         }
     }
 }
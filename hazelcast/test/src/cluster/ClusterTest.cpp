@@ -26,7 +26,12 @@
 #include "hazelcast/client/EntryAdapter.h"
 #include "hazelcast/client/HazelcastClient.h"
 #include "HazelcastServer.h"
+#include "HazelcastServerFactory.h"
 #include "hazelcast/client/LifecycleListener.h"
+#include "hazelcast/client/impl/LoadAwareLB.h"
+#include "hazelcast/client/connection/Connection.h"
+#include "hazelcast/util/ServerSocket.h"
+#include "hazelcast/util/Util.h"
 
 namespace hazelcast {
     namespace client {
@@ -224,10 +229,109 @@ namespace hazelcast {
                 ASSERT_TRUE(hazelcastClient.removeLifecycleListener(&lifecycleListener));
             }
 
+            TEST_F(ClusterTest, testLoadAwareLoadBalancer) {
+                HazelcastServer instance(*g_srvFactory);
+                HazelcastServer instance2(*g_srvFactory);
+
+                impl::LoadAwareLB loadBalancer;
+                std::auto_ptr<ClientConfig> clientConfig(getConfig());
+                clientConfig->setLoadBalancer(&loadBalancer);
+                HazelcastClient hazelcastClient(*clientConfig);
+
+                // the keys are spread over the partitions of both members, so the client connects to both
+                IMap<int, int> map = hazelcastClient.getMap<int, int>("testLoadAwareLoadBalancer");
+                for (int i = 0; i < 100; ++i) {
+                    map.put(i, i);
+                }
+
+                std::vector<Member> members = hazelcastClient.getCluster().getMembers();
+                ASSERT_EQ(2U, members.size());
+                boost::shared_ptr<connection::Connection> busyConnection =
+                        hazelcastClient.getCluster().getConnection(members[1].getAddress());
+                ASSERT_NE((connection::Connection *) NULL, busyConnection.get());
+                ASSERT_NE((connection::Connection *) NULL,
+                          hazelcastClient.getCluster().getConnection(members[0].getAddress()).get());
+
+                // the moving average of the second member's response times is raised far above the first one's
+                for (int i = 0; i < 100; ++i) {
+                    busyConnection->recordResponseTime(10000);
+                }
+
+                // both members are picked with two members, the idle one has the lower cost
+                for (int i = 0; i < 100; ++i) {
+                    ASSERT_EQ(members[0], loadBalancer.next());
+                }
+            }
+
+            TEST_F(ClusterTest, testStripedConnections) {
+                HazelcastServer instance(*g_srvFactory);
+                HazelcastServer instance2(*g_srvFactory);
+
+                std::auto_ptr<ClientConfig> clientConfig(getConfig());
+                clientConfig->setProperty(ClientProperties::PROP_CONNECTIONS_PER_MEMBER, "3");
+                clientConfig->setProperty(ClientProperties::PROP_IO_THREAD_COUNT, "2");
+                HazelcastClient hazelcastClient(*clientConfig);
+
+                util::CountDownLatch addLatch(100);
+                DummyListenerClusterTest listener(addLatch);
+                IMap<std::string, std::string> map = hazelcastClient.getMap<std::string, std::string>(
+                        "testStripedConnections");
+                map.addEntryListener(listener, false);
+
+                for (int i = 0; i < 100; ++i) {
+                    std::string key = util::IOUtil::to_string(i);
+                    map.put(key, key);
+                }
+                ASSERT_TRUE(addLatch.await(10));
+                for (int i = 0; i < 100; ++i) {
+                    std::string key = util::IOUtil::to_string(i);
+                    boost::shared_ptr<std::string> value = map.get(key);
+                    ASSERT_NE((std::string *) NULL, value.get());
+                    ASSERT_EQ(key, *value);
+                }
+
+                // a stripe is connected only when a call is sent through it, hence three connections per member
+                // show that the calls are spread over all the stripes
+                std::vector<Member> members = hazelcastClient.getCluster().getMembers();
+                ASSERT_EQ(2U, members.size());
+                size_t connectionCount = 0;
+                for (std::vector<Member>::const_iterator it = members.begin(); it != members.end(); ++it) {
+                    std::vector<boost::shared_ptr<connection::Connection> > connections =
+                            hazelcastClient.getCluster().getConnections(it->getAddress());
+                    ASSERT_EQ(3U, connections.size());
+                    connectionCount += connections.size();
+                }
+                ASSERT_EQ(6U, connectionCount);
+            }
+
             TEST_F(ClusterTest, testBehaviourWhenClusterNotFound) {
                 ClientConfig clientConfig;
                 ASSERT_THROW(HazelcastClient client(clientConfig), exception::IllegalStateException);
             }
+
+            TEST_F(ClusterTest, testReachableAddressWinsTheConnectionRace) {
+                HazelcastServer instance(*g_srvFactory);
+
+                int closedPort;
+                {
+                    util::ServerSocket serverSocket(0);
+                    closedPort = serverSocket.getPort();
+                }
+
+                ClientConfig clientConfig;
+                // an address which refuses the connection, a non routable one and the member
+                clientConfig.addAddress(Address("127.0.0.1", closedPort));
+                clientConfig.addAddress(Address("10.255.255.1", 5701));
+                clientConfig.addAddress(Address(g_srvFactory->getServerAddress(), 5701));
+                clientConfig.setConnectionTimeout(20000);
+                clientConfig.setAttemptPeriod(1000);
+
+                int64_t start = util::currentTimeMillis();
+                HazelcastClient client(clientConfig);
+                // the connects race, the non routable address does not cost the connection timeout
+                ASSERT_LT(util::currentTimeMillis() - start, 20000);
+                ASSERT_EQ(1U, client.getCluster().getMembers().size());
+            }
         }
     }
 }
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+#include <string.h>
+#include <gtest/gtest.h>
+
+#include "hazelcast/client/connection/FrameReader.h"
+#include "hazelcast/client/protocol/ClientMessageBuilder.h"
+#include "hazelcast/client/protocol/ClientMessage.h"
+#include "hazelcast/client/Socket.h"
+#include "hazelcast/util/Bits.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace test {
+            namespace connection {
+                class FrameReaderTest : public ::testing::Test {
+                protected:
+                    /**
+                     * Returns the queued chunks, at most one chunk per receive call.
+                     */
+                    class SocketStub : public Socket {
+                    public:
+                        SocketStub() : Socket(-1), maxRequestedLength(0) {
+                        }
+
+                        virtual int receive(void *buffer, int len, int flag) const {
+                            maxRequestedLength = std::max(maxRequestedLength, len);
+                            if (chunks.empty()) {
+                                return 0;
+                            }
+
+                            std::vector<byte> &chunk = chunks.front();
+                            int numBytes = std::min(len, (int) chunk.size());
+                            memcpy(buffer, &chunk[0], (size_t) numBytes);
+                            chunk.erase(chunk.begin(), chunk.begin() + numBytes);
+                            if (chunk.empty()) {
+                                chunks.pop_front();
+                            }
+                            return numBytes;
+                        }
+
+                        void addChunk(const std::vector<byte> &bytes, size_t start, size_t length) {
+                            chunks.push_back(std::vector<byte>(bytes.begin() + start, bytes.begin() + start + length));
+                        }
+
+                        mutable std::deque<std::vector<byte> > chunks;
+                        mutable int maxRequestedLength;
+                    };
+
+                    class MessageCollector : public protocol::ClientMessageBuilder::MessageConsumer {
+                    public:
+                        virtual ~MessageCollector() {
+                            for (std::vector<protocol::ClientMessage *>::iterator it = messages.begin();
+                                 it != messages.end(); ++it) {
+                                delete *it;
+                            }
+                        }
+
+                        virtual void onMessage(std::auto_ptr<protocol::ClientMessage> message) {
+                            messages.push_back(message.release());
+                        }
+
+                        std::vector<protocol::ClientMessage *> messages;
+                    };
+
+                    /**
+                     * Appends a frame with numValues int32 payload values 0, 1, ... to the bytes.
+                     */
+                    static void appendFrame(std::vector<byte> &bytes, int64_t correlationId, int32_t numValues) {
+                        int32_t frameLen = protocol::ClientMessage::HEADER_SIZE + numValues * 4;
+                        std::vector<byte> frame((size_t) frameLen, 0);
+                        uint16_t dataOffset = protocol::ClientMessage::HEADER_SIZE;
+                        int32_t partitionId = -1;
+                        util::Bits::nativeToLittleEndian4(&frameLen, &frame[
+                                protocol::ClientMessage::FRAME_LENGTH_FIELD_OFFSET]);
+                        frame[protocol::ClientMessage::VERSION_FIELD_OFFSET] = protocol::ClientMessage::VERSION;
+                        frame[protocol::ClientMessage::FLAGS_FIELD_OFFSET] =
+                                protocol::ClientMessage::BEGIN_AND_END_FLAGS;
+                        util::Bits::nativeToLittleEndian8(&correlationId, &frame[
+                                protocol::ClientMessage::CORRELATION_ID_FIELD_OFFSET]);
+                        util::Bits::nativeToLittleEndian4(&partitionId, &frame[
+                                protocol::ClientMessage::PARTITION_ID_FIELD_OFFSET]);
+                        util::Bits::nativeToLittleEndian2(&dataOffset, &frame[
+                                protocol::ClientMessage::DATA_OFFSET_FIELD_OFFSET]);
+                        for (int32_t i = 0; i < numValues; ++i) {
+                            util::Bits::nativeToLittleEndian4(&i, &frame[dataOffset + i * 4]);
+                        }
+                        bytes.insert(bytes.end(), frame.begin(), frame.end());
+                    }
+
+                    static void assertFrame(protocol::ClientMessage &message, int64_t correlationId,
+                                            int32_t numValues) {
+                        ASSERT_EQ(correlationId, message.getCorrelationId());
+                        ASSERT_EQ(numValues * 4, message.getDataSize());
+                        for (int32_t i = 0; i < numValues; ++i) {
+                            ASSERT_EQ(i, message.get<int32_t>());
+                        }
+                    }
+
+                    static void readAll(hazelcast::client::connection::FrameReader &reader, SocketStub &socket) {
+                        while (!socket.chunks.empty()) {
+                            reader.readFrom(socket);
+                        }
+                    }
+                };
+
+                TEST_F(FrameReaderTest, testLargeFrameIsReadDirectlyWhenHeaderIsSplit) {
+                    MessageCollector collector;
+                    protocol::ClientMessageBuilder builder(collector);
+                    hazelcast::client::connection::FrameReader reader(builder, 64);
+
+                    std::vector<byte> bytes;
+                    appendFrame(bytes, 1, 250);
+                    appendFrame(bytes, 2, 3);
+
+                    SocketStub socket;
+                    // the header of the large frame is received in two reads
+                    socket.addChunk(bytes, 0, 10);
+                    socket.addChunk(bytes, 10, 20);
+                    socket.addChunk(bytes, 30, bytes.size() - 30);
+
+                    reader.readFrom(socket);
+                    ASSERT_TRUE(collector.messages.empty());
+                    reader.readFrom(socket);
+                    ASSERT_TRUE(collector.messages.empty());
+                    ASSERT_LE(socket.maxRequestedLength, 64);
+
+                    // the rest of the large frame is requested at once, bypassing the staging buffer
+                    reader.readFrom(socket);
+                    ASSERT_EQ(1U, collector.messages.size());
+                    ASSERT_EQ(protocol::ClientMessage::HEADER_SIZE + 250 * 4 - 30, socket.maxRequestedLength);
+
+                    readAll(reader, socket);
+                    ASSERT_EQ(2U, collector.messages.size());
+                    assertFrame(*collector.messages[0], 1, 250);
+                    assertFrame(*collector.messages[1], 2, 3);
+                    ASSERT_EQ(64U, reader.getBufferSize());
+                }
+
+                TEST_F(FrameReaderTest, testBufferGrowsUpToMaxBufferSize) {
+                    MessageCollector collector;
+                    protocol::ClientMessageBuilder builder(collector);
+                    hazelcast::client::connection::FrameReader reader(builder, 64);
+
+                    const size_t maxBufferSize = hazelcast::client::connection::FrameReader::MAX_BUFFER_SIZE;
+                    // more than twice the maximum buffer size, so that every read fills the buffer
+                    std::vector<byte> bytes;
+                    int32_t numFrames = 0;
+                    while (bytes.size() < 3 * maxBufferSize) {
+                        appendFrame(bytes, numFrames++, 4);
+                    }
+
+                    SocketStub socket;
+                    socket.addChunk(bytes, 0, bytes.size());
+
+                    size_t previousSize = reader.getBufferSize();
+                    while (!socket.chunks.empty()) {
+                        reader.readFrom(socket);
+                        size_t size = reader.getBufferSize();
+                        ASSERT_TRUE(size == previousSize || size == 2 * previousSize);
+                        ASSERT_LE(size, maxBufferSize);
+                        previousSize = size;
+                    }
+
+                    ASSERT_EQ(maxBufferSize, reader.getBufferSize());
+                    ASSERT_EQ((size_t) numFrames, collector.messages.size());
+                    for (int32_t i = 0; i < numFrames; ++i) {
+                        assertFrame(*collector.messages[i], i, 4);
+                    }
+                }
+
+                TEST_F(FrameReaderTest, testBufferShrinksWithPendingBytes) {
+                    MessageCollector collector;
+                    protocol::ClientMessageBuilder builder(collector);
+                    hazelcast::client::connection::FrameReader reader(builder, 64);
+
+                    std::vector<byte> bytes;
+                    appendFrame(bytes, 0, 10); // 62 bytes
+                    appendFrame(bytes, 1, 7); // 50 bytes
+                    appendFrame(bytes, 2, 7); // 50 bytes
+
+                    SocketStub socket;
+                    // fills the buffer, hence it grows to 128 bytes
+                    socket.addChunk(bytes, 0, 64);
+                    reader.readFrom(socket);
+                    ASSERT_EQ(128U, reader.getBufferSize());
+                    ASSERT_EQ(1U, collector.messages.size());
+
+                    // the remaining 48 bytes of the second frame and 16 header bytes of the third frame are received
+                    // one by one, so that the buffer shrinks while the partial header is pending in it
+                    size_t position = 64;
+                    for (int i = 0; i < hazelcast::client::connection::FrameReader::SHRINK_THRESHOLD; ++i) {
+                        ASSERT_EQ(128U, reader.getBufferSize());
+                        socket.addChunk(bytes, position++, 1);
+                        reader.readFrom(socket);
+                    }
+                    ASSERT_EQ(64U, reader.getBufferSize());
+                    ASSERT_EQ(2U, collector.messages.size());
+
+                    socket.addChunk(bytes, position, bytes.size() - position);
+                    readAll(reader, socket);
+
+                    ASSERT_EQ(3U, collector.messages.size());
+                    assertFrame(*collector.messages[0], 0, 10);
+                    assertFrame(*collector.messages[1], 1, 7);
+                    assertFrame(*collector.messages[2], 2, 7);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <gtest/gtest.h>
+
+#include "hazelcast/client/Socket.h"
+#include "hazelcast/client/Address.h"
+#include "hazelcast/util/ServerSocket.h"
+#include "hazelcast/util/Util.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace test {
+            namespace connection {
+                class SocketTest : public ::testing::Test {
+                protected:
+                    static std::string getLocalHost(const util::ServerSocket &serverSocket) {
+                        return serverSocket.isIpv4() ? "127.0.0.1" : "::1";
+                    }
+                };
+
+                TEST_F(SocketTest, testConnectToListeningAddress) {
+                    util::ServerSocket serverSocket(0);
+                    Socket socket(Address(getLocalHost(serverSocket), serverSocket.getPort()));
+                    ASSERT_EQ(0, socket.connect(5000));
+                }
+
+                TEST_F(SocketTest, testConnectToClosedPortFailsBeforeTheTimeout) {
+                    std::string host;
+                    int port;
+                    {
+                        util::ServerSocket serverSocket(0);
+                        host = getLocalHost(serverSocket);
+                        port = serverSocket.getPort();
+                    }
+
+                    Socket socket(Address(host, port));
+                    int64_t start = util::currentTimeMillis();
+                    ASSERT_NE(0, socket.connect(5000));
+                    // a refused connection is reported right away, not when the connection timeout passes
+                    ASSERT_LT(util::currentTimeMillis() - start, 5000);
+                }
+            }
+        }
+    }
+}
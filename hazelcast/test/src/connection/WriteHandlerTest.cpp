@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "hazelcast/client/HazelcastClient.h"
+#include "hazelcast/client/ClientConfig.h"
+#include "hazelcast/client/ClientProperties.h"
+
+#include "../ClientTestSupport.h"
+#include "../HazelcastServer.h"
+#include "../HazelcastServerFactory.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace test {
+            class WriteHandlerTest : public ClientTestSupport {
+            protected:
+                static void SetUpTestCase() {
+                    instance = new HazelcastServer(*g_srvFactory);
+                    clientConfig = new ClientConfig();
+                    clientConfig->addAddress(Address(g_srvFactory->getServerAddress(), 5701));
+                    clientConfig->setProperty(ClientProperties::PROP_MESSAGE_FRAGMENT_SIZE, "1024");
+                    client = new HazelcastClient(*clientConfig);
+                }
+
+                static void TearDownTestCase() {
+                    delete client;
+                    delete clientConfig;
+                    delete instance;
+
+                    client = NULL;
+                    clientConfig = NULL;
+                    instance = NULL;
+                }
+
+                static HazelcastServer *instance;
+                static ClientConfig *clientConfig;
+                static HazelcastClient *client;
+            };
+
+            HazelcastServer *WriteHandlerTest::instance = NULL;
+            ClientConfig *WriteHandlerTest::clientConfig = NULL;
+            HazelcastClient *WriteHandlerTest::client = NULL;
+
+            TEST_F(WriteHandlerTest, testSmallMessageDoesNotOvertakeLargeMessageOfSamePartition) {
+                boost::shared_ptr<Ringbuffer<std::string> > rb = client->getRingbuffer<std::string>(
+                        "fragmentOrderRb");
+
+                // the large message is written in fragments, the small one is queued behind its first fragment
+                std::vector<std::string> largeItems(1, std::string(256 * 1024, 'x'));
+                Future<int64_t> largeFuture = rb->addAllAsync(largeItems, ringbuffer::OVERWRITE);
+                int64_t smallSequence = rb->add("small");
+
+                ASSERT_EQ(0, *largeFuture.get());
+                ASSERT_EQ(1, smallSequence);
+                ASSERT_EQ(largeItems[0], *rb->readOne(0));
+                ASSERT_EQ("small", *rb->readOne(1));
+            }
+
+            TEST_F(WriteHandlerTest, testLargeMessageIsFragmented) {
+                IMap<int, std::string> map = client->getMap<int, std::string>("fragmentedMap");
+                std::string largeValue(100 * 1024, 'y');
+                for (int i = 0; i < 10; ++i) {
+                    map.put(i, largeValue);
+                }
+
+                for (int i = 0; i < 10; ++i) {
+                    boost::shared_ptr<std::string> value = map.get(i);
+                    ASSERT_NE((std::string *) NULL, value.get());
+                    ASSERT_EQ(largeValue, *value);
+                }
+                map.destroy();
+            }
+        }
+    }
+}
@@ -24,6 +24,9 @@
 #include "idgenerator/IdGeneratorTest.h"
 #include "HazelcastServerFactory.h"
 #include "hazelcast/client/HazelcastClient.h"
+#include "hazelcast/util/Thread.h"
+
+#include <set>
 
 namespace hazelcast {
     namespace client {
@@ -43,6 +46,41 @@ namespace hazelcast {
                 }
             }
 
+            static void generateIds(util::ThreadArgs &args) {
+                IdGenerator *idGenerator = (IdGenerator *) args.arg0;
+                std::vector<long> *ids = (std::vector<long> *) args.arg1;
+                for (int i = 0; i < 5000; i++) {
+                    ids->push_back(idGenerator->newId());
+                }
+            }
+
+            TEST_F (IdGeneratorTest, testPrefetchingGenerator) {
+                std::auto_ptr<ClientConfig> config = getConfig();
+                config->setProperty(ClientProperties::PROP_ID_GENERATOR_BLOCK_SIZE, "2500");
+                config->setProperty(ClientProperties::PROP_ID_GENERATOR_PREFETCH_BLOCKS, "2");
+                HazelcastClient prefetchingClient(*config);
+                IdGenerator prefetchingGenerator = prefetchingClient.getIdGenerator("prefetchingIdGenerator");
+                // the generator of the other client shares the counter, its ids shall not collide
+                IdGenerator otherGenerator = client->getIdGenerator("prefetchingIdGenerator");
+
+                std::vector<long> ids[4];
+                util::Thread thread1(generateIds, &prefetchingGenerator, &ids[0]);
+                util::Thread thread2(generateIds, &prefetchingGenerator, &ids[1]);
+                util::Thread thread3(generateIds, &prefetchingGenerator, &ids[2]);
+                util::Thread thread4(generateIds, &otherGenerator, &ids[3]);
+                thread1.join();
+                thread2.join();
+                thread3.join();
+                thread4.join();
+
+                std::set<long> uniqueIds;
+                for (int i = 0; i < 4; i++) {
+                    ASSERT_EQ(5000U, ids[i].size());
+                    uniqueIds.insert(ids[i].begin(), ids[i].end());
+                }
+                ASSERT_EQ(20000U, uniqueIds.size());
+            }
+
         }
     }
 }
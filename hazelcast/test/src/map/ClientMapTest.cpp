@@ -37,12 +37,30 @@
 #include "hazelcast/client/HazelcastClient.h"
 #include "hazelcast/client/EntryAdapter.h"
 #include "hazelcast/client/EntryEvent.h"
+#include "hazelcast/client/BatchEntryListener.h"
+#include "hazelcast/client/MapEvent.h"
+#include "hazelcast/client/map/BulkLoadListener.h"
+#include "hazelcast/client/map/QueryCache.h"
+#include "hazelcast/client/map/impl/KeySnapshot.h"
+#include "hazelcast/client/serialization/pimpl/SerializationService.h"
+#include "hazelcast/client/exception/IllegalStateException.h"
+#include "hazelcast/util/LockGuard.h"
+#include "hazelcast/client/coroutine/Awaitable.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <set>
+#if defined(HZ_USE_COROUTINES)
+#include <chrono>
+#include <condition_variable>
+#endif
 
 #include "HazelcastServerFactory.h"
 #include "serialization/Employee.h"
 #include "TestHelperFunctions.h"
 #include "ClientTestSupport.h"
 #include "hazelcast/client/ClientConfig.h"
+#include "hazelcast/client/ClientProperties.h"
 #include "hazelcast/client/IMap.h"
 #include "HazelcastServer.h"
 
@@ -251,6 +269,49 @@ namespace hazelcast {
                 util::CountDownLatch &evictLatch;
             };
 
+            class CountdownBatchListener : public BatchEntryListener<std::string, std::string> {
+            public:
+                CountdownBatchListener(util::CountDownLatch &addLatch, util::CountDownLatch &removeLatch,
+                                       util::CountDownLatch &clearLatch)
+                        : addLatch(addLatch), removeLatch(removeLatch), clearLatch(clearLatch), maxBatchSize(0) {
+                }
+
+                void entriesChanged(const std::vector<LazyEntryEvent<std::string, std::string> > &events) {
+                    if ((int) events.size() > maxBatchSize) {
+                        maxBatchSize = (int) events.size();
+                    }
+                    for (std::vector<LazyEntryEvent<std::string, std::string> >::const_iterator it = events.begin();
+                         it != events.end(); ++it) {
+                        if (it->getEventType() == EntryEventType::ADDED) {
+                            if (NULL != it->getKeyObject() && NULL != it->getValueObject()) {
+                                addLatch.countDown();
+                            }
+                        } else if (it->getEventType() == EntryEventType::REMOVED) {
+                            if (NULL != it->getKeyObject() && NULL != it->getOldValueObject()) {
+                                removeLatch.countDown();
+                            }
+                        }
+                    }
+                }
+
+                void mapEvicted(const MapEvent &event) {
+                }
+
+                void mapCleared(const MapEvent &event) {
+                    clearLatch.countDown();
+                }
+
+                int getMaxBatchSize() const {
+                    return maxBatchSize;
+                }
+
+            private:
+                util::CountDownLatch &addLatch;
+                util::CountDownLatch &removeLatch;
+                util::CountDownLatch &clearLatch;
+                int maxBatchSize;
+            };
+
             class MyListener : public EntryAdapter<std::string, std::string> {
             public:
                 MyListener(util::CountDownLatch &latch, util::CountDownLatch &nullLatch)
@@ -400,6 +461,106 @@ namespace hazelcast {
                 }
             }
 
+            TEST_F(ClientMapTest, testGetAsync) {
+                fillMap();
+                std::vector<Future<std::string> > futures;
+                for (int i = 0; i < 11; i++) {
+                    futures.push_back(imap->getAsync("key" + util::IOUtil::to_string(i)));
+                }
+                for (int i = 0; i < 10; i++) {
+                    std::auto_ptr<std::string> value = futures[i].get();
+                    ASSERT_NE((std::string *) NULL, value.get());
+                    ASSERT_EQ("value" + util::IOUtil::to_string(i), *value);
+                }
+                ASSERT_EQ((std::string *) NULL, futures[10].get().get());
+            }
+
+#if defined(HZ_USE_COROUTINES)
+            class QueueExecutor : public coroutine::Executor {
+            public:
+                void execute(std::coroutine_handle<> handle) {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    handles.push_back(handle);
+                    condition.notify_one();
+                }
+
+                void runUntil(const bool &done) {
+                    while (!done) {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        condition.wait_for(lock, std::chrono::milliseconds(100), [this] { return !handles.empty(); });
+                        std::vector<std::coroutine_handle<> > ready;
+                        ready.swap(handles);
+                        lock.unlock();
+                        for (size_t i = 0; i < ready.size(); ++i) {
+                            ready[i].resume();
+                        }
+                    }
+                }
+
+            private:
+                std::mutex mutex;
+                std::condition_variable condition;
+                std::vector<std::coroutine_handle<> > handles;
+            };
+
+            struct DetachedTask {
+                struct promise_type {
+                    DetachedTask get_return_object() {
+                        return DetachedTask();
+                    }
+
+                    std::suspend_never initial_suspend() {
+                        return std::suspend_never();
+                    }
+
+                    std::suspend_never final_suspend() noexcept {
+                        return std::suspend_never();
+                    }
+
+                    void return_void() {
+                    }
+
+                    void unhandled_exception() {
+                        std::terminate();
+                    }
+                };
+            };
+
+            static DetachedTask getAllAwaiting(IMap<std::string, std::string> &map, coroutine::Executor &executor,
+                                               std::vector<std::string> &values, bool &cancelled, bool &done) {
+                for (int i = 0; i < 10; i++) {
+                    std::unique_ptr<std::string> value = co_await coroutine::awaitable(
+                            map.getAsync("key" + util::IOUtil::to_string(i)), executor);
+                    values.push_back(*value);
+                }
+
+                coroutine::CancellationToken token;
+                token.cancel();
+                try {
+                    co_await coroutine::awaitable(map.getAsync("key0"), executor, token);
+                } catch (exception::CancellationException &) {
+                    cancelled = true;
+                }
+                done = true;
+            }
+
+            TEST_F(ClientMapTest, testGetAsyncWithCoroutine) {
+                fillMap();
+                QueueExecutor executor;
+                std::vector<std::string> values;
+                bool cancelled = false;
+                bool done = false;
+                getAllAwaiting(*imap, executor, values, cancelled, done);
+                executor.runUntil(done);
+
+                ASSERT_EQ(10U, values.size());
+                for (int i = 0; i < 10; i++) {
+                    ASSERT_EQ("value" + util::IOUtil::to_string(i), values[i]);
+                }
+                ASSERT_TRUE(cancelled);
+            }
+#endif
+
             TEST_F(ClientMapTest, testRemoveAndDelete) {
                 fillMap();
                 boost::shared_ptr<std::string> temp = imap->remove("key10");
@@ -456,6 +617,250 @@ namespace hazelcast {
 
             }
 
+            class CountingBulkLoadListener : public map::BulkLoadListener {
+            public:
+                CountingBulkLoadListener() : storedEntries(0), failedBatches(0) {
+                }
+
+                virtual void batchStored(int partitionId, int32_t entryCount, int64_t latencyMillis) {
+                    util::LockGuard guard(lock);
+                    storedEntries += entryCount;
+                }
+
+                virtual void batchFailed(int partitionId, int32_t entryCount, const exception::IException &error) {
+                    util::LockGuard guard(lock);
+                    ++failedBatches;
+                }
+
+                util::Mutex lock;
+                int storedEntries;
+                int failedBatches;
+            };
+
+            TEST_F(ClientMapTest, testBulkLoader) {
+                CountingBulkLoadListener listener;
+                config::BulkLoaderConfig config;
+                config.setBatchSize(10).setLingerMillis(50).setMaxInFlightPerMember(2).setListener(&listener);
+
+                std::auto_ptr<map::BulkLoader<int, int> > loader = intMap->newBulkLoader(config);
+                for (int i = 0; i < 1000; i++) {
+                    loader->add(i, 2 * i);
+                }
+                loader->close();
+
+                ASSERT_THROW(loader->add(1000, 2000), exception::IllegalStateException);
+
+                map::BulkLoadStats stats = loader->getStats();
+                ASSERT_EQ(1000, stats.getAddedEntries());
+                ASSERT_EQ(1000, stats.getStoredEntries());
+                ASSERT_EQ(0, stats.getFailedEntries());
+                ASSERT_EQ(0, stats.getFailedBatches());
+                ASSERT_EQ(1000, listener.storedEntries);
+                ASSERT_EQ(0, listener.failedBatches);
+
+                ASSERT_EQ(1000, intMap->size());
+                for (int i = 0; i < 1000; i++) {
+                    boost::shared_ptr<int> value = intMap->get(i);
+                    ASSERT_NE((int *) NULL, value.get());
+                    ASSERT_EQ(2 * i, *value);
+                }
+            }
+
+            TEST_F(ClientMapTest, testBulkLoaderKeepsTheOrderOfAPartition) {
+                config::BulkLoaderConfig config;
+                config.setBatchSize(3).setLingerMillis(1).setMaxInFlightPerMember(4);
+
+                // the linger batches of the flusher and the full batches of the producer are mixed, the last value
+                // of a repeated key wins nevertheless
+                std::auto_ptr<map::BulkLoader<int, int> > loader = intMap->newBulkLoader(config);
+                for (int i = 0; i < 500; i++) {
+                    loader->add(i % 5, i);
+                    if (0 == i % 7) {
+                        util::sleepmillis(2);
+                    }
+                }
+                loader->close();
+
+                ASSERT_EQ(500, loader->getStats().getStoredEntries());
+                for (int key = 0; key < 5; key++) {
+                    boost::shared_ptr<int> value = intMap->get(key);
+                    ASSERT_NE((int *) NULL, value.get());
+                    ASSERT_EQ(495 + key, *value);
+                }
+            }
+
+            TEST_F(ClientMapTest, testWriteBehindBuffer) {
+                config::WriteBehindConfig config;
+                config.setCoalescingWindowMillis(60000).setMaxBufferedEntries(10).setOverflowPolicy(
+                        config::WriteBehindConfig::FAIL);
+                std::auto_ptr<map::WriteBehindBuffer<int, int> > buffer = intMap->newWriteBehindBuffer(config);
+
+                for (int i = 0; i < 100; i++) {
+                    buffer->set(i % 10, i);
+                }
+                ASSERT_EQ(10, buffer->getBufferedEntryCount());
+                ASSERT_EQ(90, buffer->getCoalescedUpdateCount());
+                ASSERT_THROW(buffer->set(10, 10), exception::HazelcastOverloadException);
+
+                // read your writes before the window ends
+                ASSERT_EQ(0, intMap->size());
+                ASSERT_EQ(95, *buffer->get(5));
+                ASSERT_EQ((int *) NULL, buffer->get(10).get());
+
+                buffer->flush();
+                ASSERT_EQ(0, buffer->getBufferedEntryCount());
+                ASSERT_EQ(10, intMap->size());
+                for (int i = 0; i < 10; i++) {
+                    ASSERT_EQ(90 + i, *intMap->get(i));
+                }
+
+                buffer->set(10, 10);
+                buffer->close();
+                ASSERT_EQ(10, *intMap->get(10));
+                ASSERT_EQ(0, buffer->getFailedEntryCount());
+                ASSERT_THROW(buffer->set(11, 11), exception::IllegalStateException);
+
+                config::WriteBehindConfig blockingConfig;
+                blockingConfig.setCoalescingWindowMillis(20).setBatchSize(5).setMaxBufferedEntries(10);
+                std::auto_ptr<map::WriteBehindBuffer<int, int> > blockingBuffer =
+                        intMap->newWriteBehindBuffer(blockingConfig);
+                for (int i = 0; i < 1000; i++) {
+                    blockingBuffer->set(i, i);
+                }
+                blockingBuffer->close();
+                ASSERT_EQ(1000, intMap->size());
+            }
+
+            TEST_F(ClientMapTest, testMapCursor) {
+                for (int i = 0; i < 105; i++) {
+                    intMap->put(i, 2 * i);
+                }
+
+                std::auto_ptr<map::MapCursor<int, int> > cursor = intMap->newCursor(10);
+                int pageCount = 0;
+                int expectedKey = 0;
+                for (std::auto_ptr<EntryArray<int, int> > page = cursor->nextPage(); page.get() != NULL;
+                     page = cursor->nextPage()) {
+                    ++pageCount;
+                    ASSERT_LE(page->size(), 10U);
+                    for (size_t i = 0; i < page->size(); ++i) {
+                        ASSERT_EQ(expectedKey, *page->getKey(i));
+                        ASSERT_EQ(2 * expectedKey, *page->getValue(i));
+                        ++expectedKey;
+                    }
+                }
+                ASSERT_EQ(105, expectedKey);
+                ASSERT_EQ(11, pageCount);
+                ASSERT_EQ((EntryArray<int, int> *) NULL, cursor->nextPage().get());
+
+                // only the entries with value < 50
+                std::auto_ptr<query::Predicate> lessThanFifty(
+                        new query::GreaterLessPredicate<int>(query::QueryConstants::getValueAttributeName(), 50, false,
+                                                             true));
+                cursor = intMap->newCursor(10, lessThanFifty);
+                expectedKey = 0;
+                for (std::auto_ptr<EntryArray<int, int> > page = cursor->nextPage(); page.get() != NULL;
+                     page = cursor->nextPage()) {
+                    for (size_t i = 0; i < page->size(); ++i) {
+                        ASSERT_EQ(expectedKey++, *page->getKey(i));
+                    }
+                }
+                ASSERT_EQ(25, expectedKey);
+
+                ASSERT_THROW(intMap->newCursor(0), exception::IllegalArgumentException);
+            }
+
+            class TensDigitExtractor : public map::AttributeExtractor<int, int> {
+            public:
+                int extract(const int &value) const {
+                    return value / 10;
+                }
+            };
+
+            TEST_F(ClientMapTest, testQueryCache) {
+                for (int i = 0; i < 30; i++) {
+                    intMap->put(i, i);
+                }
+
+                // only the entries with value < 20
+                std::auto_ptr<query::Predicate> lessThanTwenty(
+                        new query::GreaterLessPredicate<int>(query::QueryConstants::getValueAttributeName(), 20, false,
+                                                             true));
+                map::QueryCache<int, int> cache(*intMap, lessThanTwenty);
+                ASSERT_EQ(20, cache.size());
+                ASSERT_TRUE(cache.containsKey(19));
+                ASSERT_FALSE(cache.containsKey(20));
+                ASSERT_EQ(7, *cache.get(7));
+
+                cache.addIndex<int>("tens", std::auto_ptr<map::AttributeExtractor<int, int> >(new TensDigitExtractor()));
+                std::vector<int> keys = cache.keySet<int>("tens", 1);
+                ASSERT_EQ(10, (int) keys.size());
+                ASSERT_EQ(10, keys[0]);
+                ASSERT_EQ(19, keys[9]);
+                ASSERT_THROW(cache.keySet<int>("tenth", 1), exception::IllegalArgumentException);
+                ASSERT_THROW(cache.keySet<std::string>("tens", "1"), exception::IllegalArgumentException);
+
+                // entering, updated and leaving entries
+                intMap->put(25, 5);
+                intMap->put(3, 13);
+                intMap->put(4, 40);
+                intMap->remove(5);
+                ASSERT_EQ_EVENTUALLY(19, cache.size());
+                ASSERT_TRUE_EVENTUALLY(cache.containsKey(25));
+                ASSERT_FALSE_EVENTUALLY(cache.containsKey(4));
+                ASSERT_EQ_EVENTUALLY(13, *cache.get(3));
+                ASSERT_FALSE(cache.containsKey(5));
+
+                std::vector<int> values = cache.values<int>("tens", 0, 0);
+                ASSERT_EQ(8, (int) values.size());
+                ASSERT_EQ(8, (int) cache.keySet<int>("tens", 0).size());
+                ASSERT_EQ(11, (int) cache.keySet<int>("tens", 1, 1).size());
+                ASSERT_EQ(0, (int) cache.keySet<int>("tens", 2, 0).size());
+
+                intMap->clear();
+                ASSERT_TRUE_EVENTUALLY(cache.isEmpty());
+                ASSERT_EQ(0, (int) cache.keySet<int>("tens", 0, 9).size());
+
+                cache.destroy();
+                intMap->put(1, 1);
+                util::sleepmillis(500);
+                ASSERT_TRUE(cache.isEmpty());
+            }
+
+            TEST_F(ClientMapTest, testRawAndLazyValues) {
+                imap->put("key1", "value1");
+                imap->put("key2", "value2");
+
+                std::auto_ptr<serialization::pimpl::Data> raw = imap->getRaw("key1");
+                ASSERT_NE((serialization::pimpl::Data *) NULL, raw.get());
+                ASSERT_EQ((serialization::pimpl::Data *) NULL, imap->getRaw("nonexisting").get());
+
+                ASSERT_EQ((serialization::pimpl::Data *) NULL, imap->putRaw("key3", *raw).get());
+                std::auto_ptr<serialization::pimpl::Data> oldValue = imap->putRaw("key2", *raw);
+                ASSERT_NE((serialization::pimpl::Data *) NULL, oldValue.get());
+                ASSERT_EQ("value1", *imap->get("key3"));
+                ASSERT_EQ("value1", *imap->get("key2"));
+
+                std::set<std::string> keys;
+                keys.insert("key1");
+                keys.insert("key3");
+                keys.insert("nonexisting");
+                std::map<std::string, serialization::pimpl::Data> rawEntries = imap->getAllRaw(keys);
+                ASSERT_EQ(2, (int) rawEntries.size());
+                ASSERT_EQ(raw->toByteArray(), rawEntries["key3"].toByteArray());
+
+                LazyValue<std::string> lazyValue = imap->getLazy("key1");
+                ASSERT_FALSE(lazyValue.isNull());
+                ASSERT_EQ(raw->toByteArray(), lazyValue.getData()->toByteArray());
+                ASSERT_EQ("value1", *lazyValue.get());
+                ASSERT_EQ(lazyValue.get(), lazyValue.getShared().get());
+
+                LazyValue<std::string> missing = imap->getLazy("nonexisting");
+                ASSERT_TRUE(missing.isNull());
+                ASSERT_EQ((const std::string *) NULL, missing.get());
+                ASSERT_EQ((const serialization::pimpl::Data *) NULL, missing.getData());
+            }
+
             TEST_F(ClientMapTest, testTryPutRemove) {
 
                 ASSERT_TRUE(imap->tryPut("key1", "value1", 1 * 1000));
@@ -1294,6 +1699,48 @@ namespace hazelcast {
                 ASSERT_EQ("key_22_test", strKeys[1]);
             }
 
+            TEST_F(ClientMapTest, testPagingPredicateRevisitedPagesAreFresh) {
+                int predSize = 5;
+                const int totalEntries = 25;
+
+                for (int i = 0; i < totalEntries; ++i) {
+                    intMap->put(i, i);
+                }
+
+                query::PagingPredicate<int, int> predicate((size_t)predSize);
+
+                // a single query returns the pages 0 to 3, only the requested one is ordered
+                predicate.setPage(3);
+                std::vector<int> values = intMap->values(predicate);
+                ASSERT_EQ(predSize, (int) values.size());
+                for (int i = 0; i < predSize; ++i) {
+                    ASSERT_EQ(3 * predSize + i, values[i]);
+                }
+
+                // a revisited page is queried again and reflects the removal
+                intMap->remove(predSize);
+                predicate.setPage(1);
+                values = intMap->values(predicate);
+                ASSERT_EQ(predSize, (int) values.size());
+                for (int i = 0; i < predSize; ++i) {
+                    ASSERT_EQ(predSize + 1 + i, values[i]);
+                }
+
+                predicate.previousPage();
+                values = intMap->values(predicate);
+                ASSERT_EQ(predSize, (int) values.size());
+                for (int i = 0; i < predSize; ++i) {
+                    ASSERT_EQ(i, values[i]);
+                }
+
+                predicate.setPage(1);
+                std::vector<int> keys = intMap->keySet(predicate);
+                ASSERT_EQ(predSize, (int) keys.size());
+                for (int i = 0; i < predSize; ++i) {
+                    ASSERT_EQ(predSize + 1 + i, keys[i]);
+                }
+            }
+
             TEST_F(ClientMapTest, testKeySetWithPagingPredicate) {
                 int predSize = 5;
                 const int totalEntries = 25;
@@ -1922,6 +2369,299 @@ namespace hazelcast {
 
             }
 
+            TEST_F(ClientMapTest, testListenerWithSmartListenerRegistration) {
+                ClientConfig config;
+                config.addAddress(Address(g_srvFactory->getServerAddress(), 5701));
+                config.setProperty(ClientProperties::PROP_SMART_LISTENER_REGISTRATION, "true");
+                HazelcastClient smartClient(config);
+                IMap<std::string, std::string> map = smartClient.getMap<std::string, std::string>("clientMapTest");
+
+                util::CountDownLatch latchAdd(5);
+                util::CountDownLatch latchRemove(2);
+                util::CountDownLatch dummy(10);
+
+                CountdownListener<std::string, std::string> listener(latchAdd, latchRemove, dummy, dummy);
+
+                std::string listenerId = map.addEntryListener(listener, false);
+
+                util::sleep(2);
+
+                // keys are spread over the partitions of both members, hence the events are received from both
+                for (int i = 0; i < 5; ++i) {
+                    map.put(std::string("smartKey") + util::IOUtil::to_string(i), "value");
+                }
+                map.remove("smartKey0");
+                map.remove("smartKey1");
+
+                ASSERT_TRUE(latchAdd.await(10));
+                ASSERT_TRUE(latchRemove.await(10));
+
+                ASSERT_TRUE(map.removeEntryListener(listenerId));
+                ASSERT_FALSE(map.removeEntryListener(listenerId));
+            }
+
+            TEST_F(ClientMapTest, testParallelDeserialization) {
+                ClientConfig config;
+                config.addAddress(Address(g_srvFactory->getServerAddress(), 5701));
+                config.setProperty(ClientProperties::PROP_DESERIALIZATION_POOL_SIZE, "3");
+                config.setProperty(ClientProperties::PROP_DESERIALIZATION_CHUNK_SIZE, "7");
+                HazelcastClient parallelClient(config);
+                IMap<int, std::string> map = parallelClient.getMap<int, std::string>("parallelDeserializationMap");
+
+                std::map<int, std::string> entries;
+                std::set<int> keys;
+                for (int i = 0; i < 100; ++i) {
+                    entries[i] = util::IOUtil::to_string(i);
+                    keys.insert(i);
+                }
+                map.putAll(entries);
+
+                std::vector<std::pair<int, std::string> > entrySet = map.entrySet();
+                ASSERT_EQ(100U, entrySet.size());
+                for (size_t i = 0; i < entrySet.size(); ++i) {
+                    ASSERT_EQ(util::IOUtil::to_string(entrySet[i].first), entrySet[i].second);
+                }
+
+                std::vector<int> keySet = map.keySet();
+                std::sort(keySet.begin(), keySet.end());
+                ASSERT_EQ(100U, keySet.size());
+                for (int i = 0; i < 100; ++i) {
+                    ASSERT_EQ(i, keySet[i]);
+                }
+
+                std::vector<std::string> values = map.values();
+                ASSERT_EQ(100U, values.size());
+
+                ASSERT_EQ(entries, map.getAll(keys));
+
+                map.destroy();
+            }
+
+            TEST_F(ClientMapTest, testHotKeyProfiler) {
+                ASSERT_EQ(0, client->getHotKeyStats().getSampleRate());
+                ASSERT_EQ(0, client->getHotKeyStats().getSampledOperationCount());
+
+                ClientConfig config;
+                config.addAddress(Address(g_srvFactory->getServerAddress(), 5701));
+                config.setProperty(ClientProperties::PROP_HOT_KEY_SAMPLE_RATE, "2");
+                config.setProperty(ClientProperties::PROP_HOT_KEY_TOP_K, "2");
+                HazelcastClient profiledClient(config);
+                IMap<std::string, std::string> map = profiledClient.getMap<std::string, std::string>("hotKeyMap");
+                IQueue<std::string> queue = profiledClient.getQueue<std::string>("hotKeyQueue");
+
+                map.put("hot", "value");
+                for (int i = 0; i < 99; ++i) {
+                    ASSERT_EQ("value", *map.get("hot"));
+                }
+                for (int i = 0; i < 20; ++i) {
+                    map.get(util::IOUtil::to_string(i));
+                }
+                for (int i = 0; i < 10; ++i) {
+                    ASSERT_TRUE(queue.offer("item"));
+                }
+
+                HotKeyStats stats = profiledClient.getHotKeyStats();
+                ASSERT_EQ(2, stats.getSampleRate());
+                ASSERT_EQ(65, stats.getSampledOperationCount());
+
+                // the sketch may over estimate a count, it never under estimates it
+                const std::vector<HotKeyStats::HotKey> &hotKeys = stats.getHotKeys();
+                ASSERT_EQ(2U, hotKeys.size());
+                ASSERT_EQ("hotKeyMap", hotKeys[0].getObjectName());
+                ASSERT_LE(100, hotKeys[0].getEstimatedCount());
+                ASSERT_EQ("hotKeyQueue", hotKeys[1].getObjectName());
+                ASSERT_LE(10, hotKeys[1].getEstimatedCount());
+
+                int64_t partitionTotal = 0;
+                const std::map<int, int64_t> &partitionCounts = stats.getPartitionOperationCounts();
+                for (std::map<int, int64_t>::const_iterator it = partitionCounts.begin();
+                     it != partitionCounts.end(); ++it) {
+                    partitionTotal += it->second;
+                }
+                ASSERT_EQ(130, partitionTotal);
+                ASSERT_LE(100, partitionCounts.find(hotKeys[0].getPartitionId())->second);
+
+                const std::map<Address, int64_t, addressComparator> &memberCounts = stats.getMemberOperationCounts();
+                ASSERT_EQ(1U, memberCounts.size());
+                ASSERT_EQ(130, memberCounts.begin()->second);
+
+                map.destroy();
+                queue.destroy();
+            }
+
+            TEST_F(ClientMapTest, testHotKeyProfilerHalvesTheCountsEveryInterval) {
+                ClientConfig config;
+                config.addAddress(Address(g_srvFactory->getServerAddress(), 5701));
+                config.setProperty(ClientProperties::PROP_HOT_KEY_SAMPLE_RATE, "1");
+                config.setProperty(ClientProperties::PROP_HOT_KEY_DUMP_INTERVAL_SECONDS, "1");
+                HazelcastClient profiledClient(config);
+                IMap<std::string, std::string> map = profiledClient.getMap<std::string, std::string>("hotKeyDecayMap");
+
+                for (int i = 0; i < 100; ++i) {
+                    map.put("cooling", "value");
+                }
+
+                // 100 operations are halved to 0 within 7 intervals, and the key drops out of the candidates
+                ASSERT_EQ_EVENTUALLY(0, profiledClient.getHotKeyStats().getSampledOperationCount());
+                ASSERT_EQ(0U, profiledClient.getHotKeyStats().getHotKeys().size());
+                ASSERT_EQ(0U, profiledClient.getHotKeyStats().getPartitionOperationCounts().size());
+                ASSERT_EQ(0U, profiledClient.getHotKeyStats().getMemberOperationCounts().size());
+
+                map.destroy();
+            }
+
+            class CachingPreloadListener : public map::PreloadListener<int, std::string> {
+            public:
+                virtual void entriesPreloaded(const std::vector<std::pair<int, std::string> > &entries) {
+                    util::LockGuard guard(lock);
+                    ++batches;
+                    cache.insert(entries.begin(), entries.end());
+                }
+
+                util::Mutex lock;
+                std::map<int, std::string> cache;
+                int batches;
+
+                CachingPreloadListener() : batches(0) {
+                }
+            };
+
+            TEST_F(ClientMapTest, testPreloader) {
+                IMap<int, std::string> map = client->getMap<int, std::string>("preloaderMap");
+                std::remove(map::impl::KeySnapshot::getPath(".", "preloaderMap").c_str());
+
+                config::PreloaderConfig config;
+                config.setStoreIntervalSeconds(0).setBatchSize(7).setMaxInFlightBatches(2).setMaxBytesPerSecond(
+                        1024 * 1024);
+
+                // there is no snapshot yet
+                CachingPreloadListener emptyListener;
+                std::auto_ptr<map::Preloader<int, std::string> > preloader = map.newPreloader(emptyListener, config);
+                ASSERT_TRUE(preloader->awaitPreload(10000));
+                ASSERT_EQ(0, preloader->getPreloadedEntryCount());
+                ASSERT_FALSE(preloader->storeHotKeySnapshot());
+
+                std::vector<int> keys;
+                for (int i = 0; i < 50; ++i) {
+                    map.put(i, util::IOUtil::to_string(i));
+                    keys.push_back(i);
+                }
+                // a key which is not in the map is skipped
+                keys.push_back(1000);
+                preloader->storeSnapshot(keys);
+                preloader->close();
+
+                CachingPreloadListener listener;
+                preloader = map.newPreloader(listener, config);
+                ASSERT_TRUE(preloader->awaitPreload(30000));
+                ASSERT_TRUE(preloader->isPreloadCompleted());
+                ASSERT_EQ(50, preloader->getPreloadedEntryCount());
+                ASSERT_EQ(0, preloader->getFailedBatchCount());
+                preloader->close();
+
+                util::LockGuard guard(listener.lock);
+                ASSERT_EQ(50U, listener.cache.size());
+                ASSERT_LE(8, listener.batches);
+                for (int i = 0; i < 50; ++i) {
+                    ASSERT_EQ(util::IOUtil::to_string(i), listener.cache[i]);
+                }
+
+                ASSERT_THROW(config::PreloaderConfig().setBatchSize(0), exception::IllegalArgumentException);
+                map.destroy();
+                std::remove(map::impl::KeySnapshot::getPath(".", "preloaderMap").c_str());
+            }
+
+            static std::vector<int> loadSnapshotKeys(const std::string &mapName) {
+                std::vector<serialization::pimpl::Data> dataKeys;
+                std::vector<int> keys;
+                if (!map::impl::KeySnapshot::load(map::impl::KeySnapshot::getPath(".", mapName), mapName, 1000,
+                                                   dataKeys)) {
+                    return keys;
+                }
+
+                SerializationConfig serializationConfig;
+                serialization::pimpl::SerializationService serializationService(serializationConfig);
+                for (std::vector<serialization::pimpl::Data>::const_iterator it = dataKeys.begin();
+                     it != dataKeys.end(); ++it) {
+                    keys.push_back(*serializationService.toObject<int>(*it));
+                }
+                return keys;
+            }
+
+            static bool isSnapshotLedBy(const std::string &mapName, int hotKey, size_t keyCount) {
+                std::vector<int> keys = loadSnapshotKeys(mapName);
+                return keys.size() == keyCount && keys[0] == hotKey;
+            }
+
+            TEST_F(ClientMapTest, testPreloaderStoresTheHotKeys) {
+                ClientConfig config;
+                config.addAddress(Address(g_srvFactory->getServerAddress(), 5701));
+                config.setProperty(ClientProperties::PROP_HOT_KEY_SAMPLE_RATE, "1");
+                config.setProperty(ClientProperties::PROP_HOT_KEY_TOP_K, "5");
+                HazelcastClient profiledClient(config);
+                IMap<int, std::string> map = profiledClient.getMap<int, std::string>("preloaderHotKeyMap");
+                std::string path = map::impl::KeySnapshot::getPath(".", "preloaderHotKeyMap");
+                std::remove(path.c_str());
+
+                std::vector<int> keys;
+                for (int i = 0; i < 50; ++i) {
+                    map.put(i, util::IOUtil::to_string(i));
+                    keys.push_back(i);
+                }
+
+                CachingPreloadListener listener;
+                std::auto_ptr<map::Preloader<int, std::string> > preloader = map.newPreloader(
+                        listener, config::PreloaderConfig().setStoreIntervalSeconds(1).setMaxKeys(30));
+                ASSERT_TRUE(preloader->awaitPreload(10000));
+                preloader->storeSnapshot(keys);
+                ASSERT_EQ(30U, loadSnapshotKeys("preloaderHotKeyMap").size());
+
+                for (int i = 0; i < 10; ++i) {
+                    map.get(40);
+                }
+
+                // the periodic store puts the hot key first and keeps the stored keys, the top K of the profiler does
+                // not shrink the snapshot
+                ASSERT_TRUE_EVENTUALLY(isSnapshotLedBy("preloaderHotKeyMap", 40, 30));
+
+                // close stores the hot keys one last time
+                std::remove(path.c_str());
+                preloader->close();
+                ASSERT_TRUE(isSnapshotLedBy("preloaderHotKeyMap", 40, 30));
+
+                map.destroy();
+                std::remove(path.c_str());
+            }
+
+            TEST_F(ClientMapTest, testBatchListener) {
+                util::CountDownLatch latchAdd(100);
+                util::CountDownLatch latchRemove(10);
+                util::CountDownLatch latchClear(1);
+
+                CountdownBatchListener listener(latchAdd, latchRemove, latchClear);
+
+                std::string listenerId = imap->addBatchEntryListener(listener, true, 10, 200);
+
+                util::sleep(2);
+
+                for (int i = 0; i < 100; ++i) {
+                    imap->put(std::string("batchKey") + util::IOUtil::to_string(i), "value");
+                }
+                for (int i = 0; i < 10; ++i) {
+                    imap->remove(std::string("batchKey") + util::IOUtil::to_string(i));
+                }
+                imap->clear();
+
+                ASSERT_TRUE(latchAdd.await(10));
+                ASSERT_TRUE(latchRemove.await(10));
+                ASSERT_TRUE(latchClear.await(10));
+                ASSERT_LE(listener.getMaxBatchSize(), 10);
+                // the events of the burst are delivered together, not one by one
+                ASSERT_GT(listener.getMaxBatchSize(), 1);
+
+                ASSERT_TRUE(imap->removeEntryListener(listenerId));
+            }
+
             TEST_F(ClientMapTest, testListenerWithTruePredicate) {
                 util::CountDownLatch latchAdd(3);
                 util::CountDownLatch latchRemove(1);
@@ -21,6 +21,8 @@
 
 #include "hazelcast/client/protocol/ClientMessage.h"
 
+#include <vector>
+
 namespace hazelcast {
     namespace client {
         namespace test {
@@ -76,6 +78,64 @@ namespace hazelcast {
 
                 }
 
+                TEST_F(ClientMessageTest, testFragmentAndMerge) {
+                    using hazelcast::client::protocol::ClientMessage;
+
+                    const int32_t numValues = 100;
+                    std::auto_ptr<ClientMessage> msg = ClientMessage::createForEncode(
+                            ClientMessage::HEADER_SIZE + numValues * ClientMessage::INT32_SIZE);
+                    msg->setCorrelationId(0xABCDEF12);
+                    msg->setMessageType(0xABCD);
+                    msg->setPartitionId(17);
+                    for (int32_t i = 0; i < numValues; ++i) {
+                        msg->set(i);
+                    }
+                    msg->updateFrameLength();
+
+                    // 400 bytes of payload in fragments of 100, 100, 100 and 100 bytes, the payload of a fragment is
+                    // captured by the socket stub
+                    SocketStub socket;
+                    std::vector<ClientMessage *> fragments;
+                    std::vector<uint8_t> expectedFlags;
+                    expectedFlags.push_back((uint8_t) ClientMessage::BEGIN_FLAG);
+                    expectedFlags.push_back(0);
+                    expectedFlags.push_back(0);
+                    expectedFlags.push_back((uint8_t) ClientMessage::END_FLAG);
+                    int32_t dataStart = ClientMessage::HEADER_SIZE;
+                    for (size_t i = 0; i < expectedFlags.size(); ++i) {
+                        int32_t length = 100;
+                        byte *frame = new byte[ClientMessage::HEADER_SIZE + length];
+                        int32_t headerLen = msg->writeFragmentHeader(frame, length, expectedFlags[i]);
+                        ASSERT_EQ((int32_t) ClientMessage::HEADER_SIZE, headerLen);
+                        ASSERT_EQ(length, msg->writeTo(socket, dataStart, dataStart + length));
+                        memcpy(frame + headerLen, buffer, (size_t) length);
+                        std::auto_ptr<ClientMessage> fragment(new ClientMessage());
+                        fragment->wrapForDecode(frame, headerLen + length, true);
+                        ASSERT_EQ(ClientMessage::HEADER_SIZE + length, fragment->getFrameLength());
+                        ASSERT_EQ(length, fragment->getDataSize());
+                        ASSERT_EQ(0xABCDEF12, fragment->getCorrelationId());
+                        ASSERT_EQ(0xABCD, fragment->getMessageType());
+                        ASSERT_EQ(17, fragment->getPartitionId());
+                        ASSERT_EQ(i == 0, fragment->isFlagSet(ClientMessage::BEGIN_FLAG));
+                        ASSERT_EQ(i == 3, fragment->isFlagSet(ClientMessage::END_FLAG));
+                        fragments.push_back(fragment.release());
+                        dataStart += length;
+                    }
+
+                    std::auto_ptr<ClientMessage> merged = ClientMessage::merge(fragments);
+                    for (std::vector<ClientMessage *>::iterator it = fragments.begin(); it != fragments.end(); ++it) {
+                        delete *it;
+                    }
+
+                    ASSERT_EQ(msg->getFrameLength(), merged->getFrameLength());
+                    ASSERT_TRUE(merged->isFlagSet(ClientMessage::BEGIN_AND_END_FLAGS));
+                    ASSERT_EQ(0xABCDEF12, merged->getCorrelationId());
+                    ASSERT_EQ(0xABCD, merged->getMessageType());
+                    for (int32_t i = 0; i < numValues; ++i) {
+                        ASSERT_EQ(i, merged->get<int32_t>());
+                    }
+                }
+
                 ClientMessageTest::SocketStub::SocketStub() : Socket(-1) {
                 }
 
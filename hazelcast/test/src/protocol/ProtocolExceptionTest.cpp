@@ -39,6 +39,20 @@ namespace hazelcast {
                     ASSERT_EQ(callId, exception.getMessageCallId());
                     ASSERT_EQ(details, exception.getDetailedErrorMessage());
                 }
+
+                TEST(ProtocolExceptionTest, testCloneKeepsTheExceptionType) {
+                    client::exception::TopicOverloadException exception("source", "message");
+                    std::auto_ptr<client::exception::IException> copy = exception.clone();
+                    ASSERT_THROW(copy->raise(), client::exception::TopicOverloadException);
+                    ASSERT_EQ(std::string("message"), copy->getMessage());
+
+                    client::exception::UndefinedErrorCodeException undefined(-1, 5, "details");
+                    copy = undefined.clone();
+                    client::exception::UndefinedErrorCodeException *undefinedCopy =
+                            dynamic_cast<client::exception::UndefinedErrorCodeException *>(copy.get());
+                    ASSERT_NE((client::exception::UndefinedErrorCodeException *) NULL, undefinedCopy);
+                    ASSERT_EQ(5, undefinedCopy->getMessageCallId());
+                }
             }
         }
     }
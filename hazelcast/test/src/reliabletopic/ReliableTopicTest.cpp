@@ -324,6 +324,93 @@ namespace hazelcast {
                 }
             }
 
+            TEST_F(ReliableTopicTest, testManyListenersOnSharedExecutor) {
+                ClientConfig clientConfig;
+                clientConfig.addAddress(Address(g_srvFactory->getServerAddress(), 5701));
+                clientConfig.setProperty(ClientProperties::PROP_RELIABLE_TOPIC_EXECUTOR_POOL_SIZE, "1");
+                HazelcastClient poolClient(clientConfig);
+
+                const int numberOfListeners = 50;
+                const int numberOfMessages = 10;
+
+                boost::shared_ptr<ReliableTopic<int> > topic;
+                ASSERT_NO_THROW(topic = poolClient.getReliableTopic<int>("testManyListenersOnSharedExecutor"));
+
+                util::CountDownLatch latch(numberOfListeners * numberOfMessages);
+                std::vector<boost::shared_ptr<IntListener> > listeners;
+                for (int i = 0; i < numberOfListeners; ++i) {
+                    boost::shared_ptr<IntListener> listener(new IntListener(latch));
+                    listeners.push_back(listener);
+                    ASSERT_NO_THROW(topic->addMessageListener(*listener));
+                }
+
+                for (int k = 0; k < numberOfMessages; k++) {
+                    ASSERT_NO_THROW(topic->publish(&k));
+                }
+
+                ASSERT_TRUE(latch.await(20));
+                for (int i = 0; i < numberOfListeners; ++i) {
+                    ASSERT_EQ(numberOfMessages, listeners[i]->getNumberOfMessagesReceived());
+                    util::ConcurrentQueue<int> &objects = listeners[i]->getObjects();
+                    for (int k = 0; k < numberOfMessages; k++) {
+                        int *val = objects.poll();
+                        ASSERT_NE((int *)NULL, val);
+                        ASSERT_EQ(k, *val);
+                        delete val;
+                    }
+                }
+            }
+
+            TEST_F(ReliableTopicTest, testPublishAsync) {
+                ClientConfig clientConfig;
+                clientConfig.addAddress(Address(g_srvFactory->getServerAddress(), 5701));
+                config::ReliableTopicConfig relConfig("testPublishAsync");
+                relConfig.setPublishBatchSize(7).setPublishLingerMillis(5);
+                clientConfig.addReliableTopicConfig(relConfig);
+                HazelcastClient configClient(clientConfig);
+
+                boost::shared_ptr<ReliableTopic<int> > topic;
+                ASSERT_NO_THROW(topic = configClient.getReliableTopic<int>("testPublishAsync"));
+
+                const int numberOfMessages = 100;
+                util::CountDownLatch latch(numberOfMessages);
+                IntListener listener(latch);
+                std::string listenerId;
+                ASSERT_NO_THROW(listenerId = topic->addMessageListener(listener));
+
+                std::vector<topic::PublishFuture> futures;
+                for (int k = 0; k < numberOfMessages; k++) {
+                    futures.push_back(topic->publishAsync(&k));
+                }
+                for (std::vector<topic::PublishFuture>::iterator it = futures.begin(); it != futures.end(); ++it) {
+                    ASSERT_TRUE(it->get(10));
+                }
+
+                ASSERT_TRUE(latch.await(10));
+                ASSERT_EQ(numberOfMessages, listener.getNumberOfMessagesReceived());
+                util::ConcurrentQueue<int> &objects = listener.getObjects();
+                for (int k = 0; k < numberOfMessages; k++) {
+                    int *val = objects.poll();
+                    ASSERT_NE((int *)NULL, val);
+                    ASSERT_EQ(k, *val);
+                    delete val;
+                }
+
+                ASSERT_TRUE(topic->removeMessageListener(listenerId));
+            }
+
+            TEST_F(ReliableTopicTest, testPublishConfig) {
+                config::ReliableTopicConfig relConfig("testPublishConfig");
+                ASSERT_EQ(topic::DISCARD_OLDEST, relConfig.getTopicOverloadPolicy());
+                ASSERT_EQ(config::ReliableTopicConfig::DEFAULT_PUBLISH_BATCH_SIZE, relConfig.getPublishBatchSize());
+                ASSERT_EQ(0, relConfig.getPublishLingerMillis());
+
+                ASSERT_EQ(topic::FAIL, relConfig.setTopicOverloadPolicy(topic::FAIL).getTopicOverloadPolicy());
+                ASSERT_THROW(relConfig.setPublishBatchSize(0), exception::IllegalArgumentException);
+                ASSERT_THROW(relConfig.setPublishBatchSize(1001), exception::IllegalArgumentException);
+                ASSERT_THROW(relConfig.setPublishLingerMillis(-1), exception::IllegalArgumentException);
+            }
+
             TEST_F(ReliableTopicTest, testMessageFieldSetCorrectly) {
                 boost::shared_ptr<ReliableTopic<int> > intTopic;
                 ASSERT_NO_THROW(intTopic = client->getReliableTopic<int>("testMessageFieldSetCorrectly"));
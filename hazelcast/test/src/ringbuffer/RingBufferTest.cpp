@@ -18,11 +18,13 @@
 
 #include "hazelcast/client/exception/ProtocolExceptions.h"
 #include "hazelcast/client/HazelcastClient.h"
+#include "hazelcast/client/ringbuffer/TailingReader.h"
 
 #include "../HazelcastServerFactory.h"
 #include "../ClientTestSupport.h"
 #include "../HazelcastServer.h"
 #include "../serialization/Employee.h"
+#include "../TestHelperFunctions.h"
 
 namespace hazelcast {
     namespace client {
@@ -118,6 +120,105 @@ namespace hazelcast {
                 ASSERT_EQ(CAPACITY, rb->size());
                 ASSERT_EQ(latestEmployee, *rb->readOne(CAPACITY));
             }
+
+            TEST_F(RingbufferTest, testAddAllAndReadManyAsync) {
+                boost::shared_ptr<Ringbuffer<Employee> > batchRb = client->getRingbuffer<Employee>("rb-batch");
+
+                std::vector<Employee> items;
+                for (int i = 0; i < 5; ++i) {
+                    items.push_back(Employee("name", 10 * i));
+                }
+
+                Future<int64_t> addFuture = batchRb->addAllAsync(items, ringbuffer::OVERWRITE);
+                ASSERT_EQ(4, *addFuture.get());
+
+                Future<ringbuffer::ReadResultSet<Employee> > readFuture = batchRb->readManyAsync(1, 1, 3);
+                std::auto_ptr<ringbuffer::ReadResultSet<Employee> > result = readFuture.get();
+                ASSERT_EQ(3, result->getReadCount());
+                ASSERT_EQ(3U, result->size());
+                for (size_t i = 0; i < result->size(); ++i) {
+                    ASSERT_EQ(items[i + 1], *result->get(i));
+                }
+
+                ASSERT_THROW(batchRb->addAllAsync(std::vector<Employee>(), ringbuffer::OVERWRITE),
+                             exception::IllegalArgumentException);
+                ASSERT_THROW(batchRb->readManyAsync(-1, 1, 3), exception::IllegalArgumentException);
+                ASSERT_THROW(batchRb->readManyAsync(0, 3, 1), exception::IllegalArgumentException);
+                ASSERT_THROW(batchRb->readManyAsync(0, 1, Ringbuffer<Employee>::MAX_BATCH_SIZE + 1),
+                             exception::IllegalArgumentException);
+            }
+
+            TEST_F(RingbufferTest, testInvocationAdmissionControl) {
+                ClientConfig failFastConfig;
+                failFastConfig.addAddress(Address(g_srvFactory->getServerAddress(), 5701));
+                failFastConfig.setProperty(ClientProperties::PROP_MAX_CONCURRENT_INVOCATIONS, "2");
+                failFastConfig.setProperty(ClientProperties::PROP_BACKPRESSURE_POLICY, "FAIL_FAST");
+                HazelcastClient failFastClient(failFastConfig);
+                boost::shared_ptr<Ringbuffer<Employee> > admissionRb =
+                        failFastClient.getRingbuffer<Employee>("rb-admission");
+
+                // the reads wait on the server until an item is added, hence they keep their admission
+                Future<ringbuffer::ReadResultSet<Employee> > read1 = admissionRb->readManyAsync(0, 1, 10);
+                Future<ringbuffer::ReadResultSet<Employee> > read2 = admissionRb->readManyAsync(0, 1, 10);
+                ASSERT_THROW(admissionRb->size(), exception::HazelcastOverloadException);
+
+                InvocationAdmissionStats stats = failFastClient.getInvocationAdmissionStats();
+                ASSERT_EQ(2, stats.getOutstandingInvocations());
+                ASSERT_EQ(1, stats.getRejectedInvocations());
+
+                client->getRingbuffer<Employee>("rb-admission")->add(Employee("admission", 1));
+                ASSERT_EQ(1, read1.get()->getReadCount());
+                ASSERT_EQ(1, read2.get()->getReadCount());
+                ASSERT_EQ_EVENTUALLY(0, failFastClient.getInvocationAdmissionStats().getOutstandingInvocations());
+                ASSERT_EQ(1, admissionRb->size());
+
+                ClientConfig blockingConfig;
+                blockingConfig.addAddress(Address(g_srvFactory->getServerAddress(), 5701));
+                blockingConfig.setProperty(ClientProperties::PROP_MAX_CONCURRENT_INVOCATIONS, "1");
+                blockingConfig.setProperty(ClientProperties::PROP_BACKPRESSURE_TIMEOUT_MILLIS, "500");
+                HazelcastClient blockingClient(blockingConfig);
+                boost::shared_ptr<Ringbuffer<Employee> > blockingRb =
+                        blockingClient.getRingbuffer<Employee>("rb-admission");
+
+                Future<ringbuffer::ReadResultSet<Employee> > read3 = blockingRb->readManyAsync(1, 1, 10);
+                ASSERT_THROW(blockingRb->size(), exception::HazelcastOverloadException);
+                stats = blockingClient.getInvocationAdmissionStats();
+                ASSERT_EQ(1, stats.getWaitedInvocations());
+                ASSERT_LE(400, stats.getTotalWaitMillis());
+
+                client->getRingbuffer<Employee>("rb-admission")->add(Employee("admission", 2));
+                ASSERT_EQ(1, read3.get()->getReadCount());
+                ASSERT_EQ_EVENTUALLY(0, blockingClient.getInvocationAdmissionStats().getOutstandingInvocations());
+                ASSERT_EQ(2, blockingRb->size());
+            }
+
+            TEST_F(RingbufferTest, testTailingReader) {
+                boost::shared_ptr<Ringbuffer<Employee> > tailRb = client->getRingbuffer<Employee>("rb-tail");
+
+                std::vector<Employee> items;
+                for (int i = 0; i < 8; ++i) {
+                    items.push_back(Employee("tail", i));
+                }
+                ASSERT_EQ(7, *tailRb->addAllAsync(items, ringbuffer::OVERWRITE).get());
+
+                ringbuffer::TailingReader<Employee> reader(*tailRb, 0, 3);
+                size_t numRead = 0;
+                while (numRead < items.size()) {
+                    std::auto_ptr<ringbuffer::ReadResultSet<Employee> > batch = reader.next();
+                    ASSERT_LE(batch->size(), 3U);
+                    for (size_t i = 0; i < batch->size(); ++i) {
+                        ASSERT_EQ(items[numRead++], *batch->get(i));
+                    }
+                }
+                ASSERT_EQ(8, reader.getSequence());
+
+                // the next read is already in flight, it completes as soon as a new item is added
+                Employee last("last", 100);
+                ASSERT_EQ(8, tailRb->add(last));
+                std::auto_ptr<ringbuffer::ReadResultSet<Employee> > batch = reader.next();
+                ASSERT_EQ(1U, batch->size());
+                ASSERT_EQ(last, *batch->get(0));
+            }
         }
     }
 }
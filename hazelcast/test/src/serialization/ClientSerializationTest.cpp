@@ -32,8 +32,10 @@
 #include "hazelcast/client/serialization/pimpl/SerializationService.h"
 #include "serialization/ClientSerializationTest.h"
 #include "hazelcast/client/SerializationConfig.h"
+#include "hazelcast/client/LazyValue.h"
 #include "hazelcast/util/MurmurHash3.h"
 #include "TestNamedPortableV3.h"
+#include "TestPartitionAwareKey.h"
 
 namespace hazelcast {
     namespace client {
@@ -68,6 +70,26 @@ namespace hazelcast {
             }
 
 
+            TEST_F(ClientSerializationTest, testLazyValueCopiesShareTheObject) {
+                SerializationConfig serializationConfig;
+                serialization::pimpl::SerializationService serializationService(serializationConfig);
+                std::string value("lazy value");
+                boost::shared_ptr<serialization::pimpl::Data> data(new serialization::pimpl::Data(
+                        serializationService.toData<std::string>(&value)));
+
+                LazyValue<std::string> lazyValue(data, serializationService);
+                LazyValue<std::string> copy = lazyValue;
+                ASSERT_EQ(value, *copy.get());
+                // the object deserialized through the copy is not deserialized again
+                ASSERT_EQ(copy.get(), lazyValue.get());
+                ASSERT_EQ(lazyValue.getShared().get(), copy.getShared().get());
+
+                LazyValue<std::string> nullValue(boost::shared_ptr<serialization::pimpl::Data>(),
+                                                 serializationService);
+                ASSERT_TRUE(nullValue.isNull());
+                ASSERT_EQ((const std::string *) NULL, nullValue.get());
+            }
+
             TEST_F(ClientSerializationTest, testRawData) {
                 SerializationConfig serializationConfig;
                 serializationConfig.setPortableVersion(1);
@@ -392,6 +414,37 @@ namespace hazelcast {
 
             }
 
+            TEST_F(ClientSerializationTest, testPartitionAwareKeyWritesPartitionHash) {
+                SerializationConfig serializationConfig;
+                serialization::pimpl::SerializationService serializationService(serializationConfig);
+                std::string partitionKey = "partitionKey";
+                TestPartitionAwareKey key1(1, partitionKey);
+                TestPartitionAwareKey key2(2, partitionKey);
+
+                serialization::pimpl::Data partitionKeyData = serializationService.toData<std::string>(&partitionKey);
+                serialization::pimpl::Data data1 = serializationService.toData<TestPartitionAwareKey>(&key1);
+                serialization::pimpl::Data data2 = serializationService.toData<TestPartitionAwareKey>(&key2);
+
+                ASSERT_TRUE(data1.hasPartitionHash());
+                ASSERT_EQ(partitionKeyData.getPartitionHash(), data1.getPartitionHash());
+                ASSERT_EQ(data1.getPartitionHash(), data2.getPartitionHash());
+                ASSERT_EQ(key1, *serializationService.toObject<TestPartitionAwareKey>(data1));
+            }
+
+            TEST_F(ClientSerializationTest, testDataHashDoesNotModifyHeader) {
+                SerializationConfig serializationConfig;
+                serialization::pimpl::SerializationService serializationService(serializationConfig);
+                std::string serializable = "key1";
+                serialization::pimpl::Data data = serializationService.toData<std::string>(&serializable);
+                ASSERT_FALSE(data.hasPartitionHash());
+                std::vector<byte> bytes = data.toByteArray();
+
+                int hash = data.getPartitionHash();
+                ASSERT_FALSE(data.hasPartitionHash());
+                ASSERT_EQ(hash, data.getPartitionHash());
+                ASSERT_EQ(bytes, data.toByteArray());
+            }
+
             TEST_F(ClientSerializationTest, testPrimitives) {
                 SerializationConfig serializationConfig;
                 serialization::pimpl::SerializationService serializationService(serializationConfig);
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "TestPartitionAwareKey.h"
+#include "hazelcast/client/serialization/ObjectDataOutput.h"
+#include "hazelcast/client/serialization/ObjectDataInput.h"
+#include "TestSerializationConstants.h"
+
+namespace hazelcast {
+    namespace client {
+        namespace test {
+            TestPartitionAwareKey::TestPartitionAwareKey() : id(0) {
+            }
+
+            TestPartitionAwareKey::TestPartitionAwareKey(int id, const std::string &partitionKey)
+                    : id(id), partitionKey(partitionKey) {
+            }
+
+            bool TestPartitionAwareKey::operator ==(const TestPartitionAwareKey &rhs) const {
+                return id == rhs.id && partitionKey == rhs.partitionKey;
+            }
+
+            const std::string *TestPartitionAwareKey::getPartitionKey() const {
+                return &partitionKey;
+            }
+
+            int TestPartitionAwareKey::getFactoryId() const {
+                return TestSerializationConstants::TEST_DATA_FACTORY;
+            }
+
+            int TestPartitionAwareKey::getClassId() const {
+                return TestSerializationConstants::TEST_PARTITION_AWARE_KEY;
+            }
+
+            void TestPartitionAwareKey::writeData(serialization::ObjectDataOutput &writer) const {
+                writer.writeInt(id);
+                writer.writeUTF(&partitionKey);
+            }
+
+            void TestPartitionAwareKey::readData(serialization::ObjectDataInput &reader) {
+                id = reader.readInt();
+                partitionKey = *reader.readUTF();
+            }
+        }
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2008-2015, Hazelcast, Inc. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAZELCAST_TestPartitionAwareKey
+#define HAZELCAST_TestPartitionAwareKey
+
+#include "hazelcast/client/serialization/IdentifiedDataSerializable.h"
+#include "hazelcast/client/PartitionAware.h"
+
+#include <string>
+
+namespace hazelcast {
+    namespace client {
+        namespace test {
+            class TestPartitionAwareKey : public serialization::IdentifiedDataSerializable,
+                                          public PartitionAware<std::string> {
+            public:
+                TestPartitionAwareKey();
+
+                TestPartitionAwareKey(int id, const std::string &partitionKey);
+
+                bool operator ==(const TestPartitionAwareKey &rhs) const;
+
+                const std::string *getPartitionKey() const;
+
+                int getFactoryId() const;
+
+                int getClassId() const;
+
+                void writeData(serialization::ObjectDataOutput &writer) const;
+
+                void readData(serialization::ObjectDataInput &reader);
+
+            private:
+                int id;
+                std::string partitionKey;
+            };
+        }
+    }
+}
+
+#endif //HAZELCAST_TestPartitionAwareKey
@@ -20,8 +20,13 @@
 #include "hazelcast/util/Util.h"
 #include "hazelcast/util/Future.h"
 #include "hazelcast/util/Thread.h"
+#include "hazelcast/client/impl/DeserializationExecutor.h"
+#include "hazelcast/client/exception/ProtocolExceptions.h"
+#include "hazelcast/client/LogSink.h"
+#include "hazelcast/util/ILogger.h"
 
 #include <ctime>
+#include <stdexcept>
 #include <errno.h>
 #include <gtest/gtest.h>
 
@@ -55,6 +60,66 @@ namespace hazelcast {
                     std::auto_ptr<client::exception::IException> exception(new exception::IException("exceptionName", "details"));
                     future->set_exception(exception);
                 }
+
+                class CountingArray {
+                public:
+                    CountingArray(size_t size) : counts(size, 0) {
+                    }
+
+                    size_t size() const {
+                        return counts.size();
+                    }
+
+                    void deserialize(size_t index) {
+                        ++counts[index];
+                    }
+
+                    void setDeserializationError(size_t index,
+                                                 const boost::shared_ptr<exception::IException> &error) {
+                    }
+
+                    std::vector<int> counts;
+                };
+
+                /**
+                 * Throws an IException, a std::exception and an int in turns.
+                 */
+                class FailingArray {
+                public:
+                    FailingArray(size_t size) : errors(size) {
+                    }
+
+                    size_t size() const {
+                        return errors.size();
+                    }
+
+                    void deserialize(size_t index) {
+                        switch (index % 3) {
+                            case 0:
+                                throw exception::IllegalStateException("FailingArray::deserialize", "illegal state");
+                            case 1:
+                                throw std::runtime_error("runtime error");
+                            default:
+                                throw (int) index;
+                        }
+                    }
+
+                    void setDeserializationError(size_t index,
+                                                 const boost::shared_ptr<exception::IException> &error) {
+                        errors[index] = error;
+                    }
+
+                    std::vector<boost::shared_ptr<exception::IException> > errors;
+                };
+
+                class CapturingLogSink : public LogSink {
+                public:
+                    void write(const LogRecord &record) {
+                        records.push_back(record);
+                    }
+
+                    std::vector<LogRecord> records;
+                };
             };
 
             TEST_F(ClientUtilTest, testConditionWaitTimeout) {
@@ -191,7 +256,90 @@ namespace hazelcast {
                 ASSERT_EQ(0, util::strerror_s(error, msg, 100));
                 ASSERT_STREQ(expectedErrorString.c_str(), msg);
             }
+
+            TEST_F (ClientUtilTest, testDeserializationExecutor) {
+                client::impl::DeserializationExecutor executor(3, 10);
+
+                CountingArray smallArray(10);
+                executor.deserializeAll(smallArray);
+                for (size_t i = 0; i < smallArray.size(); ++i) {
+                    ASSERT_EQ(0, smallArray.counts[i]);
+                }
+
+                CountingArray largeArray(1005);
+                executor.deserializeAll(largeArray);
+                for (size_t i = 0; i < largeArray.size(); ++i) {
+                    ASSERT_EQ(1, largeArray.counts[i]);
+                }
+
+                executor.shutdown();
+                CountingArray arrayAfterShutdown(100);
+                executor.deserializeAll(arrayAfterShutdown);
+                for (size_t i = 0; i < arrayAfterShutdown.size(); ++i) {
+                    ASSERT_EQ(0, arrayAfterShutdown.counts[i]);
+                }
+            }
+
+            TEST_F (ClientUtilTest, testDeserializationExecutorStoresTheErrors) {
+                client::impl::DeserializationExecutor executor(3, 10);
+
+                FailingArray array(100);
+                executor.deserializeAll(array);
+                for (size_t i = 0; i < array.size(); ++i) {
+                    ASSERT_NE((exception::IException *) NULL, array.errors[i].get());
+                    if (i % 3 == 0) {
+                        ASSERT_THROW(array.errors[i]->raise(), exception::IllegalStateException);
+                    } else {
+                        ASSERT_THROW(array.errors[i]->raise(), exception::HazelcastSerializationException);
+                    }
+                }
+                ASSERT_EQ(std::string("runtime error"), array.errors[1]->getMessage());
+            }
+
+            TEST_F (ClientUtilTest, testLogSink) {
+                util::ILogger &logger = util::ILogger::getLogger();
+                CapturingLogSink sink;
+                logger.setLogLevel(INFO);
+                logger.setSink(&sink);
+
+                LogRecord record(INFO, "structured message");
+                record.addField("name", "value");
+                record.addField("count", 5);
+                logger.log(record);
+                logger.finest("filtered message");
+                logger.warning("plain message");
+                logger.flush();
+                logger.setSink(NULL);
+
+                ASSERT_EQ(2U, sink.records.size());
+                ASSERT_EQ(INFO, sink.records[0].getLevel());
+                ASSERT_EQ("structured message", sink.records[0].getMessage());
+                ASSERT_EQ(2U, sink.records[0].getFields().size());
+                ASSERT_EQ("name", sink.records[0].getFields()[0].first);
+                ASSERT_EQ("value", sink.records[0].getFields()[0].second);
+                ASSERT_EQ("count", sink.records[0].getFields()[1].first);
+                ASSERT_EQ("5", sink.records[0].getFields()[1].second);
+                ASSERT_LT(0, sink.records[0].getTimeMillis());
+                ASSERT_EQ(WARNING, sink.records[1].getLevel());
+                ASSERT_EQ("plain message", sink.records[1].getMessage());
+            }
+
+            TEST_F (ClientUtilTest, testSetLogSinkDrainsTheBuffer) {
+                util::ILogger &logger = util::ILogger::getLogger();
+                logger.setLogLevel(INFO);
+                {
+                    CapturingLogSink sink;
+                    logger.setSink(&sink);
+                    for (int i = 0; i < 100; ++i) {
+                        logger.info("buffered message");
+                    }
+                    // the records are written to the sink before it is replaced, it is destroyed right after
+                    logger.setSink(NULL);
+                    ASSERT_EQ(100U, sink.records.size());
+                }
+                logger.info("message after the sink is destroyed");
+                logger.flush();
+            }
         }
     }
 }
-